@@ -6,6 +6,11 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Large meshes support (64k+ vertices) with 16-bit indices (Desktop OpenGL only).
+//  [X] Renderer: Per draw list index size (ImGuiBackendFlags_RendererHasPackedIdx) when using 32-bit indices.
+//  [X] Renderer: Rectangle instances expanded on GPU (ImGuiBackendFlags_RendererHasRectInstances) (Desktop OpenGL 3.3+ and OpenGL ES 3.0+ only).
+//  [X] Renderer: Index buffer segments (ImGuiBackendFlags_RendererHasIdxSegments), avoiding copies when merging large draw list channels.
+//  [X] Renderer: Compact 12 bytes vertices when IMGUI_USE_COMPACT_DRAWVERT is defined.
+//  [X] Renderer: Partial font texture updates (ImGuiBackendFlags_RendererHasTexUpdates), for glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs).
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -22,6 +27,11 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-17: OpenGL: Upload ImFontAtlas::TexUpdates[] with glTexSubImage2D() and enable ImGuiBackendFlags_RendererHasTexUpdates flag.
+//  2026-10-17: OpenGL: Support compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT): 16-bit fixed-point positions and 16-bit normalized UV.
+//  2026-10-17: OpenGL: Upload ImDrawList::IdxSegments[] and enable ImGuiBackendFlags_RendererHasIdxSegments flag.
+//  2026-10-17: OpenGL: Render ImDrawList::RectBuffer[] instances with a dedicated shader and enable ImGuiBackendFlags_RendererHasRectInstances flag on GL 3.3+/ES 3.0+.
+//  2026-10-17: OpenGL: Honor ImDrawList::IdxSize and enable ImGuiBackendFlags_RendererHasPackedIdx flag when ImDrawIdx is 32-bit.
 //  2024-06-28: OpenGL: ImGui_ImplOpenGL3_NewFrame() recreates font texture if it has been destroyed by ImGui_ImplOpenGL3_DestroyFontsTexture(). (#7748)
 //  2024-05-07: OpenGL: Update loader for Linux to support EGL/GLVND. (#7562)
 //  2024-04-16: OpenGL: Detect ES3 contexts on desktop based on version string, to e.g. avoid calling glPolygonMode() on them. (#7447)
@@ -206,6 +216,11 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// Desktop GL 3.3+ and GL ES 3.0+ have glDrawArraysInstanced() and glVertexAttribDivisor()
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_3))
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -234,8 +249,16 @@ struct ImGui_ImplOpenGL3_Data
     unsigned int    VboHandle, ElementsHandle;
     GLsizeiptr      VertexBufferSize;
     GLsizeiptr      IndexBufferSize;
+    GLuint          RectShaderHandle;        // Shader used to expand ImDrawRectInstance (only with ImGuiBackendFlags_RendererHasRectInstances)
+    GLint           RectAttribLocationProjMtx;
+    GLuint          RectAttribLocationMinMax;
+    GLuint          RectAttribLocationColor;
+    GLuint          RectAttribLocationParams;
+    GLuint          RectAttribLocationFlags;
+    unsigned int    RectVboHandle;
     bool            HasPolygonMode;
     bool            HasClipOrigin;
+    bool            HasRectInstances;
     bool            UseBufferSubData;
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
@@ -340,6 +363,15 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
     if (bd->GlVersion >= 320)
         io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 #endif
+    if (sizeof(ImDrawIdx) == 4)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasPackedIdx;  // We can honor the ImDrawList::IdxSize field, allowing for 16-bit index buffers in small draw lists.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasIdxSegments;    // We can upload ImDrawList::IdxSegments[], allowing ImDrawListSplitter::Merge() to not copy large channels.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates;     // We can upload ImFontAtlas::TexUpdates[], allowing ImFontAtlasFlags_DynamicGlyphs.
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+    bd->HasRectInstances = (bd->GlVersion >= 330 || bd->GlProfileIsES3);
+    if (bd->HasRectInstances)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasRectInstances; // We can render ImDrawList::RectBuffer[] instances. Cleared in ImGui_ImplOpenGL3_CreateDeviceObjects() if the shader cannot be built.
+#endif
 
     // Store GLSL version string so we can refer to it later in case we recreate shaders.
     // Note: GLSL version is NOT the same as GL version. Leave this to nullptr if unsure.
@@ -392,7 +424,7 @@ void    ImGui_ImplOpenGL3_Shutdown()
     ImGui_ImplOpenGL3_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasPackedIdx | ImGuiBackendFlags_RendererHasRectInstances | ImGuiBackendFlags_RendererHasIdxSegments | ImGuiBackendFlags_RendererHasTexUpdates);
     IM_DELETE(bd);
 }
 
@@ -456,9 +488,22 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
+    if (bd->RectShaderHandle)
+    {
+        glUseProgram(bd->RectShaderHandle);
+        glUniformMatrix4fv(bd->RectAttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    }
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    float vtx_projection[4][4]; // ImDrawVert::pos is 16-bit fixed-point (see IMGUI_USE_COMPACT_DRAWVERT): scale it back to pixels
+    memcpy(vtx_projection, ortho_projection, sizeof(vtx_projection));
+    vtx_projection[0][0] /= IM_DRAWVERT_POS_SCALE;
+    vtx_projection[1][1] /= IM_DRAWVERT_POS_SCALE;
+#else
+    const float (*vtx_projection)[4] = ortho_projection;
+#endif
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
-    glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &vtx_projection[0][0]);
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
@@ -476,14 +521,44 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_SHORT,          GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#else
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#endif
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
 }
 
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
+// Upload parts of font atlas modified since last frame (see ImFontAtlasFlags_DynamicGlyphs)
+static void ImGui_ImplOpenGL3_UpdateFontsTexture()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (atlas->TexUpdates.Size == 0 || bd->FontTexture == 0 || atlas->TexPixelsRGBA32 == NULL)
+        return;
+
+    GLint last_texture;
+    GL_CALL(glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, bd->FontTexture));
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, atlas->TexWidth));
+    for (const ImFontAtlasTexUpdate& update : atlas->TexUpdates)
+        GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, update.X, update.Y, update.Width, update.Height, GL_RGBA, GL_UNSIGNED_BYTE, atlas->TexPixelsRGBA32 + update.Y * atlas->TexWidth + update.X));
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+#else
+    // Without GL_UNPACK_ROW_LENGTH, upload whole rows
+    for (const ImFontAtlasTexUpdate& update : atlas->TexUpdates)
+        GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, update.Y, atlas->TexWidth, update.Height, GL_RGBA, GL_UNSIGNED_BYTE, atlas->TexPixelsRGBA32 + update.Y * atlas->TexWidth));
+#endif
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture));
+    atlas->TexUpdates.resize(0);
+}
+
 void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 {
     // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
@@ -493,6 +568,7 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         return;
 
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImGui_ImplOpenGL3_UpdateFontsTexture();
 
     // Backup GL state
     GLenum last_active_texture; glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&last_active_texture);
@@ -542,6 +618,24 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
 
+    // Rectangle instances use their own VAO, with per-instance attributes pointing into RectVboHandle
+    GLuint rect_vertex_array_object = 0;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+    if (bd->RectShaderHandle)
+    {
+        GL_CALL(glGenVertexArrays(1, &rect_vertex_array_object));
+        GL_CALL(glBindVertexArray(rect_vertex_array_object));
+        const GLuint rect_attribs[] = { bd->RectAttribLocationMinMax, bd->RectAttribLocationColor, bd->RectAttribLocationParams, bd->RectAttribLocationFlags };
+        for (GLuint attrib : rect_attribs)
+        {
+            GL_CALL(glEnableVertexAttribArray(attrib));
+            GL_CALL(glVertexAttribDivisor(attrib, 1));
+        }
+        GL_CALL(glBindVertexArray(vertex_array_object));
+    }
+#endif
+    (void)rect_vertex_array_object;
+
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
@@ -560,7 +654,8 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         //   We are keeping the old code path for a while in case people finding new issues may want to test the bd->UseBufferSubData path.
         // - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
         const GLsizeiptr vtx_buffer_size = (GLsizeiptr)cmd_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
-        const GLsizeiptr idx_buffer_size = (GLsizeiptr)cmd_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
+        const GLsizeiptr idx_buffer_size = (GLsizeiptr)cmd_list->IdxBuffer.Size * cmd_list->IdxSize;
+        const GLenum idx_type = (cmd_list->IdxSize == 2) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
         if (bd->UseBufferSubData)
         {
             if (bd->VertexBufferSize < vtx_buffer_size)
@@ -581,6 +676,16 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
             GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW));
             GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW));
         }
+        for (const ImDrawIdxSegment& segment : cmd_list->IdxSegments) // Ranges of IdxBuffer[] stored separately, which content we just uploaded is undefined
+            GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, (GLintptr)segment.IdxOffset * cmd_list->IdxSize, (GLsizeiptr)segment.IdxBuffer.Size * cmd_list->IdxSize, (const GLvoid*)segment.IdxBuffer.Data));
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+        if (rect_vertex_array_object != 0 && cmd_list->RectBuffer.Size > 0)
+        {
+            GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->RectVboHandle));
+            GL_CALL(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->RectBuffer.Size * (int)sizeof(ImDrawRectInstance), (const GLvoid*)cmd_list->RectBuffer.Data, GL_STREAM_DRAW));
+            GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
+        }
+#endif
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
@@ -605,14 +710,36 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
                 GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+                // Draw rectangle instances: 4 vertices triangle strip per instance, expanded and shaded by RectShaderHandle
+                if (pcmd->RectCount != 0)
+                {
+                    if (rect_vertex_array_object == 0)
+                        continue;
+                    const GLsizeiptr rect_offset = (GLsizeiptr)pcmd->RectOffset * (int)sizeof(ImDrawRectInstance);
+                    GL_CALL(glUseProgram(bd->RectShaderHandle));
+                    GL_CALL(glBindVertexArray(rect_vertex_array_object));
+                    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->RectVboHandle));
+                    GL_CALL(glVertexAttribPointer(bd->RectAttribLocationMinMax, 4, GL_FLOAT,        GL_FALSE, sizeof(ImDrawRectInstance), (GLvoid*)(rect_offset + offsetof(ImDrawRectInstance, Min))));
+                    GL_CALL(glVertexAttribPointer(bd->RectAttribLocationColor,  4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawRectInstance), (GLvoid*)(rect_offset + offsetof(ImDrawRectInstance, Col))));
+                    GL_CALL(glVertexAttribPointer(bd->RectAttribLocationParams, 2, GL_FLOAT,        GL_FALSE, sizeof(ImDrawRectInstance), (GLvoid*)(rect_offset + offsetof(ImDrawRectInstance, Rounding))));
+                    GL_CALL(glVertexAttribPointer(bd->RectAttribLocationFlags,  1, GL_UNSIGNED_INT, GL_FALSE, sizeof(ImDrawRectInstance), (GLvoid*)(rect_offset + offsetof(ImDrawRectInstance, Flags))));
+                    GL_CALL(glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)pcmd->RectCount));
+                    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
+                    GL_CALL(glBindVertexArray(vertex_array_object));
+                    GL_CALL(glUseProgram(bd->ShaderHandle));
+                    continue;
+                }
+#endif
+
                 // Bind texture, Draw
                 GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
                 if (bd->GlVersion >= 320)
-                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
+                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, idx_type, (void*)(intptr_t)(pcmd->IdxOffset * cmd_list->IdxSize), (GLint)pcmd->VtxOffset));
                 else
 #endif
-                GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
+                GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, idx_type, (void*)(intptr_t)(pcmd->IdxOffset * cmd_list->IdxSize)));
             }
         }
     }
@@ -620,6 +747,8 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     // Destroy the temporary VAO
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glDeleteVertexArrays(1, &vertex_array_object));
+    if (rect_vertex_array_object != 0)
+        GL_CALL(glDeleteVertexArrays(1, &rect_vertex_array_object));
 #endif
 
     // Restore modified GL state
@@ -924,6 +1053,101 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     glGenBuffers(1, &bd->VboHandle);
     glGenBuffers(1, &bd->ElementsHandle);
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_RECT_INSTANCES
+    // Rectangle instances shader
+    // - Vertex shader expands each instance into a quad (using gl_VertexID) enlarged by half the stroke thickness + 1 pixel for anti-aliasing.
+    // - Fragment shader evaluates the signed distance to the rounded rectangle, with a radius per corner.
+    // - ImDrawRectInstance::Flags bits 0-3 select rounded corners (TL, TR, BL, BR), bit 4 enables anti-aliasing.
+    if (bd->HasRectInstances && glsl_version >= 130)
+    {
+        const GLchar* rect_vertex_shader_glsl_130 =
+            "uniform mat4 ProjMtx;\n"
+            "in vec4 RectMinMax;\n"
+            "in vec4 RectColor;\n"
+            "in vec2 RectParams;\n"
+            "in float RectFlags;\n"
+            "out vec2 Frag_Pos;\n"
+            "flat out vec2 Frag_HalfSize;\n"
+            "flat out vec4 Frag_Radius;\n"
+            "flat out vec2 Frag_StrokeAA;\n"
+            "flat out vec4 Frag_Color;\n"
+            "void main()\n"
+            "{\n"
+            "    vec4 corners = mod(floor(vec4(RectFlags) / vec4(1.0, 2.0, 4.0, 8.0)), 2.0);\n"
+            "    vec2 half_size = (RectMinMax.zw - RectMinMax.xy) * 0.5;\n"
+            "    vec2 quad = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1)) * 2.0 - 1.0;\n"
+            "    Frag_Pos = quad * (half_size + RectParams.y * 0.5 + 1.0);\n"
+            "    Frag_HalfSize = half_size;\n"
+            "    Frag_Radius = corners * RectParams.x;\n"
+            "    Frag_StrokeAA = vec2(RectParams.y, mod(floor(RectFlags / 16.0), 2.0));\n"
+            "    Frag_Color = RectColor;\n"
+            "    gl_Position = ProjMtx * vec4((RectMinMax.xy + RectMinMax.zw) * 0.5 + Frag_Pos, 0, 1);\n"
+            "}\n";
+
+        const GLchar* rect_fragment_shader_glsl_130 =
+            "in vec2 Frag_Pos;\n"
+            "flat in vec2 Frag_HalfSize;\n"
+            "flat in vec4 Frag_Radius;\n"
+            "flat in vec2 Frag_StrokeAA;\n"
+            "flat in vec4 Frag_Color;\n"
+            "out vec4 Out_Color;\n"
+            "void main()\n"
+            "{\n"
+            "    vec2 radius_y = (Frag_Pos.y < 0.0) ? Frag_Radius.xy : Frag_Radius.zw;\n"
+            "    float radius = (Frag_Pos.x < 0.0) ? radius_y.x : radius_y.y;\n"
+            "    vec2 q = abs(Frag_Pos) - Frag_HalfSize + radius;\n"
+            "    float d = (radius > 0.0) ? length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - radius : max(q.x, q.y);\n"
+            "    if (Frag_StrokeAA.x > 0.0)\n"
+            "        d = abs(d) - Frag_StrokeAA.x * 0.5;\n"
+            "    float coverage = (Frag_StrokeAA.y > 0.5) ? clamp(0.5 - d, 0.0, 1.0) : ((d < 0.0) ? 1.0 : 0.0);\n"
+            "    Out_Color = vec4(Frag_Color.rgb, Frag_Color.a * coverage);\n"
+            "}\n";
+
+        // GLSL 300 es only differs by requiring precision qualifiers
+        const GLchar* rect_precision_glsl_300_es = (glsl_version == 300) ? "precision highp float;\n" : "";
+        const GLchar* rect_vertex_shader_with_version[3] = { bd->GlslVersionString, rect_precision_glsl_300_es, rect_vertex_shader_glsl_130 };
+        GLuint rect_vert_handle = glCreateShader(GL_VERTEX_SHADER);
+        glShaderSource(rect_vert_handle, 3, rect_vertex_shader_with_version, nullptr);
+        glCompileShader(rect_vert_handle);
+        CheckShader(rect_vert_handle, "rectangle vertex shader");
+
+        const GLchar* rect_fragment_shader_with_version[3] = { bd->GlslVersionString, rect_precision_glsl_300_es, rect_fragment_shader_glsl_130 };
+        GLuint rect_frag_handle = glCreateShader(GL_FRAGMENT_SHADER);
+        glShaderSource(rect_frag_handle, 3, rect_fragment_shader_with_version, nullptr);
+        glCompileShader(rect_frag_handle);
+        CheckShader(rect_frag_handle, "rectangle fragment shader");
+
+        bd->RectShaderHandle = glCreateProgram();
+        glAttachShader(bd->RectShaderHandle, rect_vert_handle);
+        glAttachShader(bd->RectShaderHandle, rect_frag_handle);
+        glLinkProgram(bd->RectShaderHandle);
+        const bool rect_shader_linked = CheckProgram(bd->RectShaderHandle, "rectangle shader program");
+
+        glDetachShader(bd->RectShaderHandle, rect_vert_handle);
+        glDetachShader(bd->RectShaderHandle, rect_frag_handle);
+        glDeleteShader(rect_vert_handle);
+        glDeleteShader(rect_frag_handle);
+
+        if (rect_shader_linked)
+        {
+            bd->RectAttribLocationProjMtx = glGetUniformLocation(bd->RectShaderHandle, "ProjMtx");
+            bd->RectAttribLocationMinMax = (GLuint)glGetAttribLocation(bd->RectShaderHandle, "RectMinMax");
+            bd->RectAttribLocationColor = (GLuint)glGetAttribLocation(bd->RectShaderHandle, "RectColor");
+            bd->RectAttribLocationParams = (GLuint)glGetAttribLocation(bd->RectShaderHandle, "RectParams");
+            bd->RectAttribLocationFlags = (GLuint)glGetAttribLocation(bd->RectShaderHandle, "RectFlags");
+            glGenBuffers(1, &bd->RectVboHandle);
+        }
+        else
+        {
+            glDeleteProgram(bd->RectShaderHandle);
+            bd->RectShaderHandle = 0;
+        }
+    }
+#endif
+    // Fallback to CPU tessellation of rectangles if we can't render instances
+    if (bd->RectShaderHandle == 0)
+        ImGui::GetIO().BackendFlags &= ~ImGuiBackendFlags_RendererHasRectInstances;
+
     ImGui_ImplOpenGL3_CreateFontsTexture();
 
     // Restore modified GL state
@@ -945,6 +1169,8 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+    if (bd->RectVboHandle)  { glDeleteBuffers(1, &bd->RectVboHandle); bd->RectVboHandle = 0; }
+    if (bd->RectShaderHandle) { glDeleteProgram(bd->RectShaderHandle); bd->RectShaderHandle = 0; }
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
 
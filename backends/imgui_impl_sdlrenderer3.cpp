@@ -10,6 +10,8 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'SDL_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
 //  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Per draw list index size (ImGuiBackendFlags_RendererHasPackedIdx) when using 32-bit indices.
+//  [X] Renderer: Partial font texture updates (ImGuiBackendFlags_RendererHasTexUpdates), for glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs).
 
 // You can copy and use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -20,6 +22,8 @@
 // - Introduction, links and more at the top of imgui.cpp
 
 // CHANGELOG
+//  2026-10-17: Upload ImFontAtlas::TexUpdates[] with SDL_UpdateTexture() and enable ImGuiBackendFlags_RendererHasTexUpdates flag.
+//  2026-10-17: Honor ImDrawList::IdxSize and enable ImGuiBackendFlags_RendererHasPackedIdx flag when ImDrawIdx is 32-bit.
 //  2024-07-01: Update for SDL3 api changes: SDL_RenderGeometryRaw() uint32 version was removed (SDL#9009).
 //  2024-05-14: *BREAKING CHANGE* ImGui_ImplSDLRenderer3_RenderDrawData() requires SDL_Renderer* passed as parameter.
 //  2024-02-12: Amend to query SDL_RenderViewportSet() and restore viewport accordingly.
@@ -28,6 +32,9 @@
 #include "imgui.h"
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_sdlrenderer3.h"
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+#error IMGUI_USE_COMPACT_DRAWVERT is not supported by this backend
+#endif
 #include <stdint.h>     // intptr_t
 
 // Clang warnings with -Weverything
@@ -72,6 +79,9 @@ bool ImGui_ImplSDLRenderer3_Init(SDL_Renderer* renderer)
     io.BackendRendererUserData = (void*)bd;
     io.BackendRendererName = "imgui_impl_sdlrenderer3";
     io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    if (sizeof(ImDrawIdx) == 4)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasPackedIdx;  // We can honor the ImDrawList::IdxSize field, allowing for 16-bit index buffers in small draw lists.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates;     // We can upload ImFontAtlas::TexUpdates[], allowing ImFontAtlasFlags_DynamicGlyphs.
 
     bd->Renderer = renderer;
 
@@ -88,7 +98,7 @@ void ImGui_ImplSDLRenderer3_Shutdown()
 
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasPackedIdx | ImGuiBackendFlags_RendererHasTexUpdates);
     IM_DELETE(bd);
 }
 
@@ -127,6 +137,21 @@ static int SDL_RenderGeometryRaw8BitColor(SDL_Renderer* renderer, ImVector<SDL_F
     return SDL_RenderGeometryRaw(renderer, texture, xy, xy_stride, color3, sizeof(*color3), uv, uv_stride, num_vertices, indices, num_indices, size_indices);
 }
 
+// Upload parts of font atlas modified since last frame (see ImFontAtlasFlags_DynamicGlyphs)
+static void ImGui_ImplSDLRenderer3_UpdateFontsTexture()
+{
+    ImGui_ImplSDLRenderer3_Data* bd = ImGui_ImplSDLRenderer3_GetBackendData();
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (atlas->TexUpdates.Size == 0 || bd->FontTexture == nullptr || atlas->TexPixelsRGBA32 == nullptr)
+        return;
+    for (const ImFontAtlasTexUpdate& update : atlas->TexUpdates)
+    {
+        SDL_Rect rect = { update.X, update.Y, update.Width, update.Height };
+        SDL_UpdateTexture(bd->FontTexture, &rect, atlas->TexPixelsRGBA32 + update.Y * atlas->TexWidth + update.X, 4 * atlas->TexWidth);
+    }
+    atlas->TexUpdates.resize(0);
+}
+
 void ImGui_ImplSDLRenderer3_RenderDrawData(ImDrawData* draw_data, SDL_Renderer* renderer)
 {
     ImGui_ImplSDLRenderer3_Data* bd = ImGui_ImplSDLRenderer3_GetBackendData();
@@ -147,6 +172,9 @@ void ImGui_ImplSDLRenderer3_RenderDrawData(ImDrawData* draw_data, SDL_Renderer*
 	if (fb_width == 0 || fb_height == 0)
 		return;
 
+    // Upload font atlas changes
+    ImGui_ImplSDLRenderer3_UpdateFontsTexture();
+
     // Backup SDL_Renderer state that will be modified to restore it afterwards
     struct BackupSDLRendererState
     {
@@ -171,7 +199,7 @@ void ImGui_ImplSDLRenderer3_RenderDrawData(ImDrawData* draw_data, SDL_Renderer*
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
         const ImDrawVert* vtx_buffer = cmd_list->VtxBuffer.Data;
-        const ImDrawIdx* idx_buffer = cmd_list->IdxBuffer.Data;
+        const char* idx_buffer = (const char*)cmd_list->IdxBuffer.Data;
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
@@ -211,7 +239,7 @@ void ImGui_ImplSDLRenderer3_RenderDrawData(ImDrawData* draw_data, SDL_Renderer*
                     color, (int)sizeof(ImDrawVert),
                     uv, (int)sizeof(ImDrawVert),
                     cmd_list->VtxBuffer.Size - pcmd->VtxOffset,
-                    idx_buffer + pcmd->IdxOffset, pcmd->ElemCount, sizeof(ImDrawIdx));
+                    idx_buffer + pcmd->IdxOffset * cmd_list->IdxSize, pcmd->ElemCount, cmd_list->IdxSize);
             }
         }
     }
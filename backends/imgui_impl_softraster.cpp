@@ -0,0 +1,1077 @@
+// dear imgui: Renderer Backend for software rasterization into a CPU pixel buffer
+// This needs to be used along with a Platform Backend, or standalone for headless rendering (e.g. tests, screenshots, remote viewers).
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftraster_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Per draw list index size (ImGuiBackendFlags_RendererHasPackedIdx) when using 32-bit indices.
+//  [X] Renderer: Rectangle instances (ImGuiBackendFlags_RendererHasRectInstances), rasterized from their signed distance.
+//  [X] Renderer: Index buffer segments (ImGuiBackendFlags_RendererHasIdxSegments).
+//  [X] Renderer: Font texture updates (ImGuiBackendFlags_RendererHasTexUpdates), for glyphs rasterized on demand.
+//  [X] Renderer: Compact 12 bytes vertices when IMGUI_USE_COMPACT_DRAWVERT is defined.
+//  [X] Renderer: Multi-threaded rasterization, with primitives binned into screen tiles.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+// CHANGELOG
+//  2026-10-17: Support ImFontAtlas::TexUpdates[]. Enable ImGuiBackendFlags_RendererHasTexUpdates flag.
+//  2026-10-17: Initial version.
+
+// How it works:
+// - ImGui_ImplSoftraster_RenderDrawData() converts commands to a list of primitives in submission order: triangles, axis-aligned
+//   textured quads (detected from pairs of triangles, which is how Dear ImGui outputs text and most filled shapes) and rectangle instances.
+// - Primitives are binned into 64x64 pixel tiles. Tiles are rasterized in parallel: each tile is owned by a single thread,
+//   and visits its primitives in submission order, so output is identical whatever the number of threads.
+// - Triangles are rasterized with edge functions evaluated on 4 pixels at a time (SSE2 when available, scalar otherwise),
+//   using 1/16th pixel fixed-point vertices and a top-left fill rule, so adjacent triangles never overlap or leave gaps.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_softraster.h"
+#include <stdint.h>     // intptr_t, int64_t
+#include <math.h>       // floorf, ceilf, fabsf, sqrtf
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Use SSE2 when available. Define IMGUI_IMPL_SOFTRASTER_DISABLE_SSE to use the portable scalar path.
+#if !defined(IMGUI_IMPL_SOFTRASTER_DISABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define IMGUI_IMPL_SOFTRASTER_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+// Clang/GCC warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wold-style-cast"         // warning: use of old-style cast
+#pragma clang diagnostic ignored "-Wsign-conversion"        // warning: implicit conversion changes signedness
+#pragma clang diagnostic ignored "-Wfloat-equal"            // warning: comparing floating point with == or != is unsafe
+#endif
+
+#define IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT   6               // 64x64 pixels tiles
+#define IMGUI_IMPL_SOFTRASTER_TILE_SIZE         (1 << IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT)
+#define IMGUI_IMPL_SOFTRASTER_SUBPIXEL_SHIFT    4               // Vertices are snapped to 1/16th of a pixel
+#define IMGUI_IMPL_SOFTRASTER_MAX_COORD         262144.0f       // Vertices are clamped to +/- this many pixels, so edge functions fit in 64-bit integers and 4 pixels steps fit in 32-bit integers
+
+//-----------------------------------------------------------------------------
+// 4-wide float/integer helpers
+//-----------------------------------------------------------------------------
+// - Integer masks are all bits set (true) or all bits cleared (false) in each lane.
+
+#ifdef IMGUI_IMPL_SOFTRASTER_USE_SSE2
+typedef __m128  ImSoftF4;
+typedef __m128i ImSoftI4;
+static inline ImSoftF4 ImSoftF4_Set1(float v)                               { return _mm_set1_ps(v); }
+static inline ImSoftF4 ImSoftF4_Add(ImSoftF4 a, ImSoftF4 b)                 { return _mm_add_ps(a, b); }
+static inline ImSoftF4 ImSoftF4_Sub(ImSoftF4 a, ImSoftF4 b)                 { return _mm_sub_ps(a, b); }
+static inline ImSoftF4 ImSoftF4_Mul(ImSoftF4 a, ImSoftF4 b)                 { return _mm_mul_ps(a, b); }
+static inline ImSoftF4 ImSoftF4_Min(ImSoftF4 a, ImSoftF4 b)                 { return _mm_min_ps(a, b); }
+static inline ImSoftF4 ImSoftF4_Max(ImSoftF4 a, ImSoftF4 b)                 { return _mm_max_ps(a, b); }
+static inline ImSoftF4 ImSoftF4_Sqrt(ImSoftF4 a)                            { return _mm_sqrt_ps(a); }
+static inline ImSoftF4 ImSoftF4_Abs(ImSoftF4 a)                             { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+static inline ImSoftF4 ImSoftF4_FromI4(ImSoftI4 a)                          { return _mm_cvtepi32_ps(a); }
+static inline ImSoftI4 ImSoftF4_CmpLt(ImSoftF4 a, ImSoftF4 b)               { return _mm_castps_si128(_mm_cmplt_ps(a, b)); }
+static inline ImSoftF4 ImSoftF4_Select(ImSoftI4 m, ImSoftF4 a, ImSoftF4 b)  { __m128 mf = _mm_castsi128_ps(m); return _mm_or_ps(_mm_and_ps(mf, a), _mm_andnot_ps(mf, b)); }
+static inline ImSoftI4 ImSoftI4_Set1(int v)                                 { return _mm_set1_epi32(v); }
+static inline ImSoftI4 ImSoftI4_Set(int a, int b, int c, int d)             { return _mm_setr_epi32(a, b, c, d); }
+static inline ImSoftI4 ImSoftI4_Add(ImSoftI4 a, ImSoftI4 b)                 { return _mm_add_epi32(a, b); }
+static inline ImSoftI4 ImSoftI4_Or(ImSoftI4 a, ImSoftI4 b)                  { return _mm_or_si128(a, b); }
+static inline ImSoftI4 ImSoftI4_And(ImSoftI4 a, ImSoftI4 b)                 { return _mm_and_si128(a, b); }
+static inline ImSoftI4 ImSoftI4_AndNot(ImSoftI4 a, ImSoftI4 b)              { return _mm_andnot_si128(a, b); } // ~a & b
+static inline ImSoftI4 ImSoftI4_CmpLt(ImSoftI4 a, ImSoftI4 b)               { return _mm_cmplt_epi32(a, b); }
+static inline ImSoftI4 ImSoftI4_SignMask(ImSoftI4 a)                        { return _mm_srai_epi32(a, 31); }
+static inline ImSoftI4 ImSoftI4_Select(ImSoftI4 m, ImSoftI4 a, ImSoftI4 b)  { return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+static inline ImSoftI4 ImSoftI4_FromF4Trunc(ImSoftF4 a)                     { return _mm_cvttps_epi32(a); }
+static inline ImSoftI4 ImSoftI4_Load(const ImU32* p)                        { return _mm_loadu_si128((const __m128i*)(const void*)p); }
+static inline void     ImSoftI4_Store(ImU32* p, ImSoftI4 v)                 { _mm_storeu_si128((__m128i*)(void*)p, v); }
+static inline void     ImSoftI4_StoreInts(int* p, ImSoftI4 v)               { _mm_storeu_si128((__m128i*)(void*)p, v); }
+static inline bool     ImSoftI4_Any(ImSoftI4 m)                             { return _mm_movemask_ps(_mm_castsi128_ps(m)) != 0; }
+static inline bool     ImSoftI4_All(ImSoftI4 m)                             { return _mm_movemask_ps(_mm_castsi128_ps(m)) == 0x0F; }
+static inline ImSoftF4 ImSoftI4_UnpackChannel(ImSoftI4 px, int shift)       { return _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(px, shift), _mm_set1_epi32(0xFF))); }
+static inline ImSoftI4 ImSoftI4_PackChannel(ImSoftF4 v, int shift)          { return _mm_slli_epi32(_mm_cvtps_epi32(v), shift); }
+#else
+struct ImSoftF4 { float v[4]; };
+struct ImSoftI4 { int v[4]; };
+#define IM_SOFT_LANES(_EXPR)   for (int n = 0; n < 4; n++) { _EXPR; }
+static inline ImSoftF4 ImSoftF4_Set1(float v)                               { ImSoftF4 r; IM_SOFT_LANES(r.v[n] = v); return r; }
+static inline ImSoftF4 ImSoftF4_Add(ImSoftF4 a, ImSoftF4 b)                 { ImSoftF4 r; IM_SOFT_LANES(r.v[n] = a.v[n] + b.v[n]); return r; }
+static inline ImSoftF4 ImSoftF4_Sub(ImSoftF4 a, ImSoftF4 b)                 { ImSoftF4 r; IM_SOFT_LANES(r.v[n] = a.v[n] - b.v[n]); return r; }
+static inline ImSoftF4 ImSoftF4_Mul(ImSoftF4 a, ImSoftF4 b)                 { ImSoftF4 r; IM_SOFT_LANES(r.v[n] = a.v[n] * b.v[n]); return r; }
+static inline ImSoftF4 ImSoftF4_Min(ImSoftF4 a, ImSoftF4 b)                 { ImSoftF4 r; IM_SOFT_LANES(r.v[n] = (a.v[n] < b.v[n]) ? a.v[n] : b.v[n]); return r; }
+static inline ImSoftF4 ImSoftF4_Max(ImSoftF4 a, ImSoftF4 b)                 { ImSoftF4 r; IM_SOFT_LANES(r.v[n] = (a.v[n] > b.v[n]) ? a.v[n] : b.v[n]); return r; }
+static inline ImSoftF4 ImSoftF4_Sqrt(ImSoftF4 a)                            { ImSoftF4 r; IM_SOFT_LANES(r.v[n] = sqrtf(a.v[n])); return r; }
+static inline ImSoftF4 ImSoftF4_Abs(ImSoftF4 a)                             { ImSoftF4 r; IM_SOFT_LANES(r.v[n] = (a.v[n] < 0.0f) ? -a.v[n] : a.v[n]); return r; }
+static inline ImSoftF4 ImSoftF4_FromI4(ImSoftI4 a)                          { ImSoftF4 r; IM_SOFT_LANES(r.v[n] = (float)a.v[n]); return r; }
+static inline ImSoftI4 ImSoftF4_CmpLt(ImSoftF4 a, ImSoftF4 b)               { ImSoftI4 r; IM_SOFT_LANES(r.v[n] = (a.v[n] < b.v[n]) ? -1 : 0); return r; }
+static inline ImSoftF4 ImSoftF4_Select(ImSoftI4 m, ImSoftF4 a, ImSoftF4 b)  { ImSoftF4 r; IM_SOFT_LANES(r.v[n] = m.v[n] ? a.v[n] : b.v[n]); return r; }
+static inline ImSoftI4 ImSoftI4_Set1(int v)                                 { ImSoftI4 r; IM_SOFT_LANES(r.v[n] = v); return r; }
+static inline ImSoftI4 ImSoftI4_Set(int a, int b, int c, int d)             { ImSoftI4 r; r.v[0] = a; r.v[1] = b; r.v[2] = c; r.v[3] = d; return r; }
+static inline ImSoftI4 ImSoftI4_Add(ImSoftI4 a, ImSoftI4 b)                 { ImSoftI4 r; IM_SOFT_LANES(r.v[n] = (int)((unsigned int)a.v[n] + (unsigned int)b.v[n])); return r; }
+static inline ImSoftI4 ImSoftI4_Or(ImSoftI4 a, ImSoftI4 b)                  { ImSoftI4 r; IM_SOFT_LANES(r.v[n] = a.v[n] | b.v[n]); return r; }
+static inline ImSoftI4 ImSoftI4_And(ImSoftI4 a, ImSoftI4 b)                 { ImSoftI4 r; IM_SOFT_LANES(r.v[n] = a.v[n] & b.v[n]); return r; }
+static inline ImSoftI4 ImSoftI4_AndNot(ImSoftI4 a, ImSoftI4 b)              { ImSoftI4 r; IM_SOFT_LANES(r.v[n] = ~a.v[n] & b.v[n]); return r; }
+static inline ImSoftI4 ImSoftI4_CmpLt(ImSoftI4 a, ImSoftI4 b)               { ImSoftI4 r; IM_SOFT_LANES(r.v[n] = (a.v[n] < b.v[n]) ? -1 : 0); return r; }
+static inline ImSoftI4 ImSoftI4_SignMask(ImSoftI4 a)                        { ImSoftI4 r; IM_SOFT_LANES(r.v[n] = (a.v[n] < 0) ? -1 : 0); return r; }
+static inline ImSoftI4 ImSoftI4_Select(ImSoftI4 m, ImSoftI4 a, ImSoftI4 b)  { ImSoftI4 r; IM_SOFT_LANES(r.v[n] = (m.v[n] & a.v[n]) | (~m.v[n] & b.v[n])); return r; }
+static inline ImSoftI4 ImSoftI4_FromF4Trunc(ImSoftF4 a)                     { ImSoftI4 r; IM_SOFT_LANES(r.v[n] = (int)a.v[n]); return r; }
+static inline ImSoftI4 ImSoftI4_Load(const ImU32* p)                        { ImSoftI4 r; IM_SOFT_LANES(r.v[n] = (int)p[n]); return r; }
+static inline void     ImSoftI4_Store(ImU32* p, ImSoftI4 v)                 { IM_SOFT_LANES(p[n] = (ImU32)v.v[n]); }
+static inline void     ImSoftI4_StoreInts(int* p, ImSoftI4 v)               { IM_SOFT_LANES(p[n] = v.v[n]); }
+static inline bool     ImSoftI4_Any(ImSoftI4 m)                             { return (m.v[0] | m.v[1] | m.v[2] | m.v[3]) != 0; }
+static inline bool     ImSoftI4_All(ImSoftI4 m)                             { return (m.v[0] & m.v[1] & m.v[2] & m.v[3]) != 0; }
+static inline ImSoftF4 ImSoftI4_UnpackChannel(ImSoftI4 px, int shift)       { ImSoftF4 r; IM_SOFT_LANES(r.v[n] = (float)(((ImU32)px.v[n] >> shift) & 0xFF)); return r; }
+static inline ImSoftI4 ImSoftI4_PackChannel(ImSoftF4 v, int shift)          { ImSoftI4 r; IM_SOFT_LANES(r.v[n] = (int)((ImU32)(int)floorf(v.v[n] + 0.5f) << shift)); return r; }
+#undef IM_SOFT_LANES
+#endif
+
+//-----------------------------------------------------------------------------
+// Data
+//-----------------------------------------------------------------------------
+
+enum ImGui_ImplSoftraster_PrimType
+{
+    ImGui_ImplSoftraster_PrimType_Triangle,
+    ImGui_ImplSoftraster_PrimType_Quad,         // Axis-aligned quad: Pos[0]/Pos[1] are min/max corners, Uv[0]/Uv[1] their UV, Col[0] the color
+    ImGui_ImplSoftraster_PrimType_Rect,         // Rectangle instance: Pos[0]/Pos[1] are min/max corners, Uv[0] is (Rounding, Thickness), Col[0] the color, Col[1] the flags
+};
+
+struct ImGui_ImplSoftraster_Prim
+{
+    int                                 Type;               // ImGui_ImplSoftraster_PrimType
+    int                                 X0, Y0, X1, Y1;     // Pixel bounds, clipped to the clipping rectangle and render target (X1/Y1 excluded)
+    const ImGui_ImplSoftraster_Texture* Texture;            // nullptr == white
+    ImVec2                              Pos[3];             // Framebuffer coordinates
+    ImVec2                              Uv[3];
+    ImU32                               Col[3];
+};
+
+// Color with 0..255 channels
+struct ImGui_ImplSoftraster_Color
+{
+    float   R, G, B, A;
+};
+
+// Software rasterizer data
+struct ImGui_ImplSoftraster_Data
+{
+    ImGui_ImplSoftraster_Texture        FontTexture;
+    unsigned char*                      FontPixels;
+
+    // Primitives and tiles of the current batch (a batch ends with each user callback and at the end of the frame)
+    ImVector<ImGui_ImplSoftraster_Prim> Prims;
+    ImVector<int>                       TileStarts;         // Index of first primitive of each tile in TilePrims[]. Size: TilesCount + 1
+    ImVector<int>                       TilePrims;          // Index of primitives in Prims[], grouped by tile
+    ImVector<int>                       TileCursors;
+
+    // Render target
+    ImU32*                              Pixels;
+    int                                 Width;
+    int                                 Height;
+    int                                 Pitch;              // In bytes
+    int                                 TilesX;
+    int                                 TilesY;
+
+    // Worker threads. The calling thread rasterizes tiles too.
+    ImVector<std::thread*>              Workers;
+    std::mutex                          WorkMutex;
+    std::condition_variable             WorkStartCond;
+    std::condition_variable             WorkDoneCond;
+    int                                 WorkGeneration;
+    int                                 WorkersBusy;
+    bool                                WorkQuit;
+    std::atomic<int>                    NextTile;
+
+    ImGui_ImplSoftraster_Data() : FontPixels(nullptr), Pixels(nullptr), Width(0), Height(0), Pitch(0), TilesX(0), TilesY(0), WorkGeneration(0), WorkersBusy(0), WorkQuit(false), NextTile(0) { memset((void*)&FontTexture, 0, sizeof(FontTexture)); }
+};
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+// It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
+static ImGui_ImplSoftraster_Data* ImGui_ImplSoftraster_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplSoftraster_Data*)ImGui::GetIO().BackendRendererUserData : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Pixels helpers
+//-----------------------------------------------------------------------------
+
+static inline int   ImGui_ImplSoftraster_Min(int a, int b)                      { return (a < b) ? a : b; }
+static inline int   ImGui_ImplSoftraster_Max(int a, int b)                      { return (a > b) ? a : b; }
+static inline float ImGui_ImplSoftraster_Min(float a, float b)                  { return (a < b) ? a : b; }
+static inline float ImGui_ImplSoftraster_Max(float a, float b)                  { return (a > b) ? a : b; }
+static inline int   ImGui_ImplSoftraster_ClampI(int v, int mn, int mx)          { return (v < mn) ? mn : (v > mx) ? mx : v; }
+static inline float ImGui_ImplSoftraster_ClampF(float v, float mn, float mx)    { return (v < mn) ? mn : (v > mx) ? mx : v; }
+static inline int   ImGui_ImplSoftraster_SnapToSubpixel(float v)                { return (int)floorf(v * (float)(1 << IMGUI_IMPL_SOFTRASTER_SUBPIXEL_SHIFT) + 0.5f); }
+static inline int   ImGui_ImplSoftraster_DivFloor(int a, int b)                 { return (a >= 0) ? a / b : -((-a + b - 1) / b); } // b > 0
+
+static inline ImU32* ImGui_ImplSoftraster_GetRow(ImGui_ImplSoftraster_Data* bd, int y)
+{
+    return (ImU32*)(void*)((unsigned char*)bd->Pixels + (size_t)y * (size_t)bd->Pitch);
+}
+
+static inline ImGui_ImplSoftraster_Color ImGui_ImplSoftraster_UnpackColor(ImU32 col)
+{
+    ImGui_ImplSoftraster_Color c = { (float)((col >> IM_COL32_R_SHIFT) & 0xFF), (float)((col >> IM_COL32_G_SHIFT) & 0xFF), (float)((col >> IM_COL32_B_SHIFT) & 0xFF), (float)((col >> IM_COL32_A_SHIFT) & 0xFF) };
+    return c;
+}
+
+static inline ImGui_ImplSoftraster_Color ImGui_ImplSoftraster_ModulateColor(const ImGui_ImplSoftraster_Color& a, const ImGui_ImplSoftraster_Color& b)
+{
+    ImGui_ImplSoftraster_Color c = { a.R * b.R * (1.0f / 255.0f), a.G * b.G * (1.0f / 255.0f), a.B * b.B * (1.0f / 255.0f), a.A * b.A * (1.0f / 255.0f) };
+    return c;
+}
+
+static inline ImGui_ImplSoftraster_Color ImGui_ImplSoftraster_SampleTexel(const ImGui_ImplSoftraster_Texture* tex, float u, float v)
+{
+    if (tex == nullptr)
+    {
+        ImGui_ImplSoftraster_Color white = { 255.0f, 255.0f, 255.0f, 255.0f };
+        return white;
+    }
+    const int x = (int)ImGui_ImplSoftraster_ClampF(u * (float)tex->Width, 0.0f, (float)(tex->Width - 1));
+    const int y = (int)ImGui_ImplSoftraster_ClampF(v * (float)tex->Height, 0.0f, (float)(tex->Height - 1));
+    if (tex->BytesPerPixel == 1)
+    {
+        ImGui_ImplSoftraster_Color c = { 255.0f, 255.0f, 255.0f, (float)((const unsigned char*)tex->Pixels)[y * tex->Width + x] };
+        return c;
+    }
+    return ImGui_ImplSoftraster_UnpackColor(((const ImU32*)tex->Pixels)[y * tex->Width + x]);
+}
+
+// Sample 4 texels with nearest filtering, from texel coordinates (already clamped)
+static inline void ImGui_ImplSoftraster_SampleTexels4(const ImGui_ImplSoftraster_Texture* tex, ImSoftI4 tx, ImSoftI4 ty, ImSoftF4* r, ImSoftF4* g, ImSoftF4* b, ImSoftF4* a)
+{
+    int xs[4], ys[4];
+    ImSoftI4_StoreInts(xs, tx);
+    ImSoftI4_StoreInts(ys, ty);
+    const int w = tex->Width;
+    if (tex->BytesPerPixel == 1)
+    {
+        const unsigned char* p = (const unsigned char*)tex->Pixels;
+        *r = *g = *b = ImSoftF4_Set1(255.0f);
+        *a = ImSoftF4_FromI4(ImSoftI4_Set(p[ys[0] * w + xs[0]], p[ys[1] * w + xs[1]], p[ys[2] * w + xs[2]], p[ys[3] * w + xs[3]]));
+        return;
+    }
+    const ImU32* p = (const ImU32*)tex->Pixels;
+    ImSoftI4 texels = ImSoftI4_Set((int)p[ys[0] * w + xs[0]], (int)p[ys[1] * w + xs[1]], (int)p[ys[2] * w + xs[2]], (int)p[ys[3] * w + xs[3]]);
+    *r = ImSoftI4_UnpackChannel(texels, IM_COL32_R_SHIFT);
+    *g = ImSoftI4_UnpackChannel(texels, IM_COL32_G_SHIFT);
+    *b = ImSoftI4_UnpackChannel(texels, IM_COL32_B_SHIFT);
+    *a = ImSoftI4_UnpackChannel(texels, IM_COL32_A_SHIFT);
+}
+
+// Sample 4 texels with bilinear filtering and clamping to edges, same as GL_LINEAR + GL_CLAMP_TO_EDGE sampling used by other backends
+static inline void ImGui_ImplSoftraster_SampleBilinear4(const ImGui_ImplSoftraster_Texture* tex, ImSoftF4 u, ImSoftF4 v, ImSoftF4* r, ImSoftF4* g, ImSoftF4* b, ImSoftF4* a)
+{
+    const ImSoftF4 one = ImSoftF4_Set1(1.0f), zero = ImSoftF4_Set1(0.0f);
+    const ImSoftF4 max_x = ImSoftF4_Set1((float)(tex->Width - 1)), max_y = ImSoftF4_Set1((float)(tex->Height - 1));
+    const ImSoftF4 x = ImSoftF4_Min(ImSoftF4_Max(ImSoftF4_Sub(ImSoftF4_Mul(u, ImSoftF4_Set1((float)tex->Width)), ImSoftF4_Set1(0.5f)), ImSoftF4_Set1(-1.0f)), ImSoftF4_Set1((float)tex->Width));
+    const ImSoftF4 y = ImSoftF4_Min(ImSoftF4_Max(ImSoftF4_Sub(ImSoftF4_Mul(v, ImSoftF4_Set1((float)tex->Height)), ImSoftF4_Set1(0.5f)), ImSoftF4_Set1(-1.0f)), ImSoftF4_Set1((float)tex->Height));
+    const ImSoftF4 x_floor = ImSoftF4_Sub(ImSoftF4_FromI4(ImSoftI4_FromF4Trunc(ImSoftF4_Add(x, one))), one); // x >= -1.0f
+    const ImSoftF4 y_floor = ImSoftF4_Sub(ImSoftF4_FromI4(ImSoftI4_FromF4Trunc(ImSoftF4_Add(y, one))), one);
+    const ImSoftF4 fx = ImSoftF4_Sub(x, x_floor), fy = ImSoftF4_Sub(y, y_floor);
+    const ImSoftI4 x0 = ImSoftI4_FromF4Trunc(ImSoftF4_Min(ImSoftF4_Max(x_floor, zero), max_x));
+    const ImSoftI4 x1 = ImSoftI4_FromF4Trunc(ImSoftF4_Min(ImSoftF4_Max(ImSoftF4_Add(x_floor, one), zero), max_x));
+    const ImSoftI4 y0 = ImSoftI4_FromF4Trunc(ImSoftF4_Min(ImSoftF4_Max(y_floor, zero), max_y));
+    const ImSoftI4 y1 = ImSoftI4_FromF4Trunc(ImSoftF4_Min(ImSoftF4_Max(ImSoftF4_Add(y_floor, one), zero), max_y));
+    ImSoftF4 c00[4], c10[4], c01[4], c11[4];
+    ImGui_ImplSoftraster_SampleTexels4(tex, x0, y0, &c00[0], &c00[1], &c00[2], &c00[3]);
+    ImGui_ImplSoftraster_SampleTexels4(tex, x1, y0, &c10[0], &c10[1], &c10[2], &c10[3]);
+    ImGui_ImplSoftraster_SampleTexels4(tex, x0, y1, &c01[0], &c01[1], &c01[2], &c01[3]);
+    ImGui_ImplSoftraster_SampleTexels4(tex, x1, y1, &c11[0], &c11[1], &c11[2], &c11[3]);
+    ImSoftF4* out[4] = { r, g, b, a };
+    for (int n = 0; n < 4; n++)
+    {
+        const ImSoftF4 top = ImSoftF4_Add(c00[n], ImSoftF4_Mul(ImSoftF4_Sub(c10[n], c00[n]), fx));
+        const ImSoftF4 bottom = ImSoftF4_Add(c01[n], ImSoftF4_Mul(ImSoftF4_Sub(c11[n], c01[n]), fx));
+        *out[n] = ImSoftF4_Add(top, ImSoftF4_Mul(ImSoftF4_Sub(bottom, top), fy));
+    }
+}
+
+// Convert UV to clamped texel coordinates
+static inline ImSoftI4 ImGui_ImplSoftraster_TexelCoords4(ImSoftF4 uv, int size)
+{
+    return ImSoftI4_FromF4Trunc(ImSoftF4_Min(ImSoftF4_Max(ImSoftF4_Mul(uv, ImSoftF4_Set1((float)size)), ImSoftF4_Set1(0.0f)), ImSoftF4_Set1((float)(size - 1))));
+}
+
+// Mask of lanes which x coordinate (x4 + lane index) is within [x0, x1)
+static inline ImSoftI4 ImGui_ImplSoftraster_RangeMask4(int x4, int x0, int x1)
+{
+    ImSoftI4 xs = ImSoftI4_Add(ImSoftI4_Set1(x4), ImSoftI4_Set(0, 1, 2, 3));
+    return ImSoftI4_AndNot(ImSoftI4_CmpLt(xs, ImSoftI4_Set1(x0)), ImSoftI4_CmpLt(xs, ImSoftI4_Set1(x1)));
+}
+
+// Blend 4 source pixels with 0..255 channels over row[x4] to row[x4 + 3], for lanes set in 'mask'.
+// Same as glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA) used by other backends.
+static inline void ImGui_ImplSoftraster_BlendPixels4(ImU32* row, int x4, int width, ImSoftI4 mask, ImSoftF4 r, ImSoftF4 g, ImSoftF4 b, ImSoftF4 a)
+{
+    ImU32 tmp[4];
+    ImU32* dst = row + x4;
+    const bool partial = (x4 + 4 > width);
+    if (partial)
+    {
+        for (int n = 0; n < 4; n++)
+            tmp[n] = (x4 + n < width) ? row[x4 + n] : 0;
+        dst = tmp;
+    }
+    ImSoftI4 d = ImSoftI4_Load(dst);
+    ImSoftF4 sa = ImSoftF4_Mul(a, ImSoftF4_Set1(1.0f / 255.0f));
+    ImSoftF4 inv_sa = ImSoftF4_Sub(ImSoftF4_Set1(1.0f), sa);
+    ImSoftF4 out_r = ImSoftF4_Add(ImSoftF4_Mul(r, sa), ImSoftF4_Mul(ImSoftI4_UnpackChannel(d, IM_COL32_R_SHIFT), inv_sa));
+    ImSoftF4 out_g = ImSoftF4_Add(ImSoftF4_Mul(g, sa), ImSoftF4_Mul(ImSoftI4_UnpackChannel(d, IM_COL32_G_SHIFT), inv_sa));
+    ImSoftF4 out_b = ImSoftF4_Add(ImSoftF4_Mul(b, sa), ImSoftF4_Mul(ImSoftI4_UnpackChannel(d, IM_COL32_B_SHIFT), inv_sa));
+    ImSoftF4 out_a = ImSoftF4_Add(a, ImSoftF4_Mul(ImSoftI4_UnpackChannel(d, IM_COL32_A_SHIFT), inv_sa));
+    ImSoftI4 out = ImSoftI4_Or(ImSoftI4_Or(ImSoftI4_PackChannel(out_r, IM_COL32_R_SHIFT), ImSoftI4_PackChannel(out_g, IM_COL32_G_SHIFT)), ImSoftI4_Or(ImSoftI4_PackChannel(out_b, IM_COL32_B_SHIFT), ImSoftI4_PackChannel(out_a, IM_COL32_A_SHIFT)));
+    ImSoftI4_Store(dst, ImSoftI4_Select(mask, out, d));
+    if (partial)
+        for (int n = 0; x4 + n < width && n < 4; n++)
+            row[x4 + n] = tmp[n];
+}
+
+// Blend a constant color over row[x0] to row[x1 - 1]
+static void ImGui_ImplSoftraster_FillSpan(ImU32* row, int x0, int x1, const ImGui_ImplSoftraster_Color& src)
+{
+    if (src.A <= 0.0f || x0 >= x1)
+        return;
+    if (src.A >= 255.0f)
+    {
+        const ImU32 col = IM_COL32((int)(src.R + 0.5f), (int)(src.G + 0.5f), (int)(src.B + 0.5f), 255);
+        for (int x = x0; x < x1; x++)
+            row[x] = col;
+        return;
+    }
+
+    // Translucent: blend with 8-bit integer weights, out = (src * src.a + dst * (255 - src.a)) / 255 per channel.
+    // Alpha channel is src.a + dst.a * (255 - src.a) / 255, which is the same with a premultiplied value of 255 * src.a.
+    const unsigned int a = (unsigned int)(src.A + 0.5f), inv_a = 255 - a;
+    unsigned int premul[4];
+    premul[IM_COL32_R_SHIFT / 8] = (unsigned int)(src.R * (float)a + 0.5f) + 128; // + 128 for rounding
+    premul[IM_COL32_G_SHIFT / 8] = (unsigned int)(src.G * (float)a + 0.5f) + 128;
+    premul[IM_COL32_B_SHIFT / 8] = (unsigned int)(src.B * (float)a + 0.5f) + 128;
+    premul[IM_COL32_A_SHIFT / 8] = 255 * a + 128;
+    int x = x0;
+#ifdef IMGUI_IMPL_SOFTRASTER_USE_SSE2
+    const __m128i v_premul = _mm_setr_epi16((short)premul[0], (short)premul[1], (short)premul[2], (short)premul[3], (short)premul[0], (short)premul[1], (short)premul[2], (short)premul[3]);
+    const __m128i v_inv_a = _mm_set1_epi16((short)inv_a);
+    const __m128i zero = _mm_setzero_si128();
+    for (; x + 4 <= x1; x += 4)
+    {
+        __m128i d = _mm_loadu_si128((const __m128i*)(const void*)(row + x));
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), v_inv_a), v_premul); // <= 65153, fits in 16-bit unsigned
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), v_inv_a), v_premul);
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8); // Divide by 255
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+        _mm_storeu_si128((__m128i*)(void*)(row + x), _mm_packus_epi16(lo, hi));
+    }
+#endif
+    for (; x < x1; x++)
+    {
+        const ImU32 d = row[x];
+        ImU32 out = 0;
+        for (int c = 0; c < 4; c++)
+        {
+            const unsigned int v = ((d >> (c * 8)) & 0xFF) * inv_a + premul[c];
+            out |= ((v + (v >> 8)) >> 8) << (c * 8);
+        }
+        row[x] = out;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Rasterization
+//-----------------------------------------------------------------------------
+
+// Rasterize a triangle within [x0,x1)x[y0,y1), which is a subset of a single tile.
+static void ImGui_ImplSoftraster_RasterTriangle(ImGui_ImplSoftraster_Data* bd, const ImGui_ImplSoftraster_Prim& prim, int x0, int y0, int x1, int y1)
+{
+    // Snap vertices, and order them so the triangle is counter-clockwise (positive area with our edge functions)
+    int vi[3] = { 0, 1, 2 };
+    int64_t fx[3], fy[3];
+    for (int n = 0; n < 3; n++)
+    {
+        fx[n] = ImGui_ImplSoftraster_SnapToSubpixel(prim.Pos[n].x);
+        fy[n] = ImGui_ImplSoftraster_SnapToSubpixel(prim.Pos[n].y);
+    }
+    const int64_t area = (fx[1] - fx[0]) * (fy[2] - fy[0]) - (fy[1] - fy[0]) * (fx[2] - fx[0]);
+    if (area == 0)
+        return;
+    if (area < 0)
+    {
+        int64_t t;
+        t = fx[1]; fx[1] = fx[2]; fx[2] = t;
+        t = fy[1]; fy[1] = fy[2]; fy[2] = t;
+        vi[1] = 2; vi[2] = 1;
+    }
+
+    // Edge functions: E(P) = A * P.x + B * P.y + C >= 0 inside the triangle, for P in subpixel units.
+    // Top-left fill rule: pixels exactly on a right or bottom edge are excluded, which we do by biasing C.
+    // Reject the area when fully outside of an edge, and skip testing edges which the area is fully inside of.
+    const int sub = 1 << IMGUI_IMPL_SOFTRASTER_SUBPIXEL_SHIFT;
+    const int64_t px_min = (int64_t)x0 * sub + sub / 2, px_max = (int64_t)(x1 - 1) * sub + sub / 2;
+    const int64_t py_min = (int64_t)y0 * sub + sub / 2, py_max = (int64_t)(y1 - 1) * sub + sub / 2;
+    int64_t edge_a[3], edge_b[3], edge_c[3];
+    int edges_count = 0;
+    for (int n = 0; n < 3; n++)
+    {
+        const int n1 = (n + 1) % 3;
+        const int64_t a = fy[n] - fy[n1];
+        const int64_t b = fx[n1] - fx[n];
+        const bool top_left = (a > 0) || (a == 0 && b > 0);
+        const int64_t c = -a * fx[n] - b * fy[n] - (top_left ? 0 : 1);
+        const int64_t e_max = a * ((a > 0) ? px_max : px_min) + b * ((b > 0) ? py_max : py_min) + c;
+        const int64_t e_min = a * ((a > 0) ? px_min : px_max) + b * ((b > 0) ? py_min : py_max) + c;
+        if (e_max < 0)
+            return;
+        if (e_min >= 0)
+            continue;
+        edge_a[edges_count] = a;
+        edge_b[edges_count] = b;
+        edge_c[edges_count] = c;
+        edges_count++;
+    }
+
+    // Setup attributes: texel color when UV are constant, and linear planes for varying attributes
+    const ImVec2 p0((float)fx[0] / sub, (float)fy[0] / sub);
+    const float dx1 = (float)(fx[1] - fx[0]) / sub, dy1 = (float)(fy[1] - fy[0]) / sub;
+    const float dx2 = (float)(fx[2] - fx[0]) / sub, dy2 = (float)(fy[2] - fy[0]) / sub;
+    const float inv_det = 1.0f / (dx1 * dy2 - dx2 * dy1);
+    const ImU32 c0 = prim.Col[vi[0]], c1 = prim.Col[vi[1]], c2 = prim.Col[vi[2]];
+    const ImVec2 uv0 = prim.Uv[vi[0]], uv1 = prim.Uv[vi[1]], uv2 = prim.Uv[vi[2]];
+    const bool const_col = (c0 == c1 && c0 == c2);
+    const bool const_uv = (prim.Texture == nullptr) || (uv0.x == uv1.x && uv0.x == uv2.x && uv0.y == uv1.y && uv0.y == uv2.y);
+    const ImGui_ImplSoftraster_Color texel = ImGui_ImplSoftraster_SampleTexel(prim.Texture, uv0.x, uv0.y);
+    const ImGui_ImplSoftraster_Color col0 = ImGui_ImplSoftraster_UnpackColor(c0);
+    if (const_col && const_uv && edges_count == 0)
+    {
+        // Area fully inside the triangle with a constant color
+        const ImGui_ImplSoftraster_Color src = ImGui_ImplSoftraster_ModulateColor(col0, texel);
+        for (int y = y0; y < y1; y++)
+            ImGui_ImplSoftraster_FillSpan(ImGui_ImplSoftraster_GetRow(bd, y), x0, x1, src);
+        return;
+    }
+
+    // Attribute planes: value(P) = value0 + ddx * (P.x - p0.x) + ddy * (P.y - p0.y)
+    // Order: R, G, B, A, U, V
+    float plane_v0[6], plane_ddx[6], plane_ddy[6];
+    {
+        const ImGui_ImplSoftraster_Color col1 = ImGui_ImplSoftraster_UnpackColor(c1), col2 = ImGui_ImplSoftraster_UnpackColor(c2);
+        const float v0[6] = { col0.R, col0.G, col0.B, col0.A, uv0.x, uv0.y };
+        const float v1[6] = { col1.R, col1.G, col1.B, col1.A, uv1.x, uv1.y };
+        const float v2[6] = { col2.R, col2.G, col2.B, col2.A, uv2.x, uv2.y };
+        for (int n = 0; n < 6; n++)
+        {
+            const float d1 = v1[n] - v0[n], d2 = v2[n] - v0[n];
+            plane_v0[n] = v0[n];
+            plane_ddx[n] = (d1 * dy2 - d2 * dy1) * inv_det;
+            plane_ddy[n] = (d2 * dx1 - d1 * dx2) * inv_det;
+        }
+    }
+    const ImSoftF4 lane_offsets = ImSoftF4_Add(ImSoftF4_FromI4(ImSoftI4_Set(0, 1, 2, 3)), ImSoftF4_Set1(0.5f - p0.x));
+    ImSoftF4 tex_r = ImSoftF4_Set1(texel.R), tex_g = ImSoftF4_Set1(texel.G), tex_b = ImSoftF4_Set1(texel.B), tex_a = ImSoftF4_Set1(texel.A);
+    ImSoftF4 col_r = ImSoftF4_Set1(col0.R), col_g = ImSoftF4_Set1(col0.G), col_b = ImSoftF4_Set1(col0.B), col_a = ImSoftF4_Set1(col0.A);
+
+    // Per 4 pixels edge steps. Fit in 32-bit because of IMGUI_IMPL_SOFTRASTER_MAX_COORD.
+    ImSoftI4 edge_lane_steps[3];
+    float edge_inv_a[3];
+    for (int e = 0; e < edges_count; e++)
+    {
+        const int a16 = (int)(edge_a[e] * sub);
+        edge_lane_steps[e] = ImSoftI4_Set(0, a16, a16 * 2, a16 * 3);
+        edge_inv_a[e] = (a16 != 0) ? 1.0f / (float)a16 : 0.0f;
+    }
+
+    const int64_t edge_clamp = (int64_t)1 << 30;
+    for (int y = y0; y < y1; y++)
+    {
+        // Compute span of pixels inside all edges for this row.
+        // This is conservative (+/- 2 pixels), the exact test is done for each pixel.
+        const int64_t py = (int64_t)y * sub + sub / 2;
+        int span_x0 = x0, span_x1 = x1;
+        int64_t edge_row[3];
+        for (int e = 0; e < edges_count; e++)
+        {
+            // E(x) = a * (x * sub + sub / 2) + edge_row, crossing zero at x = -edge_row / (a * sub) - 0.5
+            const int64_t a = edge_a[e];
+            edge_row[e] = edge_b[e] * py + edge_c[e];
+            const float x_cross = ImGui_ImplSoftraster_ClampF(-(float)edge_row[e] * edge_inv_a[e] - 0.5f, (float)x0 - 4.0f, (float)x1 + 4.0f);
+            if (a > 0)
+                span_x0 = ImGui_ImplSoftraster_Max(span_x0, (int)(x_cross + 8.0f) - 8 - 1);
+            else if (a < 0)
+                span_x1 = ImGui_ImplSoftraster_Min(span_x1, (int)(x_cross + 8.0f) - 8 + 2);
+            else if (edge_row[e] < 0)
+                span_x1 = span_x0;
+        }
+        if (span_x0 >= span_x1)
+            continue;
+
+        ImU32* row = ImGui_ImplSoftraster_GetRow(bd, y);
+        const float fy_rel = (float)y + 0.5f - p0.y;
+        const int x4_start = span_x0 & ~3;
+        int64_t edge_group[3];
+        for (int e = 0; e < edges_count; e++)
+            edge_group[e] = edge_a[e] * ((int64_t)x4_start * sub + sub / 2) + edge_row[e];
+        for (int x4 = x4_start; x4 < span_x1; x4 += 4)
+        {
+            ImSoftI4 mask = ImGui_ImplSoftraster_RangeMask4(x4, span_x0, span_x1);
+            ImSoftI4 outside = ImSoftI4_Set1(0);
+            for (int e = 0; e < edges_count; e++)
+            {
+                const int64_t eg = edge_group[e];
+                const int base = (int)((eg > edge_clamp) ? edge_clamp : (eg < -edge_clamp) ? -edge_clamp : eg);
+                outside = ImSoftI4_Or(outside, ImSoftI4_Add(ImSoftI4_Set1(base), edge_lane_steps[e]));
+                edge_group[e] += edge_a[e] * sub * 4;
+            }
+            mask = ImSoftI4_AndNot(ImSoftI4_SignMask(outside), mask);
+            if (!ImSoftI4_Any(mask))
+                continue;
+
+            const ImSoftF4 fx_rel = ImSoftF4_Add(ImSoftF4_Set1((float)x4), lane_offsets);
+#define IM_SOFT_PLANE(_N)   ImSoftF4_Add(ImSoftF4_Set1(plane_v0[_N] + plane_ddy[_N] * fy_rel), ImSoftF4_Mul(ImSoftF4_Set1(plane_ddx[_N]), fx_rel))
+            if (!const_col)
+            {
+                col_r = IM_SOFT_PLANE(0);
+                col_g = IM_SOFT_PLANE(1);
+                col_b = IM_SOFT_PLANE(2);
+                col_a = IM_SOFT_PLANE(3);
+            }
+            if (!const_uv)
+                ImGui_ImplSoftraster_SampleBilinear4(prim.Texture, IM_SOFT_PLANE(4), IM_SOFT_PLANE(5), &tex_r, &tex_g, &tex_b, &tex_a);
+#undef IM_SOFT_PLANE
+            const ImSoftF4 k = ImSoftF4_Set1(1.0f / 255.0f);
+            ImSoftF4 r = ImSoftF4_Mul(ImSoftF4_Mul(col_r, tex_r), k);
+            ImSoftF4 g = ImSoftF4_Mul(ImSoftF4_Mul(col_g, tex_g), k);
+            ImSoftF4 b = ImSoftF4_Mul(ImSoftF4_Mul(col_b, tex_b), k);
+            ImSoftF4 a = ImSoftF4_Mul(ImSoftF4_Mul(col_a, tex_a), k);
+            ImGui_ImplSoftraster_BlendPixels4(row, x4, bd->Width, mask, r, g, b, a);
+        }
+    }
+}
+
+// Rasterize an axis-aligned quad within [x0,x1)x[y0,y1). Its bounds are already exactly the covered pixels.
+static void ImGui_ImplSoftraster_RasterQuad(ImGui_ImplSoftraster_Data* bd, const ImGui_ImplSoftraster_Prim& prim, int x0, int y0, int x1, int y1)
+{
+    const ImGui_ImplSoftraster_Texture* tex = prim.Texture;
+    const ImGui_ImplSoftraster_Color col = ImGui_ImplSoftraster_UnpackColor(prim.Col[0]);
+    const ImVec2 p_min = prim.Pos[0], p_max = prim.Pos[1];
+    const ImVec2 uv_min = prim.Uv[0], uv_max = prim.Uv[1];
+    if (tex == nullptr || (uv_min.x == uv_max.x && uv_min.y == uv_max.y))
+    {
+        // Solid color
+        const ImGui_ImplSoftraster_Color src = ImGui_ImplSoftraster_ModulateColor(col, ImGui_ImplSoftraster_SampleTexel(tex, uv_min.x, uv_min.y));
+        for (int y = y0; y < y1; y++)
+            ImGui_ImplSoftraster_FillSpan(ImGui_ImplSoftraster_GetRow(bd, y), x0, x1, src);
+        return;
+    }
+
+    // Textured (e.g. glyphs): UV are linear along each axis.
+    // When texels map 1:1 to pixels, which is the case of text unless scaled, bilinear filtering samples texel centers: use nearest filtering.
+    const float du = (uv_max.x - uv_min.x) / (p_max.x - p_min.x);
+    const float dv = (uv_max.y - uv_min.y) / (p_max.y - p_min.y);
+    const float texel_x = (uv_min.x + ((float)x0 + 0.5f - p_min.x) * du) * (float)tex->Width;
+    const float texel_y = (uv_min.y + ((float)y0 + 0.5f - p_min.y) * dv) * (float)tex->Height;
+    const bool nearest = fabsf(du * (float)tex->Width - 1.0f) < 1e-4f && fabsf(dv * (float)tex->Height - 1.0f) < 1e-4f &&
+        fabsf(texel_x - floorf(texel_x) - 0.5f) < 1e-3f && fabsf(texel_y - floorf(texel_y) - 0.5f) < 1e-3f;
+    const ImSoftF4 lane_u = ImSoftF4_Mul(ImSoftF4_Add(ImSoftF4_FromI4(ImSoftI4_Set(0, 1, 2, 3)), ImSoftF4_Set1(0.5f - p_min.x)), ImSoftF4_Set1(du));
+    const ImSoftF4 k = ImSoftF4_Set1(1.0f / 255.0f);
+    const ImSoftF4 col_r = ImSoftF4_Set1(col.R), col_g = ImSoftF4_Set1(col.G), col_b = ImSoftF4_Set1(col.B), col_a = ImSoftF4_Set1(col.A);
+    for (int y = y0; y < y1; y++)
+    {
+        ImU32* row = ImGui_ImplSoftraster_GetRow(bd, y);
+        const float v = uv_min.y + ((float)y + 0.5f - p_min.y) * dv;
+        const int ty = (int)ImGui_ImplSoftraster_ClampF(v * (float)tex->Height, 0.0f, (float)(tex->Height - 1));
+        const ImSoftI4 ty4 = ImSoftI4_Set1(ty);
+        for (int x4 = x0 & ~3; x4 < x1; x4 += 4)
+        {
+            ImSoftF4 u = ImSoftF4_Add(ImSoftF4_Set1(uv_min.x + (float)x4 * du), lane_u);
+            ImSoftF4 tex_r, tex_g, tex_b, tex_a;
+            if (nearest)
+                ImGui_ImplSoftraster_SampleTexels4(tex, ImGui_ImplSoftraster_TexelCoords4(u, tex->Width), ty4, &tex_r, &tex_g, &tex_b, &tex_a);
+            else
+                ImGui_ImplSoftraster_SampleBilinear4(tex, u, ImSoftF4_Set1(v), &tex_r, &tex_g, &tex_b, &tex_a);
+            ImSoftI4 mask = ImSoftI4_AndNot(ImSoftF4_CmpLt(tex_a, ImSoftF4_Set1(0.5f)), ImGui_ImplSoftraster_RangeMask4(x4, x0, x1)); // Skip transparent texels (glyph background)
+            if (!ImSoftI4_Any(mask))
+                continue;
+            ImSoftF4 r = ImSoftF4_Mul(ImSoftF4_Mul(col_r, tex_r), k);
+            ImSoftF4 g = ImSoftF4_Mul(ImSoftF4_Mul(col_g, tex_g), k);
+            ImSoftF4 b = ImSoftF4_Mul(ImSoftF4_Mul(col_b, tex_b), k);
+            ImSoftF4 a = ImSoftF4_Mul(ImSoftF4_Mul(col_a, tex_a), k);
+            ImGui_ImplSoftraster_BlendPixels4(row, x4, bd->Width, mask, r, g, b, a);
+        }
+    }
+}
+
+// Rasterize a rectangle instance within [x0,x1)x[y0,y1). Coverage is computed from the signed distance, as in imgui_impl_opengl3.cpp.
+static void ImGui_ImplSoftraster_RasterRect(ImGui_ImplSoftraster_Data* bd, const ImGui_ImplSoftraster_Prim& prim, int x0, int y0, int x1, int y1)
+{
+    const ImGui_ImplSoftraster_Color col = ImGui_ImplSoftraster_UnpackColor(prim.Col[0]);
+    const ImU32 flags = prim.Col[1];
+    const float rounding = prim.Uv[0].x, thickness = prim.Uv[0].y;
+    const float cx = (prim.Pos[0].x + prim.Pos[1].x) * 0.5f, cy = (prim.Pos[0].y + prim.Pos[1].y) * 0.5f;
+    const float hx = (prim.Pos[1].x - prim.Pos[0].x) * 0.5f, hy = (prim.Pos[1].y - prim.Pos[0].y) * 0.5f;
+    const bool anti_aliased = (flags & (1 << 4)) != 0;
+
+    // Inner box where coverage is known: fully opaque for filled rectangles, fully transparent for stroked rectangles.
+    const float inner_margin = rounding + ((thickness > 0.0f) ? thickness * 0.5f : 0.0f) + 0.5f;
+    const float inner_hx = hx - inner_margin, inner_hy = hy - inner_margin;
+
+    const ImSoftF4 radius_tl = ImSoftF4_Set1((flags & 1) ? rounding : 0.0f), radius_tr = ImSoftF4_Set1((flags & 2) ? rounding : 0.0f);
+    const ImSoftF4 radius_bl = ImSoftF4_Set1((flags & 4) ? rounding : 0.0f), radius_br = ImSoftF4_Set1((flags & 8) ? rounding : 0.0f);
+    const ImSoftF4 half_x = ImSoftF4_Set1(hx), half_y = ImSoftF4_Set1(hy);
+    const ImSoftF4 half_thickness = ImSoftF4_Set1(thickness * 0.5f);
+    const ImSoftF4 zero = ImSoftF4_Set1(0.0f), one = ImSoftF4_Set1(1.0f), half = ImSoftF4_Set1(0.5f);
+    const ImSoftF4 lane_x = ImSoftF4_Add(ImSoftF4_FromI4(ImSoftI4_Set(0, 1, 2, 3)), ImSoftF4_Set1(0.5f - cx));
+    const ImSoftF4 col_r = ImSoftF4_Set1(col.R), col_g = ImSoftF4_Set1(col.G), col_b = ImSoftF4_Set1(col.B), col_a = ImSoftF4_Set1(col.A);
+    for (int y = y0; y < y1; y++)
+    {
+        ImU32* row = ImGui_ImplSoftraster_GetRow(bd, y);
+        const float py = (float)y + 0.5f - cy;
+        int inner_x0 = x1, inner_x1 = x1; // Pixels range within inner box
+        if (inner_hx > 0.0f && inner_hy > 0.0f && fabsf(py) <= inner_hy)
+        {
+            inner_x0 = ImGui_ImplSoftraster_Max(x0, (int)ceilf(cx - inner_hx - 0.5f));
+            inner_x1 = ImGui_ImplSoftraster_Min(x1, (int)floorf(cx + inner_hx - 0.5f) + 1);
+            if (inner_x0 >= inner_x1)
+                inner_x0 = inner_x1 = x1;
+        }
+        if (thickness <= 0.0f)
+            ImGui_ImplSoftraster_FillSpan(row, inner_x0, inner_x1, col);
+
+        const ImSoftF4 py4 = ImSoftF4_Set1(py);
+        const ImSoftF4 ay = ImSoftF4_Abs(py4);
+        const ImSoftI4 top = ImSoftF4_CmpLt(py4, zero);
+        const ImSoftF4 radius_l = ImSoftF4_Select(top, radius_tl, radius_bl), radius_r = ImSoftF4_Select(top, radius_tr, radius_br);
+        for (int x4 = x0 & ~3; x4 < x1; x4 += 4)
+        {
+            // Lanes left of the inner span, then lanes right of it
+            ImSoftI4 mask = ImSoftI4_Or(ImGui_ImplSoftraster_RangeMask4(x4, x0, inner_x0), ImGui_ImplSoftraster_RangeMask4(x4, inner_x1, x1));
+            if (!ImSoftI4_Any(mask))
+            {
+                x4 = ImGui_ImplSoftraster_Max(x4, ((inner_x1 & ~3) - 4)); // Skip to end of inner span
+                continue;
+            }
+            const ImSoftF4 px4 = ImSoftF4_Add(ImSoftF4_Set1((float)x4), lane_x);
+            const ImSoftF4 radius = ImSoftF4_Select(ImSoftF4_CmpLt(px4, zero), radius_l, radius_r);
+            const ImSoftF4 qx = ImSoftF4_Add(ImSoftF4_Sub(ImSoftF4_Abs(px4), half_x), radius);
+            const ImSoftF4 qy = ImSoftF4_Add(ImSoftF4_Sub(ay, half_y), radius);
+            const ImSoftF4 q_max = ImSoftF4_Max(qx, qy);
+            const ImSoftF4 ox = ImSoftF4_Max(qx, zero), oy = ImSoftF4_Max(qy, zero);
+            const ImSoftF4 d_round = ImSoftF4_Sub(ImSoftF4_Add(ImSoftF4_Sqrt(ImSoftF4_Add(ImSoftF4_Mul(ox, ox), ImSoftF4_Mul(oy, oy))), ImSoftF4_Min(q_max, zero)), radius);
+            ImSoftF4 d = ImSoftF4_Select(ImSoftF4_CmpLt(zero, radius), d_round, q_max);
+            if (thickness > 0.0f)
+                d = ImSoftF4_Sub(ImSoftF4_Abs(d), half_thickness);
+            ImSoftF4 coverage;
+            if (anti_aliased)
+                coverage = ImSoftF4_Min(ImSoftF4_Max(ImSoftF4_Sub(half, d), zero), one);
+            else
+                coverage = ImSoftF4_Select(ImSoftF4_CmpLt(d, zero), one, zero);
+            mask = ImSoftI4_And(mask, ImSoftF4_CmpLt(zero, coverage));
+            if (!ImSoftI4_Any(mask))
+                continue;
+            ImGui_ImplSoftraster_BlendPixels4(row, x4, bd->Width, mask, col_r, col_g, col_b, ImSoftF4_Mul(col_a, coverage));
+        }
+    }
+}
+
+// Rasterize tiles until all of them are done. Called from every thread.
+static void ImGui_ImplSoftraster_RasterTiles(ImGui_ImplSoftraster_Data* bd)
+{
+    const int tiles_count = bd->TilesX * bd->TilesY;
+    for (int tile_n = bd->NextTile.fetch_add(1); tile_n < tiles_count; tile_n = bd->NextTile.fetch_add(1))
+    {
+        const int tile_x0 = (tile_n % bd->TilesX) << IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT;
+        const int tile_y0 = (tile_n / bd->TilesX) << IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT;
+        const int tile_x1 = ImGui_ImplSoftraster_Min(tile_x0 + IMGUI_IMPL_SOFTRASTER_TILE_SIZE, bd->Width);
+        const int tile_y1 = ImGui_ImplSoftraster_Min(tile_y0 + IMGUI_IMPL_SOFTRASTER_TILE_SIZE, bd->Height);
+        for (int n = bd->TileStarts[tile_n]; n < bd->TileStarts[tile_n + 1]; n++)
+        {
+            const ImGui_ImplSoftraster_Prim& prim = bd->Prims[bd->TilePrims[n]];
+            const int x0 = ImGui_ImplSoftraster_Max(prim.X0, tile_x0), y0 = ImGui_ImplSoftraster_Max(prim.Y0, tile_y0);
+            const int x1 = ImGui_ImplSoftraster_Min(prim.X1, tile_x1), y1 = ImGui_ImplSoftraster_Min(prim.Y1, tile_y1);
+            if (prim.Type == ImGui_ImplSoftraster_PrimType_Triangle)
+                ImGui_ImplSoftraster_RasterTriangle(bd, prim, x0, y0, x1, y1);
+            else if (prim.Type == ImGui_ImplSoftraster_PrimType_Quad)
+                ImGui_ImplSoftraster_RasterQuad(bd, prim, x0, y0, x1, y1);
+            else
+                ImGui_ImplSoftraster_RasterRect(bd, prim, x0, y0, x1, y1);
+        }
+    }
+}
+
+static void ImGui_ImplSoftraster_WorkerThread(ImGui_ImplSoftraster_Data* bd)
+{
+    int generation = 0;
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(bd->WorkMutex);
+            bd->WorkStartCond.wait(lock, [bd, generation] { return bd->WorkQuit || bd->WorkGeneration != generation; });
+            if (bd->WorkQuit)
+                return;
+            generation = bd->WorkGeneration;
+        }
+        ImGui_ImplSoftraster_RasterTiles(bd);
+        {
+            std::lock_guard<std::mutex> lock(bd->WorkMutex);
+            if (--bd->WorkersBusy == 0)
+                bd->WorkDoneCond.notify_one();
+        }
+    }
+}
+
+// Bin primitives into tiles, rasterize them, then clear the list of primitives
+static void ImGui_ImplSoftraster_Flush(ImGui_ImplSoftraster_Data* bd)
+{
+    if (bd->Prims.Size == 0)
+        return;
+
+    // Count primitives per tile, then fill tiles. Tiles reference primitives in submission order.
+    const int tiles_count = bd->TilesX * bd->TilesY;
+    bd->TileStarts.resize(tiles_count + 1);
+    bd->TileCursors.resize(tiles_count);
+    memset(bd->TileCursors.Data, 0, (size_t)tiles_count * sizeof(int));
+    const int shift = IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT;
+    for (const ImGui_ImplSoftraster_Prim& prim : bd->Prims)
+        for (int ty = prim.Y0 >> shift; ty <= (prim.Y1 - 1) >> shift; ty++)
+            for (int tx = prim.X0 >> shift; tx <= (prim.X1 - 1) >> shift; tx++)
+                bd->TileCursors[ty * bd->TilesX + tx]++;
+    int total = 0;
+    for (int tile_n = 0; tile_n < tiles_count; tile_n++)
+    {
+        bd->TileStarts[tile_n] = total;
+        total += bd->TileCursors[tile_n];
+        bd->TileCursors[tile_n] = bd->TileStarts[tile_n];
+    }
+    bd->TileStarts[tiles_count] = total;
+    bd->TilePrims.resize(total);
+    for (int prim_n = 0; prim_n < bd->Prims.Size; prim_n++)
+    {
+        const ImGui_ImplSoftraster_Prim& prim = bd->Prims[prim_n];
+        for (int ty = prim.Y0 >> shift; ty <= (prim.Y1 - 1) >> shift; ty++)
+            for (int tx = prim.X0 >> shift; tx <= (prim.X1 - 1) >> shift; tx++)
+                bd->TilePrims[bd->TileCursors[ty * bd->TilesX + tx]++] = prim_n;
+    }
+
+    // Rasterize
+    bd->NextTile.store(0);
+    if (bd->Workers.Size > 0 && tiles_count > 1)
+    {
+        {
+            std::lock_guard<std::mutex> lock(bd->WorkMutex);
+            bd->WorkersBusy = bd->Workers.Size;
+            bd->WorkGeneration++;
+        }
+        bd->WorkStartCond.notify_all();
+        ImGui_ImplSoftraster_RasterTiles(bd);
+        std::unique_lock<std::mutex> lock(bd->WorkMutex);
+        bd->WorkDoneCond.wait(lock, [bd] { return bd->WorkersBusy == 0; });
+    }
+    else
+    {
+        ImGui_ImplSoftraster_RasterTiles(bd);
+    }
+    bd->Prims.resize(0);
+}
+
+//-----------------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------------
+
+bool ImGui_ImplSoftraster_Init(int threads_count)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendRendererUserData == nullptr && "Already initialized a renderer backend!");
+
+    // Setup backend capabilities flags
+    ImGui_ImplSoftraster_Data* bd = IM_NEW(ImGui_ImplSoftraster_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_softraster";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;      // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    if (sizeof(ImDrawIdx) == 4)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasPackedIdx;  // We can honor the ImDrawList::IdxSize field, allowing for 16-bit index buffers in small draw lists.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasRectInstances;  // We can honor ImDrawCmd::RectCount, rasterizing rectangles from their signed distance.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasIdxSegments;    // We can read indices from ImDrawList::IdxSegments[].
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates;     // We can honor ImFontAtlas::TexUpdates[], allowing glyphs to be rasterized on demand.
+
+    // Create worker threads
+    if (threads_count <= 0)
+        threads_count = ImGui_ImplSoftraster_Max((int)std::thread::hardware_concurrency(), 1);
+    for (int n = 1; n < threads_count; n++)
+        bd->Workers.push_back(IM_NEW(std::thread)(ImGui_ImplSoftraster_WorkerThread, bd));
+
+    return true;
+}
+
+void ImGui_ImplSoftraster_Shutdown()
+{
+    ImGui_ImplSoftraster_Data* bd = ImGui_ImplSoftraster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    {
+        std::lock_guard<std::mutex> lock(bd->WorkMutex);
+        bd->WorkQuit = true;
+    }
+    bd->WorkStartCond.notify_all();
+    for (std::thread* worker : bd->Workers)
+    {
+        worker->join();
+        IM_DELETE(worker);
+    }
+    ImGui_ImplSoftraster_DestroyFontsTexture();
+
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasPackedIdx | ImGuiBackendFlags_RendererHasRectInstances | ImGuiBackendFlags_RendererHasIdxSegments | ImGuiBackendFlags_RendererHasTexUpdates);
+    IM_DELETE(bd);
+}
+
+void ImGui_ImplSoftraster_NewFrame()
+{
+    ImGui_ImplSoftraster_Data* bd = ImGui_ImplSoftraster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSoftraster_Init()?");
+
+    if (!bd->FontPixels)
+        ImGui_ImplSoftraster_CreateFontsTexture();
+}
+
+static void ImGui_ImplSoftraster_AddTriangles(ImGui_ImplSoftraster_Data* bd, const ImDrawList* cmd_list, const ImDrawCmd* pcmd, const ImGui_ImplSoftraster_Texture* tex, int clip_x0, int clip_y0, int clip_x1, int clip_y1, ImVec2 clip_off, ImVec2 clip_scale)
+{
+    const ImDrawVert* vtx_buffer = cmd_list->VtxBuffer.Data + pcmd->VtxOffset;
+    const int idx_end = (int)(pcmd->IdxOffset + pcmd->ElemCount);
+    const float max_coord = IMGUI_IMPL_SOFTRASTER_MAX_COORD;
+    for (int idx_n = (int)pcmd->IdxOffset; idx_n + 3 <= idx_end; )
+    {
+        unsigned int idx[6];
+        const bool maybe_quad = (idx_n + 6 <= idx_end);
+        for (int n = 0; n < (maybe_quad ? 6 : 3); n++)
+            idx[n] = cmd_list->_GetIdx(idx_n + n);
+
+        ImGui_ImplSoftraster_Prim prim;
+        prim.Texture = tex;
+
+        // Axis-aligned quad, as output by PrimRect() and PrimRectUV(): (a, b, c), (a, c, d) with a=top-left, b=top-right, c=bottom-right, d=bottom-left
+        if (maybe_quad && idx[3] == idx[0] && idx[4] == idx[2])
+        {
+            const ImDrawVert& a = vtx_buffer[idx[0]];
+            const ImDrawVert& b = vtx_buffer[idx[1]];
+            const ImDrawVert& c = vtx_buffer[idx[2]];
+            const ImDrawVert& d = vtx_buffer[idx[5]];
+            const ImVec2 pa = a.pos, pb = b.pos, pc = c.pos, pd = d.pos;
+            const ImVec2 ua = a.uv, ub = b.uv, uc = c.uv, ud = d.uv;
+            if (pa.y == pb.y && pb.x == pc.x && pc.y == pd.y && pd.x == pa.x && pa.x < pc.x && pa.y < pc.y &&
+                ua.y == ub.y && ub.x == uc.x && uc.y == ud.y && ud.x == ua.x &&
+                a.col == b.col && a.col == c.col && a.col == d.col && (a.col & IM_COL32_A_MASK) != 0)
+            {
+                prim.Type = ImGui_ImplSoftraster_PrimType_Quad;
+                prim.Pos[0] = ImVec2(ImGui_ImplSoftraster_ClampF((pa.x - clip_off.x) * clip_scale.x, -max_coord, max_coord), ImGui_ImplSoftraster_ClampF((pa.y - clip_off.y) * clip_scale.y, -max_coord, max_coord));
+                prim.Pos[1] = ImVec2(ImGui_ImplSoftraster_ClampF((pc.x - clip_off.x) * clip_scale.x, -max_coord, max_coord), ImGui_ImplSoftraster_ClampF((pc.y - clip_off.y) * clip_scale.y, -max_coord, max_coord));
+                prim.Uv[0] = ua;
+                prim.Uv[1] = uc;
+                prim.Col[0] = a.col;
+
+                // Pixels which center is within [min, max) in subpixel coordinates, same as two triangles with the top-left rule
+                const int sub = 1 << IMGUI_IMPL_SOFTRASTER_SUBPIXEL_SHIFT;
+                prim.X0 = ImGui_ImplSoftraster_Max(clip_x0, ImGui_ImplSoftraster_DivFloor(ImGui_ImplSoftraster_SnapToSubpixel(prim.Pos[0].x) - sub / 2 + sub - 1, sub));
+                prim.Y0 = ImGui_ImplSoftraster_Max(clip_y0, ImGui_ImplSoftraster_DivFloor(ImGui_ImplSoftraster_SnapToSubpixel(prim.Pos[0].y) - sub / 2 + sub - 1, sub));
+                prim.X1 = ImGui_ImplSoftraster_Min(clip_x1, ImGui_ImplSoftraster_DivFloor(ImGui_ImplSoftraster_SnapToSubpixel(prim.Pos[1].x) - sub / 2 + sub - 1, sub));
+                prim.Y1 = ImGui_ImplSoftraster_Min(clip_y1, ImGui_ImplSoftraster_DivFloor(ImGui_ImplSoftraster_SnapToSubpixel(prim.Pos[1].y) - sub / 2 + sub - 1, sub));
+                if (prim.X0 < prim.X1 && prim.Y0 < prim.Y1)
+                    bd->Prims.push_back(prim);
+                idx_n += 6;
+                continue;
+            }
+        }
+
+        // Triangle
+        prim.Type = ImGui_ImplSoftraster_PrimType_Triangle;
+        ImVec2 p_min(FLT_MAX, FLT_MAX), p_max(-FLT_MAX, -FLT_MAX);
+        for (int n = 0; n < 3; n++)
+        {
+            const ImDrawVert& v = vtx_buffer[idx[n]];
+            const ImVec2 pos = v.pos;
+            prim.Pos[n] = ImVec2(ImGui_ImplSoftraster_ClampF((pos.x - clip_off.x) * clip_scale.x, -max_coord, max_coord), ImGui_ImplSoftraster_ClampF((pos.y - clip_off.y) * clip_scale.y, -max_coord, max_coord));
+            prim.Uv[n] = v.uv;
+            prim.Col[n] = v.col;
+            p_min = ImVec2(ImGui_ImplSoftraster_Min(p_min.x, prim.Pos[n].x), ImGui_ImplSoftraster_Min(p_min.y, prim.Pos[n].y));
+            p_max = ImVec2(ImGui_ImplSoftraster_Max(p_max.x, prim.Pos[n].x), ImGui_ImplSoftraster_Max(p_max.y, prim.Pos[n].y));
+        }
+        prim.X0 = ImGui_ImplSoftraster_Max(clip_x0, (int)floorf(p_min.x));
+        prim.Y0 = ImGui_ImplSoftraster_Max(clip_y0, (int)floorf(p_min.y));
+        prim.X1 = ImGui_ImplSoftraster_Min(clip_x1, (int)ceilf(p_max.x) + 1);
+        prim.Y1 = ImGui_ImplSoftraster_Min(clip_y1, (int)ceilf(p_max.y) + 1);
+        if (prim.X0 < prim.X1 && prim.Y0 < prim.Y1 && (prim.Col[0] | prim.Col[1] | prim.Col[2]) & IM_COL32_A_MASK)
+            bd->Prims.push_back(prim);
+        idx_n += 3;
+    }
+}
+
+static void ImGui_ImplSoftraster_AddRects(ImGui_ImplSoftraster_Data* bd, const ImDrawList* cmd_list, const ImDrawCmd* pcmd, int clip_x0, int clip_y0, int clip_x1, int clip_y1, ImVec2 clip_off, ImVec2 clip_scale)
+{
+    const float max_coord = IMGUI_IMPL_SOFTRASTER_MAX_COORD;
+    for (unsigned int rect_n = pcmd->RectOffset; rect_n < pcmd->RectOffset + pcmd->RectCount; rect_n++)
+    {
+        const ImDrawRectInstance& rect = cmd_list->RectBuffer.Data[rect_n];
+        if ((rect.Col & IM_COL32_A_MASK) == 0)
+            continue;
+        ImGui_ImplSoftraster_Prim prim;
+        prim.Type = ImGui_ImplSoftraster_PrimType_Rect;
+        prim.Texture = nullptr;
+        prim.Pos[0] = ImVec2(ImGui_ImplSoftraster_ClampF((rect.Min.x - clip_off.x) * clip_scale.x, -max_coord, max_coord), ImGui_ImplSoftraster_ClampF((rect.Min.y - clip_off.y) * clip_scale.y, -max_coord, max_coord));
+        prim.Pos[1] = ImVec2(ImGui_ImplSoftraster_ClampF((rect.Max.x - clip_off.x) * clip_scale.x, -max_coord, max_coord), ImGui_ImplSoftraster_ClampF((rect.Max.y - clip_off.y) * clip_scale.y, -max_coord, max_coord));
+        prim.Uv[0] = ImVec2(rect.Rounding * clip_scale.x, rect.Thickness * clip_scale.x);
+        prim.Col[0] = rect.Col;
+        prim.Col[1] = rect.Flags;
+
+        // Same quad as the OpenGL backend: rectangle expanded by half thickness + 1.0f for anti-aliasing
+        const float expand = prim.Uv[0].y * 0.5f + 1.0f;
+        prim.X0 = ImGui_ImplSoftraster_Max(clip_x0, (int)ceilf(prim.Pos[0].x - expand - 0.5f));
+        prim.Y0 = ImGui_ImplSoftraster_Max(clip_y0, (int)ceilf(prim.Pos[0].y - expand - 0.5f));
+        prim.X1 = ImGui_ImplSoftraster_Min(clip_x1, (int)ceilf(prim.Pos[1].x + expand - 0.5f));
+        prim.Y1 = ImGui_ImplSoftraster_Min(clip_y1, (int)ceilf(prim.Pos[1].y + expand - 0.5f));
+        if (prim.X0 < prim.X1 && prim.Y0 < prim.Y1)
+            bd->Prims.push_back(prim);
+    }
+}
+
+// Copy rectangles of font atlas modified since last frame (glyphs rasterized on demand, see ImFontAtlasFlags_DynamicGlyphs)
+static void ImGui_ImplSoftraster_UpdateFontsTexture()
+{
+    ImGui_ImplSoftraster_Data* bd = ImGui_ImplSoftraster_GetBackendData();
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (bd->FontPixels != nullptr && atlas->TexUpdates.Size > 0)
+    {
+        unsigned char* pixels;
+        int width, height;
+        const int bytes_per_pixel = bd->FontTexture.BytesPerPixel;
+        if (bytes_per_pixel == 4)
+            atlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+        else
+            atlas->GetTexDataAsAlpha8(&pixels, &width, &height);
+        IM_ASSERT(width == bd->FontTexture.Width && height == bd->FontTexture.Height);
+        for (const ImFontAtlasTexUpdate& update : atlas->TexUpdates)
+            for (int y = update.Y; y < update.Y + update.Height; y++)
+            {
+                const size_t offset = ((size_t)y * width + update.X) * bytes_per_pixel;
+                memcpy(bd->FontPixels + offset, pixels + offset, (size_t)update.Width * bytes_per_pixel);
+            }
+    }
+    atlas->TexUpdates.resize(0);
+}
+
+void ImGui_ImplSoftraster_RenderDrawData(ImDrawData* draw_data, void* pixels, int width, int height, int pitch)
+{
+    // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
+    int fb_width = ImGui_ImplSoftraster_Min((int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x), width);
+    int fb_height = ImGui_ImplSoftraster_Min((int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y), height);
+    if (fb_width <= 0 || fb_height <= 0)
+        return;
+    IM_ASSERT(pixels != nullptr && pitch >= width * (int)sizeof(ImU32));
+
+    ImGui_ImplSoftraster_Data* bd = ImGui_ImplSoftraster_GetBackendData();
+    ImGui_ImplSoftraster_UpdateFontsTexture();
+    bd->Pixels = (ImU32*)pixels;
+    bd->Width = fb_width;
+    bd->Height = fb_height;
+    bd->Pitch = pitch;
+    bd->TilesX = (fb_width + IMGUI_IMPL_SOFTRASTER_TILE_SIZE - 1) >> IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT;
+    bd->TilesY = (fb_height + IMGUI_IMPL_SOFTRASTER_TILE_SIZE - 1) >> IMGUI_IMPL_SOFTRASTER_TILE_SIZE_SHIFT;
+    bd->Prims.resize(0);
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // Convert command lists to primitives
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != nullptr)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                // Primitives submitted so far are rasterized first, so the callback may write to the pixel buffer.
+                ImGui_ImplSoftraster_Flush(bd);
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                    pcmd->UserCallback(cmd_list, pcmd);
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space, same as glScissor() in other backends
+            ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                continue;
+            const int clip_x0 = ImGui_ImplSoftraster_ClampI((int)clip_min.x, 0, fb_width);
+            const int clip_y0 = ImGui_ImplSoftraster_ClampI((int)clip_min.y, 0, fb_height);
+            const int clip_x1 = ImGui_ImplSoftraster_ClampI((int)clip_min.x + (int)(clip_max.x - clip_min.x), 0, fb_width);
+            const int clip_y1 = ImGui_ImplSoftraster_ClampI((int)clip_min.y + (int)(clip_max.y - clip_min.y), 0, fb_height);
+            if (clip_x0 >= clip_x1 || clip_y0 >= clip_y1)
+                continue;
+
+            if (pcmd->RectCount != 0)
+                ImGui_ImplSoftraster_AddRects(bd, cmd_list, pcmd, clip_x0, clip_y0, clip_x1, clip_y1, clip_off, clip_scale);
+            else
+                ImGui_ImplSoftraster_AddTriangles(bd, cmd_list, pcmd, (const ImGui_ImplSoftraster_Texture*)(intptr_t)pcmd->GetTexID(), clip_x0, clip_y0, clip_x1, clip_y1, clip_off, clip_scale);
+        }
+    }
+    ImGui_ImplSoftraster_Flush(bd);
+    bd->Pixels = nullptr;
+}
+
+bool ImGui_ImplSoftraster_CreateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplSoftraster_Data* bd = ImGui_ImplSoftraster_GetBackendData();
+
+    // Keep a copy of the atlas: alpha-only unless it has colored glyphs
+    unsigned char* pixels;
+    int width, height, bytes_per_pixel;
+    if (io.Fonts->TexPixelsUseColors)
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height, &bytes_per_pixel);
+    else
+        io.Fonts->GetTexDataAsAlpha8(&pixels, &width, &height, &bytes_per_pixel);
+    const size_t size = (size_t)width * (size_t)height * (size_t)bytes_per_pixel;
+    bd->FontPixels = (unsigned char*)IM_ALLOC(size);
+    memcpy(bd->FontPixels, pixels, size);
+    bd->FontTexture.Pixels = bd->FontPixels;
+    bd->FontTexture.Width = width;
+    bd->FontTexture.Height = height;
+    bd->FontTexture.BytesPerPixel = bytes_per_pixel;
+
+    // Store our identifier
+    io.Fonts->SetTexID((ImTextureID)(intptr_t)&bd->FontTexture);
+
+    return true;
+}
+
+void ImGui_ImplSoftraster_DestroyFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplSoftraster_Data* bd = ImGui_ImplSoftraster_GetBackendData();
+    if (bd->FontPixels)
+    {
+        IM_FREE(bd->FontPixels);
+        bd->FontPixels = nullptr;
+        memset((void*)&bd->FontTexture, 0, sizeof(bd->FontTexture));
+        io.Fonts->SetTexID(0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,55 @@
+// dear imgui: Renderer Backend for software rasterization into a CPU pixel buffer
+// This needs to be used along with a Platform Backend, or standalone for headless rendering (e.g. tests, screenshots, remote viewers).
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftraster_Texture*' as ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Per draw list index size (ImGuiBackendFlags_RendererHasPackedIdx) when using 32-bit indices.
+//  [X] Renderer: Rectangle instances (ImGuiBackendFlags_RendererHasRectInstances), rasterized from their signed distance.
+//  [X] Renderer: Index buffer segments (ImGuiBackendFlags_RendererHasIdxSegments).
+//  [X] Renderer: Compact 12 bytes vertices when IMGUI_USE_COMPACT_DRAWVERT is defined.
+//  [X] Renderer: Multi-threaded rasterization, with primitives binned into screen tiles.
+
+// About output:
+// - Pixels are written as 32-bit ImU32 values in IM_COL32() layout (R,G,B,A bytes in memory with default IM_COL32_XXX_SHIFT values).
+// - Primitives are blended over existing content: clear the buffer yourself before calling ImGui_ImplSoftraster_RenderDrawData().
+// - Blending matches the other renderer backends: rgb = src.rgb * src.a + dst.rgb * (1 - src.a), a = src.a + dst.a * (1 - src.a).
+// - Textures are sampled with bilinear filtering and clamping to edges, like other backends. Axis-aligned quads mapping texels 1:1 to pixels
+//   (e.g. text, unless you scale it) take a fast path reading the texel under each pixel center, where bilinear filtering has no effect.
+// - User callbacks are called in order: primitives submitted before them are rasterized when they are called.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+// Texture description. Use a pointer to it as ImTextureID.
+// - BytesPerPixel == 4: ImU32 texels in IM_COL32() layout.
+// - BytesPerPixel == 1: alpha-only texels, sampled as white (e.g. output of ImFontAtlas::GetTexDataAsAlpha8()).
+struct ImGui_ImplSoftraster_Texture
+{
+    const void*     Pixels;
+    int             Width;
+    int             Height;
+    int             BytesPerPixel;
+};
+
+// Backend API
+// - threads_count: number of threads rasterizing tiles, including the calling thread. 0 = std::thread::hardware_concurrency().
+IMGUI_IMPL_API bool     ImGui_ImplSoftraster_Init(int threads_count = 1);
+IMGUI_IMPL_API void     ImGui_ImplSoftraster_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftraster_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplSoftraster_RenderDrawData(ImDrawData* draw_data, void* pixels, int width, int height, int pitch);
+
+// (Optional) Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API bool     ImGui_ImplSoftraster_CreateFontsTexture();
+IMGUI_IMPL_API void     ImGui_ImplSoftraster_DestroyFontsTexture();
+
+#endif // #ifndef IMGUI_DISABLE
@@ -4,6 +4,10 @@
 // Implemented features:
 //  [!] Renderer: User texture binding. Use 'VkDescriptorSet' as ImTextureID. Read the FAQ about ImTextureID! See https://github.com/ocornut/imgui/pull/914 for discussions.
 //  [X] Renderer: Large meshes support (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Per draw list index size (ImGuiBackendFlags_RendererHasPackedIdx) when using 32-bit indices.
+//  [X] Renderer: Compact 12 bytes vertices when IMGUI_USE_COMPACT_DRAWVERT is defined.
+//  [X] Renderer: Partial font texture updates (ImGuiBackendFlags_RendererHasTexUpdates), for glyphs rasterized on demand (ImFontAtlasFlags_DynamicGlyphs).
+//  [X] Renderer: Rectangle instances expanded on GPU (ImGuiBackendFlags_RendererHasRectInstances).
 
 // Important: on 32-bit systems, user texture binding is only supported if your imconfig file has '#define ImTextureID ImU64'.
 // This is because we need ImTextureID to carry a 64-bit value and by default ImTextureID is defined as void*.
@@ -33,6 +37,10 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-17: Vulkan: Render ImDrawList::RectBuffer[] instances with a dedicated pipeline and enable ImGuiBackendFlags_RendererHasRectInstances flag.
+//  2026-10-17: Vulkan: Upload ImFontAtlas::TexUpdates[] with vkCmdCopyBufferToImage() and enable ImGuiBackendFlags_RendererHasTexUpdates flag.
+//  2026-10-17: Vulkan: Support compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT): 16-bit fixed-point positions and 16-bit normalized UV.
+//  2026-10-17: Vulkan: Bind index buffer per draw list to honor ImDrawList::IdxSize. Enable ImGuiBackendFlags_RendererHasPackedIdx flag when ImDrawIdx is 32-bit.
 //  2024-04-19: Vulkan: Added convenience support for Volk via IMGUI_IMPL_VULKAN_USE_VOLK define (you can also use IMGUI_IMPL_VULKAN_NO_PROTOTYPES + wrap Volk via ImGui_ImplVulkan_LoadFunctions().)
 //  2024-02-14: *BREAKING CHANGE*: Moved RenderPass parameter from ImGui_ImplVulkan_Init() function to ImGui_ImplVulkan_InitInfo structure. Not required when using dynamic rendering.
 //  2024-02-12: *BREAKING CHANGE*: Dynamic rendering now require filling PipelineRenderingCreateInfo structure.
@@ -128,6 +136,7 @@ static bool g_FunctionsLoaded = true;
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdBindPipeline) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdBindVertexBuffers) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdCopyBufferToImage) \
+    IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdDraw) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdDrawIndexed) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdPipelineBarrier) \
     IMGUI_VULKAN_FUNC_MAP_MACRO(vkCmdPushConstants) \
@@ -199,10 +208,13 @@ struct ImGui_ImplVulkan_FrameRenderBuffers
 {
     VkDeviceMemory      VertexBufferMemory;
     VkDeviceMemory      IndexBufferMemory;
+    VkDeviceMemory      RectBufferMemory;
     VkDeviceSize        VertexBufferSize;
     VkDeviceSize        IndexBufferSize;
+    VkDeviceSize        RectBufferSize;
     VkBuffer            VertexBuffer;
     VkBuffer            IndexBuffer;
+    VkBuffer            RectBuffer;
 };
 
 // Each viewport will hold 1 ImGui_ImplVulkanH_WindowRenderBuffers
@@ -223,8 +235,11 @@ struct ImGui_ImplVulkan_Data
     VkDescriptorSetLayout       DescriptorSetLayout;
     VkPipelineLayout            PipelineLayout;
     VkPipeline                  Pipeline;
+    VkPipeline                  RectPipeline;               // Pipeline used to expand ImDrawRectInstance (see ImGuiBackendFlags_RendererHasRectInstances)
     VkShaderModule              ShaderModuleVert;
     VkShaderModule              ShaderModuleFrag;
+    VkShaderModule              ShaderModuleRectVert;
+    VkShaderModule              ShaderModuleRectFrag;
 
     // Font data
     VkSampler                   FontSampler;
@@ -354,6 +369,190 @@ static uint32_t __glsl_shader_frag_spv[] =
     0x00010038
 };
 
+// backends/vulkan/glsl_shader_rect.vert, compiled with:
+// # glslangValidator -V -x -o glsl_shader_rect.vert.u32 glsl_shader_rect.vert
+// Expand each ImDrawRectInstance into a quad (using gl_VertexIndex) enlarged by half the stroke thickness + 1 pixel for anti-aliasing.
+// ImDrawRectInstance::Flags bits 0-3 select rounded corners (TL, TR, BL, BR), bit 4 enables anti-aliasing.
+/*
+#version 450 core
+layout(location = 0) in vec4 aMinMax;
+layout(location = 1) in vec4 aColor;
+layout(location = 2) in vec2 aParams;
+layout(location = 3) in uint aFlags;
+layout(push_constant) uniform uPushConstant { vec2 uScale; vec2 uTranslate; } pc;
+
+out gl_PerVertex { vec4 gl_Position; };
+layout(location = 0) out vec2 Pos;
+layout(location = 1) flat out vec2 HalfSize;
+layout(location = 2) flat out vec4 Radius;
+layout(location = 3) flat out vec2 StrokeAA;
+layout(location = 4) flat out vec4 Color;
+
+void main()
+{
+    vec4 corners = vec4((uvec4(aFlags) >> uvec4(0, 1, 2, 3)) & uvec4(1));
+    vec2 half_size = (aMinMax.zw - aMinMax.xy) * 0.5;
+    vec2 quad = vec2(float(gl_VertexIndex & 1), float(gl_VertexIndex >> 1)) * 2.0 - 1.0;
+    Pos = quad * (half_size + aParams.y * 0.5 + 1.0);
+    HalfSize = half_size;
+    Radius = corners * aParams.x;
+    StrokeAA = vec2(aParams.y, float((aFlags >> 4) & 1));
+    Color = aColor;
+    gl_Position = vec4(((aMinMax.xy + aMinMax.zw) * 0.5 + Pos) * pc.uScale + pc.uTranslate, 0, 1);
+}
+*/
+static uint32_t __glsl_shader_rect_vert_spv[] =
+{
+    0x07230203,0x00010000,0x00000000,0x0000005e,0x00000000,0x00020011,0x00000001,0x0006000b,
+    0x0000001d,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+    0x0010000f,0x00000000,0x0000001e,0x6e69616d,0x00000000,0x00000008,0x00000009,0x0000000b,
+    0x0000000d,0x0000000f,0x00000012,0x00000014,0x00000015,0x00000017,0x00000018,0x00000019,
+    0x00030003,0x00000002,0x000001c2,0x00040047,0x00000008,0x0000001e,0x00000000,0x00040047,
+    0x00000009,0x0000001e,0x00000001,0x00040047,0x0000000b,0x0000001e,0x00000002,0x00040047,
+    0x0000000d,0x0000001e,0x00000003,0x00040047,0x00000014,0x0000001e,0x00000000,0x00040047,
+    0x00000015,0x0000001e,0x00000001,0x00040047,0x00000017,0x0000001e,0x00000002,0x00040047,
+    0x00000018,0x0000001e,0x00000003,0x00040047,0x00000019,0x0000001e,0x00000004,0x00030047,
+    0x00000015,0x0000000e,0x00030047,0x00000017,0x0000000e,0x00030047,0x00000018,0x0000000e,
+    0x00030047,0x00000019,0x0000000e,0x00040047,0x0000000f,0x0000000b,0x0000002a,0x00050048,
+    0x00000010,0x00000000,0x0000000b,0x00000000,0x00030047,0x00000010,0x00000002,0x00050048,
+    0x0000001a,0x00000000,0x00000023,0x00000000,0x00050048,0x0000001a,0x00000001,0x00000023,
+    0x00000008,0x00030047,0x0000001a,0x00000002,0x00030016,0x00000001,0x00000020,0x00040015,
+    0x00000002,0x00000020,0x00000001,0x00040015,0x00000003,0x00000020,0x00000000,0x00040017,
+    0x00000004,0x00000001,0x00000002,0x00040017,0x00000005,0x00000001,0x00000004,0x00040017,
+    0x00000006,0x00000003,0x00000004,0x00040020,0x00000007,0x00000001,0x00000005,0x0004003b,
+    0x00000007,0x00000008,0x00000001,0x0004003b,0x00000007,0x00000009,0x00000001,0x00040020,
+    0x0000000a,0x00000001,0x00000004,0x0004003b,0x0000000a,0x0000000b,0x00000001,0x00040020,
+    0x0000000c,0x00000001,0x00000003,0x0004003b,0x0000000c,0x0000000d,0x00000001,0x00040020,
+    0x0000000e,0x00000001,0x00000002,0x0004003b,0x0000000e,0x0000000f,0x00000001,0x0003001e,
+    0x00000010,0x00000005,0x00040020,0x00000011,0x00000003,0x00000010,0x0004003b,0x00000011,
+    0x00000012,0x00000003,0x00040020,0x00000013,0x00000003,0x00000004,0x0004003b,0x00000013,
+    0x00000014,0x00000003,0x0004003b,0x00000013,0x00000015,0x00000003,0x00040020,0x00000016,
+    0x00000003,0x00000005,0x0004003b,0x00000016,0x00000017,0x00000003,0x0004003b,0x00000013,
+    0x00000018,0x00000003,0x0004003b,0x00000016,0x00000019,0x00000003,0x0004001e,0x0000001a,
+    0x00000004,0x00000004,0x00040020,0x0000001b,0x00000009,0x0000001a,0x0004003b,0x0000001b,
+    0x0000001c,0x00000009,0x00020013,0x0000001f,0x00030021,0x00000020,0x0000001f,0x0004002b,
+    0x00000002,0x00000021,0x00000000,0x0004002b,0x00000002,0x00000022,0x00000001,0x0004002b,
+    0x00000003,0x00000023,0x00000000,0x0004002b,0x00000003,0x00000024,0x00000001,0x0004002b,
+    0x00000003,0x00000025,0x00000002,0x0004002b,0x00000003,0x00000026,0x00000003,0x0004002b,
+    0x00000003,0x00000027,0x00000004,0x0007002c,0x00000006,0x00000028,0x00000023,0x00000024,
+    0x00000025,0x00000026,0x0007002c,0x00000006,0x00000029,0x00000024,0x00000024,0x00000024,
+    0x00000024,0x0004002b,0x00000001,0x0000002a,0x00000000,0x0004002b,0x00000001,0x0000002b,
+    0x3f000000,0x0004002b,0x00000001,0x0000002c,0x3f800000,0x0004002b,0x00000001,0x0000002d,
+    0x40000000,0x0005002c,0x00000004,0x0000002e,0x0000002c,0x0000002c,0x00040020,0x0000002f,
+    0x00000009,0x00000004,0x00050036,0x0000001f,0x0000001e,0x00000000,0x00000020,0x000200f8,
+    0x00000030,0x0004003d,0x00000005,0x00000031,0x00000008,0x0004003d,0x00000005,0x00000032,
+    0x00000009,0x0004003d,0x00000004,0x00000033,0x0000000b,0x0004003d,0x00000003,0x00000034,
+    0x0000000d,0x00070050,0x00000006,0x00000035,0x00000034,0x00000034,0x00000034,0x00000034,
+    0x000500c2,0x00000006,0x00000036,0x00000035,0x00000028,0x000500c7,0x00000006,0x00000037,
+    0x00000036,0x00000029,0x00040070,0x00000005,0x00000038,0x00000037,0x0007004f,0x00000004,
+    0x00000039,0x00000031,0x00000031,0x00000000,0x00000001,0x0007004f,0x00000004,0x0000003a,
+    0x00000031,0x00000031,0x00000002,0x00000003,0x00050083,0x00000004,0x0000003b,0x0000003a,
+    0x00000039,0x0005008e,0x00000004,0x0000003c,0x0000003b,0x0000002b,0x0004003d,0x00000002,
+    0x0000003d,0x0000000f,0x000500c7,0x00000002,0x0000003e,0x0000003d,0x00000022,0x0004006f,
+    0x00000001,0x0000003f,0x0000003e,0x000500c3,0x00000002,0x00000040,0x0000003d,0x00000022,
+    0x0004006f,0x00000001,0x00000041,0x00000040,0x00050050,0x00000004,0x00000042,0x0000003f,
+    0x00000041,0x0005008e,0x00000004,0x00000043,0x00000042,0x0000002d,0x00050083,0x00000004,
+    0x00000044,0x00000043,0x0000002e,0x00050051,0x00000001,0x00000045,0x00000033,0x00000000,
+    0x00050051,0x00000001,0x00000046,0x00000033,0x00000001,0x00050085,0x00000001,0x00000047,
+    0x00000046,0x0000002b,0x00050081,0x00000001,0x00000048,0x00000047,0x0000002c,0x00050050,
+    0x00000004,0x00000049,0x00000048,0x00000048,0x00050081,0x00000004,0x0000004a,0x0000003c,
+    0x00000049,0x00050085,0x00000004,0x0000004b,0x00000044,0x0000004a,0x0003003e,0x00000014,
+    0x0000004b,0x0003003e,0x00000015,0x0000003c,0x0005008e,0x00000005,0x0000004c,0x00000038,
+    0x00000045,0x0003003e,0x00000017,0x0000004c,0x000500c2,0x00000003,0x0000004d,0x00000034,
+    0x00000027,0x000500c7,0x00000003,0x0000004e,0x0000004d,0x00000024,0x00040070,0x00000001,
+    0x0000004f,0x0000004e,0x00050050,0x00000004,0x00000050,0x00000046,0x0000004f,0x0003003e,
+    0x00000018,0x00000050,0x0003003e,0x00000019,0x00000032,0x00050081,0x00000004,0x00000051,
+    0x00000039,0x0000003a,0x0005008e,0x00000004,0x00000052,0x00000051,0x0000002b,0x00050081,
+    0x00000004,0x00000053,0x00000052,0x0000004b,0x00050041,0x0000002f,0x00000054,0x0000001c,
+    0x00000021,0x0004003d,0x00000004,0x00000055,0x00000054,0x00050041,0x0000002f,0x00000056,
+    0x0000001c,0x00000022,0x0004003d,0x00000004,0x00000057,0x00000056,0x00050085,0x00000004,
+    0x00000058,0x00000053,0x00000055,0x00050081,0x00000004,0x00000059,0x00000058,0x00000057,
+    0x00050051,0x00000001,0x0000005a,0x00000059,0x00000000,0x00050051,0x00000001,0x0000005b,
+    0x00000059,0x00000001,0x00070050,0x00000005,0x0000005c,0x0000005a,0x0000005b,0x0000002a,
+    0x0000002c,0x00050041,0x00000016,0x0000005d,0x00000012,0x00000021,0x0003003e,0x0000005d,
+    0x0000005c,0x000100fd,0x00010038
+};
+
+// backends/vulkan/glsl_shader_rect.frag, compiled with:
+// # glslangValidator -V -x -o glsl_shader_rect.frag.u32 glsl_shader_rect.frag
+// Evaluate the signed distance to the rounded rectangle (with a radius per corner), or to its outline.
+/*
+#version 450 core
+layout(location = 0) out vec4 fColor;
+layout(location = 0) in vec2 Pos;
+layout(location = 1) flat in vec2 HalfSize;
+layout(location = 2) flat in vec4 Radius;
+layout(location = 3) flat in vec2 StrokeAA;
+layout(location = 4) flat in vec4 Color;
+void main()
+{
+    vec2 radius_y = (Pos.y < 0.0) ? Radius.xy : Radius.zw;
+    float radius = (Pos.x < 0.0) ? radius_y.x : radius_y.y;
+    vec2 q = abs(Pos) - HalfSize + radius;
+    float d = (radius > 0.0) ? length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - radius : max(q.x, q.y);
+    if (StrokeAA.x > 0.0)
+        d = abs(d) - StrokeAA.x * 0.5;
+    float coverage = (StrokeAA.y > 0.5) ? clamp(0.5 - d, 0.0, 1.0) : ((d < 0.0) ? 1.0 : 0.0);
+    fColor = vec4(Color.rgb, Color.a * coverage);
+}
+*/
+static uint32_t __glsl_shader_rect_frag_spv[] =
+{
+    0x07230203,0x00010000,0x00000000,0x0000004a,0x00000000,0x00020011,0x00000001,0x0006000b,
+    0x00000010,0x4c534c47,0x6474732e,0x3035342e,0x00000000,0x0003000e,0x00000000,0x00000001,
+    0x000b000f,0x00000004,0x00000011,0x6e69616d,0x00000000,0x00000008,0x0000000a,0x0000000b,
+    0x0000000d,0x0000000e,0x0000000f,0x00030010,0x00000011,0x00000007,0x00030003,0x00000002,
+    0x000001c2,0x00040047,0x00000008,0x0000001e,0x00000000,0x00040047,0x0000000a,0x0000001e,
+    0x00000000,0x00040047,0x0000000b,0x0000001e,0x00000001,0x00040047,0x0000000d,0x0000001e,
+    0x00000002,0x00040047,0x0000000e,0x0000001e,0x00000003,0x00040047,0x0000000f,0x0000001e,
+    0x00000004,0x00030047,0x0000000b,0x0000000e,0x00030047,0x0000000d,0x0000000e,0x00030047,
+    0x0000000e,0x0000000e,0x00030047,0x0000000f,0x0000000e,0x00030016,0x00000001,0x00000020,
+    0x00020014,0x00000002,0x00040017,0x00000003,0x00000001,0x00000002,0x00040017,0x00000004,
+    0x00000001,0x00000004,0x00040017,0x00000005,0x00000001,0x00000003,0x00040017,0x00000006,
+    0x00000002,0x00000002,0x00040020,0x00000007,0x00000003,0x00000004,0x0004003b,0x00000007,
+    0x00000008,0x00000003,0x00040020,0x00000009,0x00000001,0x00000003,0x0004003b,0x00000009,
+    0x0000000a,0x00000001,0x0004003b,0x00000009,0x0000000b,0x00000001,0x00040020,0x0000000c,
+    0x00000001,0x00000004,0x0004003b,0x0000000c,0x0000000d,0x00000001,0x0004003b,0x00000009,
+    0x0000000e,0x00000001,0x0004003b,0x0000000c,0x0000000f,0x00000001,0x00020013,0x00000012,
+    0x00030021,0x00000013,0x00000012,0x0004002b,0x00000001,0x00000014,0x00000000,0x0004002b,
+    0x00000001,0x00000015,0x3f000000,0x0004002b,0x00000001,0x00000016,0x3f800000,0x0005002c,
+    0x00000003,0x00000017,0x00000014,0x00000014,0x00050036,0x00000012,0x00000011,0x00000000,
+    0x00000013,0x000200f8,0x00000018,0x0004003d,0x00000003,0x00000019,0x0000000a,0x0004003d,
+    0x00000003,0x0000001a,0x0000000b,0x0004003d,0x00000004,0x0000001b,0x0000000d,0x0004003d,
+    0x00000003,0x0000001c,0x0000000e,0x0004003d,0x00000004,0x0000001d,0x0000000f,0x00050051,
+    0x00000001,0x0000001e,0x00000019,0x00000001,0x000500b8,0x00000002,0x0000001f,0x0000001e,
+    0x00000014,0x00050050,0x00000006,0x00000020,0x0000001f,0x0000001f,0x0007004f,0x00000003,
+    0x00000021,0x0000001b,0x0000001b,0x00000000,0x00000001,0x0007004f,0x00000003,0x00000022,
+    0x0000001b,0x0000001b,0x00000002,0x00000003,0x000600a9,0x00000003,0x00000023,0x00000020,
+    0x00000021,0x00000022,0x00050051,0x00000001,0x00000024,0x00000019,0x00000000,0x000500b8,
+    0x00000002,0x00000025,0x00000024,0x00000014,0x00050051,0x00000001,0x00000026,0x00000023,
+    0x00000000,0x00050051,0x00000001,0x00000027,0x00000023,0x00000001,0x000600a9,0x00000001,
+    0x00000028,0x00000025,0x00000026,0x00000027,0x0006000c,0x00000003,0x00000029,0x00000010,
+    0x00000004,0x00000019,0x00050083,0x00000003,0x0000002a,0x00000029,0x0000001a,0x00050050,
+    0x00000003,0x0000002b,0x00000028,0x00000028,0x00050081,0x00000003,0x0000002c,0x0000002a,
+    0x0000002b,0x00050051,0x00000001,0x0000002d,0x0000002c,0x00000000,0x00050051,0x00000001,
+    0x0000002e,0x0000002c,0x00000001,0x0007000c,0x00000001,0x0000002f,0x00000010,0x00000028,
+    0x0000002d,0x0000002e,0x0007000c,0x00000003,0x00000030,0x00000010,0x00000028,0x0000002c,
+    0x00000017,0x0006000c,0x00000001,0x00000031,0x00000010,0x00000042,0x00000030,0x0007000c,
+    0x00000001,0x00000032,0x00000010,0x00000025,0x0000002f,0x00000014,0x00050081,0x00000001,
+    0x00000033,0x00000031,0x00000032,0x00050083,0x00000001,0x00000034,0x00000033,0x00000028,
+    0x000500ba,0x00000002,0x00000035,0x00000028,0x00000014,0x000600a9,0x00000001,0x00000036,
+    0x00000035,0x00000034,0x0000002f,0x00050051,0x00000001,0x00000037,0x0000001c,0x00000000,
+    0x0006000c,0x00000001,0x00000038,0x00000010,0x00000004,0x00000036,0x00050085,0x00000001,
+    0x00000039,0x00000037,0x00000015,0x00050083,0x00000001,0x0000003a,0x00000038,0x00000039,
+    0x000500ba,0x00000002,0x0000003b,0x00000037,0x00000014,0x000600a9,0x00000001,0x0000003c,
+    0x0000003b,0x0000003a,0x00000036,0x00050083,0x00000001,0x0000003d,0x00000015,0x0000003c,
+    0x0008000c,0x00000001,0x0000003e,0x00000010,0x0000002b,0x0000003d,0x00000014,0x00000016,
+    0x000500b8,0x00000002,0x0000003f,0x0000003c,0x00000014,0x000600a9,0x00000001,0x00000040,
+    0x0000003f,0x00000016,0x00000014,0x00050051,0x00000001,0x00000041,0x0000001c,0x00000001,
+    0x000500ba,0x00000002,0x00000042,0x00000041,0x00000015,0x000600a9,0x00000001,0x00000043,
+    0x00000042,0x0000003e,0x00000040,0x00050051,0x00000001,0x00000044,0x0000001d,0x00000003,
+    0x00050085,0x00000001,0x00000045,0x00000044,0x00000043,0x00050051,0x00000001,0x00000046,
+    0x0000001d,0x00000000,0x00050051,0x00000001,0x00000047,0x0000001d,0x00000001,0x00050051,
+    0x00000001,0x00000048,0x0000001d,0x00000002,0x00070050,0x00000004,0x00000049,0x00000046,
+    0x00000047,0x00000048,0x00000045,0x0003003e,0x00000008,0x00000049,0x000100fd,0x00010038
+};
+
 //-----------------------------------------------------------------------------
 // FUNCTIONS
 //-----------------------------------------------------------------------------
@@ -428,10 +627,25 @@ static void CreateOrResizeBuffer(VkBuffer& buffer, VkDeviceMemory& buffer_memory
     buffer_size = buffer_size_aligned;
 }
 
-static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline pipeline, VkCommandBuffer command_buffer, ImGui_ImplVulkan_FrameRenderBuffers* rb, int fb_width, int fb_height)
+// Our visible imgui space lies from draw_data->DisplayPps (top left) to draw_data->DisplayPos+data_data->DisplaySize (bottom right). DisplayPos is (0,0) for single viewport apps.
+// 'pos_scale' converts vertex positions to pixels: it only differs between ImDrawVert and ImDrawRectInstance with IMGUI_USE_COMPACT_DRAWVERT.
+static void ImGui_ImplVulkan_SetupScaleTranslate(ImDrawData* draw_data, VkCommandBuffer command_buffer, float pos_scale)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    float scale[2];
+    scale[0] = 2.0f / draw_data->DisplaySize.x;
+    scale[1] = 2.0f / draw_data->DisplaySize.y;
+    float translate[2];
+    translate[0] = -1.0f - draw_data->DisplayPos.x * scale[0];
+    translate[1] = -1.0f - draw_data->DisplayPos.y * scale[1];
+    scale[0] *= pos_scale;
+    scale[1] *= pos_scale;
+    vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 0, sizeof(float) * 2, scale);
+    vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 2, sizeof(float) * 2, translate);
+}
 
+static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline pipeline, VkCommandBuffer command_buffer, ImGui_ImplVulkan_FrameRenderBuffers* rb, int fb_width, int fb_height)
+{
     // Bind pipeline:
     {
         vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
@@ -446,6 +660,14 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
         vkCmdBindIndexBuffer(command_buffer, rb->IndexBuffer, 0, sizeof(ImDrawIdx) == 2 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32);
     }
 
+    // Bind Rectangle Instance Buffer (binding 1, only read by RectPipeline):
+    if (rb->RectBuffer != VK_NULL_HANDLE)
+    {
+        VkBuffer rect_buffers[1] = { rb->RectBuffer };
+        VkDeviceSize rect_offset[1] = { 0 };
+        vkCmdBindVertexBuffers(command_buffer, 1, 1, rect_buffers, rect_offset);
+    }
+
     // Setup viewport:
     {
         VkViewport viewport;
@@ -459,20 +681,141 @@ static void ImGui_ImplVulkan_SetupRenderState(ImDrawData* draw_data, VkPipeline
     }
 
     // Setup scale and translation:
-    // Our visible imgui space lies from draw_data->DisplayPps (top left) to draw_data->DisplayPos+data_data->DisplaySize (bottom right). DisplayPos is (0,0) for single viewport apps.
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    ImGui_ImplVulkan_SetupScaleTranslate(draw_data, command_buffer, 1.0f / IM_DRAWVERT_POS_SCALE); // Compact vertices store positions as fixed-point integers
+#else
+    ImGui_ImplVulkan_SetupScaleTranslate(draw_data, command_buffer, 1.0f);
+#endif
+}
+
+// Render function
+// Upload parts of font atlas modified since last frame (see ImFontAtlasFlags_DynamicGlyphs)
+// Updates are rare (glyphs are only rasterized on first use), so we simply wait for previous frames to be done with the texture.
+static void ImGui_ImplVulkan_UpdateFontsTexture()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
+    ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
+    if (atlas->TexUpdates.Size == 0 || bd->FontImage == VK_NULL_HANDLE || atlas->TexPixelsRGBA32 == nullptr)
+        return;
+    VkResult err;
+
+    // Create the Upload Buffer, with rectangles stored one after another
+    VkDeviceSize upload_size = 0;
+    for (const ImFontAtlasTexUpdate& update : atlas->TexUpdates)
+        upload_size += (VkDeviceSize)update.Width * update.Height * 4;
+    VkDeviceMemory upload_buffer_memory;
+    VkBuffer upload_buffer;
+    {
+        VkBufferCreateInfo buffer_info = {};
+        buffer_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        buffer_info.size = upload_size;
+        buffer_info.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+        buffer_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        err = vkCreateBuffer(v->Device, &buffer_info, v->Allocator, &upload_buffer);
+        check_vk_result(err);
+        VkMemoryRequirements req;
+        vkGetBufferMemoryRequirements(v->Device, upload_buffer, &req);
+        VkMemoryAllocateInfo alloc_info = {};
+        alloc_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        alloc_info.allocationSize = IM_MAX(v->MinAllocationSize, req.size);
+        alloc_info.memoryTypeIndex = ImGui_ImplVulkan_MemoryType(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, req.memoryTypeBits);
+        err = vkAllocateMemory(v->Device, &alloc_info, v->Allocator, &upload_buffer_memory);
+        check_vk_result(err);
+        err = vkBindBufferMemory(v->Device, upload_buffer, upload_buffer_memory, 0);
+        check_vk_result(err);
+    }
+
+    // Upload to Buffer, recording copy regions
+    ImVector<VkBufferImageCopy> regions;
+    regions.reserve(atlas->TexUpdates.Size);
+    {
+        char* map = nullptr;
+        err = vkMapMemory(v->Device, upload_buffer_memory, 0, upload_size, 0, (void**)(&map));
+        check_vk_result(err);
+        VkDeviceSize offset = 0;
+        for (const ImFontAtlasTexUpdate& update : atlas->TexUpdates)
+        {
+            for (int row = 0; row < update.Height; row++)
+                memcpy(map + offset + (size_t)row * update.Width * 4, atlas->TexPixelsRGBA32 + (update.Y + row) * atlas->TexWidth + update.X, (size_t)update.Width * 4);
+            VkBufferImageCopy region = {};
+            region.bufferOffset = offset;
+            region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            region.imageSubresource.layerCount = 1;
+            region.imageOffset.x = update.X;
+            region.imageOffset.y = update.Y;
+            region.imageExtent.width = update.Width;
+            region.imageExtent.height = update.Height;
+            region.imageExtent.depth = 1;
+            regions.push_back(region);
+            offset += (VkDeviceSize)update.Width * update.Height * 4;
+        }
+        VkMappedMemoryRange range[1] = {};
+        range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        range[0].memory = upload_buffer_memory;
+        range[0].size = VK_WHOLE_SIZE;
+        err = vkFlushMappedMemoryRanges(v->Device, 1, range);
+        check_vk_result(err);
+        vkUnmapMemory(v->Device, upload_buffer_memory);
+    }
+
+    // Wait for previous frames sampling the texture, then copy to Image
+    err = vkQueueWaitIdle(v->Queue);
+    check_vk_result(err);
+    err = vkResetCommandPool(v->Device, bd->FontCommandPool, 0);
+    check_vk_result(err);
+    VkCommandBufferBeginInfo begin_info = {};
+    begin_info.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    begin_info.flags |= VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    err = vkBeginCommandBuffer(bd->FontCommandBuffer, &begin_info);
+    check_vk_result(err);
     {
-        float scale[2];
-        scale[0] = 2.0f / draw_data->DisplaySize.x;
-        scale[1] = 2.0f / draw_data->DisplaySize.y;
-        float translate[2];
-        translate[0] = -1.0f - draw_data->DisplayPos.x * scale[0];
-        translate[1] = -1.0f - draw_data->DisplayPos.y * scale[1];
-        vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 0, sizeof(float) * 2, scale);
-        vkCmdPushConstants(command_buffer, bd->PipelineLayout, VK_SHADER_STAGE_VERTEX_BIT, sizeof(float) * 2, sizeof(float) * 2, translate);
+        VkImageMemoryBarrier copy_barrier[1] = {};
+        copy_barrier[0].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        copy_barrier[0].srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        copy_barrier[0].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        copy_barrier[0].oldLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        copy_barrier[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        copy_barrier[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        copy_barrier[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        copy_barrier[0].image = bd->FontImage;
+        copy_barrier[0].subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        copy_barrier[0].subresourceRange.levelCount = 1;
+        copy_barrier[0].subresourceRange.layerCount = 1;
+        vkCmdPipelineBarrier(bd->FontCommandBuffer, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_HOST_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, copy_barrier);
+
+        vkCmdCopyBufferToImage(bd->FontCommandBuffer, upload_buffer, bd->FontImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (uint32_t)regions.Size, regions.Data);
+
+        VkImageMemoryBarrier use_barrier[1] = {};
+        use_barrier[0].sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        use_barrier[0].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        use_barrier[0].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        use_barrier[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        use_barrier[0].newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        use_barrier[0].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        use_barrier[0].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        use_barrier[0].image = bd->FontImage;
+        use_barrier[0].subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        use_barrier[0].subresourceRange.levelCount = 1;
+        use_barrier[0].subresourceRange.layerCount = 1;
+        vkCmdPipelineBarrier(bd->FontCommandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 1, use_barrier);
     }
+    VkSubmitInfo end_info = {};
+    end_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    end_info.commandBufferCount = 1;
+    end_info.pCommandBuffers = &bd->FontCommandBuffer;
+    err = vkEndCommandBuffer(bd->FontCommandBuffer);
+    check_vk_result(err);
+    err = vkQueueSubmit(v->Queue, 1, &end_info, VK_NULL_HANDLE);
+    check_vk_result(err);
+    err = vkQueueWaitIdle(v->Queue);
+    check_vk_result(err);
+
+    vkDestroyBuffer(v->Device, upload_buffer, v->Allocator);
+    vkFreeMemory(v->Device, upload_buffer_memory, v->Allocator);
+    atlas->TexUpdates.resize(0);
 }
 
-// Render function
 void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer command_buffer, VkPipeline pipeline)
 {
     // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
@@ -485,6 +828,7 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
     ImGui_ImplVulkan_InitInfo* v = &bd->VulkanInitInfo;
     if (pipeline == VK_NULL_HANDLE)
         pipeline = bd->Pipeline;
+    ImGui_ImplVulkan_UpdateFontsTexture();
 
     // Allocate array to store enough vertex/index buffers
     ImGui_ImplVulkan_WindowRenderBuffers* wrb = &bd->MainWindowRenderBuffers;
@@ -510,8 +854,9 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
             CreateOrResizeBuffer(rb->IndexBuffer, rb->IndexBufferMemory, rb->IndexBufferSize, index_size, VK_BUFFER_USAGE_INDEX_BUFFER_BIT);
 
         // Upload vertex/index data into a single contiguous GPU buffer
+        // (indices of each draw list are aligned on sizeof(ImDrawIdx) as required by vkCmdBindIndexBuffer(), as their size may vary, see ImGuiBackendFlags_RendererHasPackedIdx)
         ImDrawVert* vtx_dst = nullptr;
-        ImDrawIdx* idx_dst = nullptr;
+        char* idx_dst = nullptr;
         VkResult err = vkMapMemory(v->Device, rb->VertexBufferMemory, 0, vertex_size, 0, (void**)&vtx_dst);
         check_vk_result(err);
         err = vkMapMemory(v->Device, rb->IndexBufferMemory, 0, index_size, 0, (void**)&idx_dst);
@@ -520,9 +865,9 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
         {
             const ImDrawList* cmd_list = draw_data->CmdLists[n];
             memcpy(vtx_dst, cmd_list->VtxBuffer.Data, cmd_list->VtxBuffer.Size * sizeof(ImDrawVert));
-            memcpy(idx_dst, cmd_list->IdxBuffer.Data, cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+            memcpy(idx_dst, cmd_list->IdxBuffer.Data, cmd_list->IdxBuffer.Size * cmd_list->IdxSize);
             vtx_dst += cmd_list->VtxBuffer.Size;
-            idx_dst += cmd_list->IdxBuffer.Size;
+            idx_dst += AlignBufferSize(cmd_list->IdxBuffer.Size * cmd_list->IdxSize, sizeof(ImDrawIdx));
         }
         VkMappedMemoryRange range[2] = {};
         range[0].sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
@@ -537,6 +882,33 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
         vkUnmapMemory(v->Device, rb->IndexBufferMemory);
     }
 
+    // Upload rectangle instances into a single contiguous GPU buffer (see ImGuiBackendFlags_RendererHasRectInstances)
+    int total_rect_count = 0;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+        total_rect_count += draw_data->CmdLists[n]->RectBuffer.Size;
+    if (total_rect_count > 0)
+    {
+        size_t rect_size = AlignBufferSize(total_rect_count * sizeof(ImDrawRectInstance), bd->BufferMemoryAlignment);
+        if (rb->RectBuffer == VK_NULL_HANDLE || rb->RectBufferSize < rect_size)
+            CreateOrResizeBuffer(rb->RectBuffer, rb->RectBufferMemory, rb->RectBufferSize, rect_size, VK_BUFFER_USAGE_VERTEX_BUFFER_BIT);
+        ImDrawRectInstance* rect_dst = nullptr;
+        VkResult err = vkMapMemory(v->Device, rb->RectBufferMemory, 0, rect_size, 0, (void**)&rect_dst);
+        check_vk_result(err);
+        for (int n = 0; n < draw_data->CmdListsCount; n++)
+        {
+            const ImDrawList* cmd_list = draw_data->CmdLists[n];
+            memcpy(rect_dst, cmd_list->RectBuffer.Data, cmd_list->RectBuffer.Size * sizeof(ImDrawRectInstance));
+            rect_dst += cmd_list->RectBuffer.Size;
+        }
+        VkMappedMemoryRange range = {};
+        range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+        range.memory = rb->RectBufferMemory;
+        range.size = VK_WHOLE_SIZE;
+        err = vkFlushMappedMemoryRanges(v->Device, 1, &range);
+        check_vk_result(err);
+        vkUnmapMemory(v->Device, rb->RectBufferMemory);
+    }
+
     // Setup desired Vulkan state
     ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
 
@@ -546,11 +918,18 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
 
     // Render command lists
     // (Because we merged all buffers into a single one, we maintain our own offset into them)
+    // (Index buffer is bound for each draw list, as the index size may vary between draw lists)
+    // (Rectangle instances are drawn with RectPipeline, we switch pipelines when alternating between triangles and rectangles)
     int global_vtx_offset = 0;
-    int global_idx_offset = 0;
+    int global_rect_offset = 0;
+    VkDeviceSize global_idx_byte_offset = 0;
+    bool rect_pipeline_bound = false;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        const VkIndexType idx_type = (cmd_list->IdxSize == 2) ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+        if (cmd_list->IdxBuffer.Size > 0)
+            vkCmdBindIndexBuffer(command_buffer, rb->IndexBuffer, global_idx_byte_offset, idx_type);
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
             const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
@@ -559,7 +938,12 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplVulkan_SetupRenderState(draw_data, pipeline, command_buffer, rb, fb_width, fb_height);
+                    rect_pipeline_bound = false;
+                    if (cmd_list->IdxBuffer.Size > 0)
+                        vkCmdBindIndexBuffer(command_buffer, rb->IndexBuffer, global_idx_byte_offset, idx_type);
+                }
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
             }
@@ -595,12 +979,36 @@ void ImGui_ImplVulkan_RenderDrawData(ImDrawData* draw_data, VkCommandBuffer comm
                 }
                 vkCmdBindDescriptorSets(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->PipelineLayout, 0, 1, desc_set, 0, nullptr);
 
+                // Draw rectangle instances: 4 vertices triangle strip per instance, expanded and shaded by RectPipeline
+                if (pcmd->RectCount != 0)
+                {
+                    if (!rect_pipeline_bound)
+                    {
+                        vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, bd->RectPipeline);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+                        ImGui_ImplVulkan_SetupScaleTranslate(draw_data, command_buffer, 1.0f); // Instances store positions as floats
+#endif
+                        rect_pipeline_bound = true;
+                    }
+                    vkCmdDraw(command_buffer, 4, pcmd->RectCount, 0, pcmd->RectOffset + global_rect_offset);
+                    continue;
+                }
+                if (rect_pipeline_bound)
+                {
+                    vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+                    ImGui_ImplVulkan_SetupScaleTranslate(draw_data, command_buffer, 1.0f / IM_DRAWVERT_POS_SCALE);
+#endif
+                    rect_pipeline_bound = false;
+                }
+
                 // Draw
-                vkCmdDrawIndexed(command_buffer, pcmd->ElemCount, 1, pcmd->IdxOffset + global_idx_offset, pcmd->VtxOffset + global_vtx_offset, 0);
+                vkCmdDrawIndexed(command_buffer, pcmd->ElemCount, 1, pcmd->IdxOffset, pcmd->VtxOffset + global_vtx_offset, 0);
             }
         }
-        global_idx_offset += cmd_list->IdxBuffer.Size;
+        global_idx_byte_offset += AlignBufferSize(cmd_list->IdxBuffer.Size * cmd_list->IdxSize, sizeof(ImDrawIdx));
         global_vtx_offset += cmd_list->VtxBuffer.Size;
+        global_rect_offset += cmd_list->RectBuffer.Size;
     }
 
     // Note: at this point both vkCmdSetViewport() and vkCmdSetScissor() have been called.
@@ -850,9 +1258,28 @@ static void ImGui_ImplVulkan_CreateShaderModules(VkDevice device, const VkAlloca
         VkResult err = vkCreateShaderModule(device, &frag_info, allocator, &bd->ShaderModuleFrag);
         check_vk_result(err);
     }
+    if (bd->ShaderModuleRectVert == VK_NULL_HANDLE)
+    {
+        VkShaderModuleCreateInfo vert_info = {};
+        vert_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        vert_info.codeSize = sizeof(__glsl_shader_rect_vert_spv);
+        vert_info.pCode = (uint32_t*)__glsl_shader_rect_vert_spv;
+        VkResult err = vkCreateShaderModule(device, &vert_info, allocator, &bd->ShaderModuleRectVert);
+        check_vk_result(err);
+    }
+    if (bd->ShaderModuleRectFrag == VK_NULL_HANDLE)
+    {
+        VkShaderModuleCreateInfo frag_info = {};
+        frag_info.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+        frag_info.codeSize = sizeof(__glsl_shader_rect_frag_spv);
+        frag_info.pCode = (uint32_t*)__glsl_shader_rect_frag_spv;
+        VkResult err = vkCreateShaderModule(device, &frag_info, allocator, &bd->ShaderModuleRectFrag);
+        check_vk_result(err);
+    }
 }
 
-static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationCallbacks* allocator, VkPipelineCache pipelineCache, VkRenderPass renderPass, VkSampleCountFlagBits MSAASamples, VkPipeline* pipeline, uint32_t subpass)
+// 'rect_instances == true' creates the pipeline expanding ImDrawRectInstance (read from vertex buffer binding 1), instead of the one drawing ImDrawVert triangles.
+static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationCallbacks* allocator, VkPipelineCache pipelineCache, VkRenderPass renderPass, VkSampleCountFlagBits MSAASamples, VkPipeline* pipeline, uint32_t subpass, bool rect_instances)
 {
     ImGui_ImplVulkan_Data* bd = ImGui_ImplVulkan_GetBackendData();
     ImGui_ImplVulkan_CreateShaderModules(device, allocator);
@@ -860,11 +1287,11 @@ static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationC
     VkPipelineShaderStageCreateInfo stage[2] = {};
     stage[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     stage[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
-    stage[0].module = bd->ShaderModuleVert;
+    stage[0].module = rect_instances ? bd->ShaderModuleRectVert : bd->ShaderModuleVert;
     stage[0].pName = "main";
     stage[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
     stage[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
-    stage[1].module = bd->ShaderModuleFrag;
+    stage[1].module = rect_instances ? bd->ShaderModuleRectFrag : bd->ShaderModuleFrag;
     stage[1].pName = "main";
 
     VkVertexInputBindingDescription binding_desc[1] = {};
@@ -874,27 +1301,58 @@ static void ImGui_ImplVulkan_CreatePipeline(VkDevice device, const VkAllocationC
     VkVertexInputAttributeDescription attribute_desc[3] = {};
     attribute_desc[0].location = 0;
     attribute_desc[0].binding = binding_desc[0].binding;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    attribute_desc[0].format = VK_FORMAT_R16G16_SSCALED;    // Fixed-point, divided by IM_DRAWVERT_POS_SCALE in the push constant scale
+#else
     attribute_desc[0].format = VK_FORMAT_R32G32_SFLOAT;
+#endif
     attribute_desc[0].offset = offsetof(ImDrawVert, pos);
     attribute_desc[1].location = 1;
     attribute_desc[1].binding = binding_desc[0].binding;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    attribute_desc[1].format = VK_FORMAT_R16G16_UNORM;
+#else
     attribute_desc[1].format = VK_FORMAT_R32G32_SFLOAT;
+#endif
     attribute_desc[1].offset = offsetof(ImDrawVert, uv);
     attribute_desc[2].location = 2;
     attribute_desc[2].binding = binding_desc[0].binding;
     attribute_desc[2].format = VK_FORMAT_R8G8B8A8_UNORM;
     attribute_desc[2].offset = offsetof(ImDrawVert, col);
 
+    VkVertexInputBindingDescription rect_binding_desc[1] = {};
+    rect_binding_desc[0].binding = 1;
+    rect_binding_desc[0].stride = sizeof(ImDrawRectInstance);
+    rect_binding_desc[0].inputRate = VK_VERTEX_INPUT_RATE_INSTANCE;
+
+    VkVertexInputAttributeDescription rect_attribute_desc[4] = {};
+    rect_attribute_desc[0].location = 0;
+    rect_attribute_desc[0].binding = rect_binding_desc[0].binding;
+    rect_attribute_desc[0].format = VK_FORMAT_R32G32B32A32_SFLOAT; // Min, Max
+    rect_attribute_desc[0].offset = offsetof(ImDrawRectInstance, Min);
+    rect_attribute_desc[1].location = 1;
+    rect_attribute_desc[1].binding = rect_binding_desc[0].binding;
+    rect_attribute_desc[1].format = VK_FORMAT_R8G8B8A8_UNORM;
+    rect_attribute_desc[1].offset = offsetof(ImDrawRectInstance, Col);
+    rect_attribute_desc[2].location = 2;
+    rect_attribute_desc[2].binding = rect_binding_desc[0].binding;
+    rect_attribute_desc[2].format = VK_FORMAT_R32G32_SFLOAT;      // Rounding, Thickness
+    rect_attribute_desc[2].offset = offsetof(ImDrawRectInstance, Rounding);
+    rect_attribute_desc[3].location = 3;
+    rect_attribute_desc[3].binding = rect_binding_desc[0].binding;
+    rect_attribute_desc[3].format = VK_FORMAT_R32_UINT;
+    rect_attribute_desc[3].offset = offsetof(ImDrawRectInstance, Flags);
+
     VkPipelineVertexInputStateCreateInfo vertex_info = {};
     vertex_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
     vertex_info.vertexBindingDescriptionCount = 1;
-    vertex_info.pVertexBindingDescriptions = binding_desc;
-    vertex_info.vertexAttributeDescriptionCount = 3;
-    vertex_info.pVertexAttributeDescriptions = attribute_desc;
+    vertex_info.pVertexBindingDescriptions = rect_instances ? rect_binding_desc : binding_desc;
+    vertex_info.vertexAttributeDescriptionCount = rect_instances ? 4 : 3;
+    vertex_info.pVertexAttributeDescriptions = rect_instances ? rect_attribute_desc : attribute_desc;
 
     VkPipelineInputAssemblyStateCreateInfo ia_info = {};
     ia_info.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-    ia_info.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    ia_info.topology = rect_instances ? VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP : VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
 
     VkPipelineViewportStateCreateInfo viewport_info = {};
     viewport_info.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
@@ -1023,7 +1481,8 @@ bool ImGui_ImplVulkan_CreateDeviceObjects()
         check_vk_result(err);
     }
 
-    ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, v->RenderPass, v->MSAASamples, &bd->Pipeline, v->Subpass);
+    ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, v->RenderPass, v->MSAASamples, &bd->Pipeline, v->Subpass, false);
+    ImGui_ImplVulkan_CreatePipeline(v->Device, v->Allocator, v->PipelineCache, v->RenderPass, v->MSAASamples, &bd->RectPipeline, v->Subpass, true);
 
     return true;
 }
@@ -1039,10 +1498,13 @@ void    ImGui_ImplVulkan_DestroyDeviceObjects()
     if (bd->FontCommandPool)      { vkDestroyCommandPool(v->Device, bd->FontCommandPool, v->Allocator); bd->FontCommandPool = VK_NULL_HANDLE; }
     if (bd->ShaderModuleVert)     { vkDestroyShaderModule(v->Device, bd->ShaderModuleVert, v->Allocator); bd->ShaderModuleVert = VK_NULL_HANDLE; }
     if (bd->ShaderModuleFrag)     { vkDestroyShaderModule(v->Device, bd->ShaderModuleFrag, v->Allocator); bd->ShaderModuleFrag = VK_NULL_HANDLE; }
+    if (bd->ShaderModuleRectVert) { vkDestroyShaderModule(v->Device, bd->ShaderModuleRectVert, v->Allocator); bd->ShaderModuleRectVert = VK_NULL_HANDLE; }
+    if (bd->ShaderModuleRectFrag) { vkDestroyShaderModule(v->Device, bd->ShaderModuleRectFrag, v->Allocator); bd->ShaderModuleRectFrag = VK_NULL_HANDLE; }
     if (bd->FontSampler)          { vkDestroySampler(v->Device, bd->FontSampler, v->Allocator); bd->FontSampler = VK_NULL_HANDLE; }
     if (bd->DescriptorSetLayout)  { vkDestroyDescriptorSetLayout(v->Device, bd->DescriptorSetLayout, v->Allocator); bd->DescriptorSetLayout = VK_NULL_HANDLE; }
     if (bd->PipelineLayout)       { vkDestroyPipelineLayout(v->Device, bd->PipelineLayout, v->Allocator); bd->PipelineLayout = VK_NULL_HANDLE; }
     if (bd->Pipeline)             { vkDestroyPipeline(v->Device, bd->Pipeline, v->Allocator); bd->Pipeline = VK_NULL_HANDLE; }
+    if (bd->RectPipeline)         { vkDestroyPipeline(v->Device, bd->RectPipeline, v->Allocator); bd->RectPipeline = VK_NULL_HANDLE; }
 }
 
 bool    ImGui_ImplVulkan_LoadFunctions(PFN_vkVoidFunction(*loader_func)(const char* function_name, void* user_data), void* user_data)
@@ -1100,6 +1562,10 @@ bool    ImGui_ImplVulkan_Init(ImGui_ImplVulkan_InitInfo* info)
     io.BackendRendererUserData = (void*)bd;
     io.BackendRendererName = "imgui_impl_vulkan";
     io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+    if (sizeof(ImDrawIdx) == 4)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasPackedIdx;  // We can honor the ImDrawList::IdxSize field, allowing for 16-bit index buffers in small draw lists.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasTexUpdates;     // We can upload ImFontAtlas::TexUpdates[], allowing ImFontAtlasFlags_DynamicGlyphs.
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasRectInstances;  // We can honor ImDrawCmd::RectCount, expanding rectangles on GPU with RectPipeline.
 
     IM_ASSERT(info->Instance != VK_NULL_HANDLE);
     IM_ASSERT(info->PhysicalDevice != VK_NULL_HANDLE);
@@ -1127,7 +1593,7 @@ void ImGui_ImplVulkan_Shutdown()
     ImGui_ImplVulkan_DestroyDeviceObjects();
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
-    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    io.BackendFlags &= ~(ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasPackedIdx | ImGuiBackendFlags_RendererHasTexUpdates | ImGuiBackendFlags_RendererHasRectInstances);
     IM_DELETE(bd);
 }
 
@@ -1203,8 +1669,11 @@ void ImGui_ImplVulkan_DestroyFrameRenderBuffers(VkDevice device, ImGui_ImplVulka
     if (buffers->VertexBufferMemory) { vkFreeMemory(device, buffers->VertexBufferMemory, allocator); buffers->VertexBufferMemory = VK_NULL_HANDLE; }
     if (buffers->IndexBuffer) { vkDestroyBuffer(device, buffers->IndexBuffer, allocator); buffers->IndexBuffer = VK_NULL_HANDLE; }
     if (buffers->IndexBufferMemory) { vkFreeMemory(device, buffers->IndexBufferMemory, allocator); buffers->IndexBufferMemory = VK_NULL_HANDLE; }
+    if (buffers->RectBuffer) { vkDestroyBuffer(device, buffers->RectBuffer, allocator); buffers->RectBuffer = VK_NULL_HANDLE; }
+    if (buffers->RectBufferMemory) { vkFreeMemory(device, buffers->RectBufferMemory, allocator); buffers->RectBufferMemory = VK_NULL_HANDLE; }
     buffers->VertexBufferSize = 0;
     buffers->IndexBufferSize = 0;
+    buffers->RectBufferSize = 0;
 }
 
 void ImGui_ImplVulkan_DestroyWindowRenderBuffers(VkDevice device, ImGui_ImplVulkan_WindowRenderBuffers* buffers, const VkAllocationCallbacks* allocator)
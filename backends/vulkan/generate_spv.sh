@@ -4,3 +4,5 @@
 ## -o: output file
 glslangValidator -V -x -o glsl_shader.frag.u32 glsl_shader.frag
 glslangValidator -V -x -o glsl_shader.vert.u32 glsl_shader.vert
+glslangValidator -V -x -o glsl_shader_rect.frag.u32 glsl_shader_rect.frag
+glslangValidator -V -x -o glsl_shader_rect.vert.u32 glsl_shader_rect.vert
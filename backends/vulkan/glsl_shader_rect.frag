@@ -0,0 +1,20 @@
+#version 450 core
+layout(location = 0) out vec4 fColor;
+
+layout(location = 0) in vec2 Pos;
+layout(location = 1) flat in vec2 HalfSize;
+layout(location = 2) flat in vec4 Radius;
+layout(location = 3) flat in vec2 StrokeAA;
+layout(location = 4) flat in vec4 Color;
+
+void main()
+{
+    vec2 radius_y = (Pos.y < 0.0) ? Radius.xy : Radius.zw;
+    float radius = (Pos.x < 0.0) ? radius_y.x : radius_y.y;
+    vec2 q = abs(Pos) - HalfSize + radius;
+    float d = (radius > 0.0) ? length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - radius : max(q.x, q.y);
+    if (StrokeAA.x > 0.0)
+        d = abs(d) - StrokeAA.x * 0.5;
+    float coverage = (StrokeAA.y > 0.5) ? clamp(0.5 - d, 0.0, 1.0) : ((d < 0.0) ? 1.0 : 0.0);
+    fColor = vec4(Color.rgb, Color.a * coverage);
+}
@@ -0,0 +1,33 @@
+#version 450 core
+layout(location = 0) in vec4 aMinMax;
+layout(location = 1) in vec4 aColor;
+layout(location = 2) in vec2 aParams;
+layout(location = 3) in uint aFlags;
+
+layout(push_constant) uniform uPushConstant {
+    vec2 uScale;
+    vec2 uTranslate;
+} pc;
+
+out gl_PerVertex {
+    vec4 gl_Position;
+};
+
+layout(location = 0) out vec2 Pos;
+layout(location = 1) flat out vec2 HalfSize;
+layout(location = 2) flat out vec4 Radius;
+layout(location = 3) flat out vec2 StrokeAA;
+layout(location = 4) flat out vec4 Color;
+
+void main()
+{
+    vec4 corners = vec4((uvec4(aFlags) >> uvec4(0, 1, 2, 3)) & uvec4(1));
+    vec2 half_size = (aMinMax.zw - aMinMax.xy) * 0.5;
+    vec2 quad = vec2(float(gl_VertexIndex & 1), float(gl_VertexIndex >> 1)) * 2.0 - 1.0;
+    Pos = quad * (half_size + aParams.y * 0.5 + 1.0);
+    HalfSize = half_size;
+    Radius = corners * aParams.x;
+    StrokeAA = vec2(aParams.y, float((aFlags >> 4) & 1));
+    Color = aColor;
+    gl_Position = vec4(((aMinMax.xy + aMinMax.zw) * 0.5 + Pos) * pc.uScale + pc.uTranslate, 0, 1);
+}
@@ -126,6 +126,17 @@ int main(int, char**)
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application, or clear/overwrite your copy of the mouse data.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+        // We sleep until new events arrive or until dear imgui needs a new frame (e.g. for an animation), see ImGui::GetNextFrameDelay().
+        // Remove this if your application needs to update every frame. GLFW gamepads are polled, so we keep polling them at 20 Hz.
+#ifndef __EMSCRIPTEN__
+        float next_frame_delay = ImGui::GetNextFrameDelay();
+        if ((io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad) && next_frame_delay > 0.05f)
+            next_frame_delay = 0.05f;
+        if (next_frame_delay == FLT_MAX)
+            glfwWaitEvents();
+        else if (next_frame_delay > 0.0f)
+            glfwWaitEventsTimeout(next_frame_delay);
+#endif
         glfwPollEvents();
 
         // Start the Dear ImGui frame
@@ -0,0 +1,599 @@
+// Dear ImGui: headless benchmark of ImDrawList primitives (see ImDrawList::AddPolyline(), ImDrawList::PathArcTo(), ImDrawList::AddConcavePolyFilled())
+// (compile and link imgui, fill a draw list with generated shapes, compare with reference implementations)
+// It prints the throughput of anti-aliased polylines against a reference scalar implementation, and whether output is identical.
+// It prints the cost of circle, arc and ellipse paths with radii from 2 to 2000 px against per-vertex ImCos()/ImSin() calls,
+// and checks that their error against a double precision reference is not larger (within float precision).
+// It prints the cost of AddConcavePolyFilled() on generated polygons against a reference ear-clipping triangulation,
+// and checks that both output points_count - 2 triangles covering the polygon area.
+// Usage:
+//   example_null_drawlist [--repeat N]
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <random>
+#include <vector>
+
+static double GetTimeMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+static bool IsDrawListIdentical(const ImDrawList* a, const ImDrawList* b)
+{
+    return a->VtxBuffer.Size == b->VtxBuffer.Size && a->IdxBuffer.Size == b->IdxBuffer.Size && a->CmdBuffer.Size == b->CmdBuffer.Size
+        && memcmp(a->VtxBuffer.Data, b->VtxBuffer.Data, (size_t)a->VtxBuffer.Size * sizeof(ImDrawVert)) == 0
+        && memcmp(a->IdxBuffer.Data, b->IdxBuffer.Data, (size_t)a->IdxBuffer.Size * sizeof(ImDrawIdx)) == 0;
+}
+
+//-----------------------------------------------------------------------------
+// Polylines
+//-----------------------------------------------------------------------------
+
+// Same as in imgui_draw.cpp
+#define IM_NORMALIZE2F_OVER_ZERO(VX,VY)     { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = ImRsqrt(d2); VX *= inv_len; VY *= inv_len; } } (void)0
+#define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f
+#define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
+
+// Reference: anti-aliased path of ImDrawList::AddPolyline() computing normals and edge points one point at a time.
+static void AddPolylineReference(ImDrawList* draw_list, const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
+{
+    static ImVector<ImVec2> temp_buffer;
+    IM_ASSERT(draw_list->Flags & ImDrawListFlags_AntiAliasedLines);
+    const bool closed = (flags & ImDrawFlags_Closed) != 0;
+    const ImVec2 opaque_uv = draw_list->_Data->TexUvWhitePixel;
+    const int count = closed ? points_count : points_count - 1;
+    const bool thick_line = (thickness > draw_list->_FringeScale);
+    const float AA_SIZE = draw_list->_FringeScale;
+    const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+    thickness = ImMax(thickness, 1.0f);
+    const int integer_thickness = (int)thickness;
+    const float fractional_thickness = thickness - integer_thickness;
+    const bool use_texture = (draw_list->Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
+    const int idx_count = use_texture ? (count * 6) : (thick_line ? count * 18 : count * 12);
+    const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
+    draw_list->PrimReserve(idx_count, vtx_count);
+
+    temp_buffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
+    ImVec2* temp_normals = temp_buffer.Data;
+    ImVec2* temp_points = temp_normals + points_count;
+    for (int i1 = 0; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        temp_normals[i1].x = dy;
+        temp_normals[i1].y = -dx;
+    }
+    if (!closed)
+        temp_normals[points_count - 1] = temp_normals[points_count - 2];
+
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    unsigned int idx1 = draw_list->_VtxCurrentIdx;
+    if (use_texture || !thick_line)
+    {
+        const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
+        if (!closed)
+        {
+            temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
+            temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
+            temp_points[(points_count - 1) * 2 + 0] = points[points_count - 1] + temp_normals[points_count - 1] * half_draw_size;
+            temp_points[(points_count - 1) * 2 + 1] = points[points_count - 1] - temp_normals[points_count - 1] * half_draw_size;
+        }
+        for (int i1 = 0; i1 < count; i1++)
+        {
+            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+            const unsigned int idx2 = ((i1 + 1) == points_count) ? draw_list->_VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3));
+            float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
+            float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+            dm_x *= half_draw_size;
+            dm_y *= half_draw_size;
+            ImVec2* out_vtx = &temp_points[i2 * 2];
+            out_vtx[0].x = points[i2].x + dm_x;
+            out_vtx[0].y = points[i2].y + dm_y;
+            out_vtx[1].x = points[i2].x - dm_x;
+            out_vtx[1].y = points[i2].y - dm_y;
+            if (use_texture)
+            {
+                idx_write[0] = (ImDrawIdx)(idx2 + 0); idx_write[1] = (ImDrawIdx)(idx1 + 0); idx_write[2] = (ImDrawIdx)(idx1 + 1);
+                idx_write[3] = (ImDrawIdx)(idx2 + 1); idx_write[4] = (ImDrawIdx)(idx1 + 1); idx_write[5] = (ImDrawIdx)(idx2 + 0);
+                idx_write += 6;
+            }
+            else
+            {
+                idx_write[0] = (ImDrawIdx)(idx2 + 0); idx_write[1] = (ImDrawIdx)(idx1 + 0); idx_write[2] = (ImDrawIdx)(idx1 + 2);
+                idx_write[3] = (ImDrawIdx)(idx1 + 2); idx_write[4] = (ImDrawIdx)(idx2 + 2); idx_write[5] = (ImDrawIdx)(idx2 + 0);
+                idx_write[6] = (ImDrawIdx)(idx2 + 1); idx_write[7] = (ImDrawIdx)(idx1 + 1); idx_write[8] = (ImDrawIdx)(idx1 + 0);
+                idx_write[9] = (ImDrawIdx)(idx1 + 0); idx_write[10] = (ImDrawIdx)(idx2 + 0); idx_write[11] = (ImDrawIdx)(idx2 + 1);
+                idx_write += 12;
+            }
+            idx1 = idx2;
+        }
+        if (use_texture)
+        {
+            const ImVec4 tex_uvs = draw_list->_Data->TexUvLines[integer_thickness];
+            const ImVec2 tex_uv0(tex_uvs.x, tex_uvs.y);
+            const ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
+            for (int i = 0; i < points_count; i++, vtx_write += 2)
+            {
+                vtx_write[0].pos = temp_points[i * 2 + 0]; vtx_write[0].uv = tex_uv0; vtx_write[0].col = col;
+                vtx_write[1].pos = temp_points[i * 2 + 1]; vtx_write[1].uv = tex_uv1; vtx_write[1].col = col;
+            }
+        }
+        else
+        {
+            for (int i = 0; i < points_count; i++, vtx_write += 3)
+            {
+                vtx_write[0].pos = points[i];              vtx_write[0].uv = opaque_uv; vtx_write[0].col = col;
+                vtx_write[1].pos = temp_points[i * 2 + 0]; vtx_write[1].uv = opaque_uv; vtx_write[1].col = col_trans;
+                vtx_write[2].pos = temp_points[i * 2 + 1]; vtx_write[2].uv = opaque_uv; vtx_write[2].col = col_trans;
+            }
+        }
+    }
+    else
+    {
+        const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
+        if (!closed)
+        {
+            const int points_last = points_count - 1;
+            temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
+            temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
+            temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
+            temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
+            temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
+            temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
+            temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
+            temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
+        }
+        for (int i1 = 0; i1 < count; i1++)
+        {
+            const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1);
+            const unsigned int idx2 = (i1 + 1) == points_count ? draw_list->_VtxCurrentIdx : (idx1 + 4);
+            float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
+            float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+            const float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
+            const float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
+            const float dm_in_x = dm_x * half_inner_thickness;
+            const float dm_in_y = dm_y * half_inner_thickness;
+            ImVec2* out_vtx = &temp_points[i2 * 4];
+            out_vtx[0].x = points[i2].x + dm_out_x;
+            out_vtx[0].y = points[i2].y + dm_out_y;
+            out_vtx[1].x = points[i2].x + dm_in_x;
+            out_vtx[1].y = points[i2].y + dm_in_y;
+            out_vtx[2].x = points[i2].x - dm_in_x;
+            out_vtx[2].y = points[i2].y - dm_in_y;
+            out_vtx[3].x = points[i2].x - dm_out_x;
+            out_vtx[3].y = points[i2].y - dm_out_y;
+            idx_write[0]  = (ImDrawIdx)(idx2 + 1); idx_write[1]  = (ImDrawIdx)(idx1 + 1); idx_write[2]  = (ImDrawIdx)(idx1 + 2);
+            idx_write[3]  = (ImDrawIdx)(idx1 + 2); idx_write[4]  = (ImDrawIdx)(idx2 + 2); idx_write[5]  = (ImDrawIdx)(idx2 + 1);
+            idx_write[6]  = (ImDrawIdx)(idx2 + 1); idx_write[7]  = (ImDrawIdx)(idx1 + 1); idx_write[8]  = (ImDrawIdx)(idx1 + 0);
+            idx_write[9]  = (ImDrawIdx)(idx1 + 0); idx_write[10] = (ImDrawIdx)(idx2 + 0); idx_write[11] = (ImDrawIdx)(idx2 + 1);
+            idx_write[12] = (ImDrawIdx)(idx2 + 2); idx_write[13] = (ImDrawIdx)(idx1 + 2); idx_write[14] = (ImDrawIdx)(idx1 + 3);
+            idx_write[15] = (ImDrawIdx)(idx1 + 3); idx_write[16] = (ImDrawIdx)(idx2 + 3); idx_write[17] = (ImDrawIdx)(idx2 + 2);
+            idx_write += 18;
+            idx1 = idx2;
+        }
+        for (int i = 0; i < points_count; i++, vtx_write += 4)
+        {
+            vtx_write[0].pos = temp_points[i * 4 + 0]; vtx_write[0].uv = opaque_uv; vtx_write[0].col = col_trans;
+            vtx_write[1].pos = temp_points[i * 4 + 1]; vtx_write[1].uv = opaque_uv; vtx_write[1].col = col;
+            vtx_write[2].pos = temp_points[i * 4 + 2]; vtx_write[2].uv = opaque_uv; vtx_write[2].col = col;
+            vtx_write[3].pos = temp_points[i * 4 + 3]; vtx_write[3].uv = opaque_uv; vtx_write[3].col = col_trans;
+        }
+    }
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_VtxCurrentIdx += (ImDrawIdx)vtx_count;
+}
+
+// Plot-like polylines: noisy signals sampled every pixel, alternately open and closed
+static bool BenchPolylines(ImDrawList* draw_list, ImDrawList* draw_list_ref, int repeat_count)
+{
+    const int LINES_COUNT = 10;
+    const int POINTS_COUNT = 10000;
+    std::mt19937 rng(42);
+    std::vector<ImVec2> points((size_t)LINES_COUNT * POINTS_COUNT);
+    for (int line_n = 0; line_n < LINES_COUNT; line_n++)
+    {
+        float y = 500.0f;
+        for (int n = 0; n < POINTS_COUNT; n++)
+        {
+            y += (float)((int)(rng() % 2001) - 1000) * 0.01f;
+            points[(size_t)line_n * POINTS_COUNT + n] = ImVec2((float)n * 0.2f, y + ImSin((float)n * 0.05f) * 40.0f);
+        }
+    }
+
+    struct ConfigDesc { const char* Name; ImDrawListFlags Flags; float Thickness; };
+    const ConfigDesc configs[] =
+    {
+        { "thin, textured", ImDrawListFlags_AntiAliasedLinesUseTex, 1.0f },
+        { "thin",           ImDrawListFlags_None, 1.0f },
+        { "thick",          ImDrawListFlags_None, 2.5f },
+    };
+    bool all_identical = true;
+    for (const ConfigDesc& config : configs)
+    {
+        // Keep best time of each
+        double best_ms = 0.0, best_ref_ms = 0.0;
+        for (int repeat_n = 0; repeat_n < repeat_count; repeat_n++)
+        {
+            for (int ref_n = 0; ref_n < 2; ref_n++)
+            {
+                ImDrawList* dl = ref_n ? draw_list_ref : draw_list;
+                dl->ResetForNewFrame();
+                dl->Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AllowVtxOffset | config.Flags;
+                const double t0 = GetTimeMs();
+                for (int line_n = 0; line_n < LINES_COUNT; line_n++)
+                {
+                    const ImDrawFlags flags = (line_n & 1) ? ImDrawFlags_Closed : ImDrawFlags_None;
+                    if (ref_n)
+                        AddPolylineReference(dl, &points[(size_t)line_n * POINTS_COUNT], POINTS_COUNT, IM_COL32(255, 200, 0, 255), flags, config.Thickness);
+                    else
+                        dl->AddPolyline(&points[(size_t)line_n * POINTS_COUNT], POINTS_COUNT, IM_COL32(255, 200, 0, 255), flags, config.Thickness);
+                }
+                const double t1 = GetTimeMs();
+                double* p_best_ms = ref_n ? &best_ref_ms : &best_ms;
+                *p_best_ms = (repeat_n == 0) ? (t1 - t0) : std::min(*p_best_ms, t1 - t0);
+            }
+        }
+        const bool identical = IsDrawListIdentical(draw_list, draw_list_ref);
+        const double points_total = (double)LINES_COUNT * POINTS_COUNT;
+        printf("- AddPolyline() %-15s %dx%d points: %6.1f Mpts/s, reference %6.1f Mpts/s, speedup %.2fx, %s\n", config.Name, LINES_COUNT, POINTS_COUNT,
+            points_total / (best_ms * 1000.0), points_total / (best_ref_ms * 1000.0), best_ref_ms / best_ms, identical ? "identical" : "MISMATCH");
+        all_identical &= identical;
+    }
+    return all_identical;
+}
+
+//-----------------------------------------------------------------------------
+// Circles, arcs and ellipses
+//-----------------------------------------------------------------------------
+
+// Reference: arc path calling ImCos()/ImSin() for every vertex
+static void PathArcToReference(ImDrawList* draw_list, const ImVec2& center, float radius, float a_min, float a_max, int num_segments)
+{
+    draw_list->_Path.reserve(draw_list->_Path.Size + (num_segments + 1));
+    for (int i = 0; i <= num_segments; i++)
+    {
+        const float a = a_min + ((float)i / (float)num_segments) * (a_max - a_min);
+        draw_list->_Path.push_back(ImVec2(center.x + ImCos(a) * radius, center.y + ImSin(a) * radius));
+    }
+}
+
+// Reference: elliptical arc path calling ImCos()/ImSin() for every vertex
+static void PathEllipticalArcToReference(ImDrawList* draw_list, const ImVec2& center, const ImVec2& radius, float rot, float a_min, float a_max, int num_segments)
+{
+    const float cos_rot = ImCos(rot);
+    const float sin_rot = ImSin(rot);
+    draw_list->_Path.reserve(draw_list->_Path.Size + (num_segments + 1));
+    for (int i = 0; i <= num_segments; i++)
+    {
+        const float a = a_min + ((float)i / (float)num_segments) * (a_max - a_min);
+        const ImVec2 point(ImCos(a) * radius.x, ImSin(a) * radius.y);
+        draw_list->_Path.push_back(ImVec2(center.x + (point.x * cos_rot) - (point.y * sin_rot), center.y + (point.x * sin_rot) + (point.y * cos_rot)));
+    }
+}
+
+// Largest distance of path points to the ellipse (a circle when radius.x == radius.y), in pixels
+static double CalcPathMaxError(const ImVector<ImVec2>& path, const ImVec2& center, const ImVec2& radius, float rot)
+{
+    const double cos_rot = cos((double)rot), sin_rot = sin((double)rot);
+    double max_error = 0.0;
+    for (const ImVec2& p : path)
+    {
+        const double dx = (double)p.x - center.x, dy = (double)p.y - center.y;
+        const double ux = (dx * cos_rot + dy * sin_rot) / radius.x, uy = (dy * cos_rot - dx * sin_rot) / radius.y;
+        max_error = std::max(max_error, fabs(sqrt(ux * ux + uy * uy) - 1.0) * std::min(radius.x, radius.y));
+    }
+    return max_error;
+}
+
+static bool BenchCircles(ImDrawList* draw_list, int repeat_count)
+{
+    enum ShapeType { ShapeType_Circle, ShapeType_Arc, ShapeType_Ellipse };
+    const char* shape_names[] = { "circle", "arc 0.3..2.9", "ellipse" };
+    const ImVec2 center(960.0f, 540.0f);
+    const float radii[] = { 2.0f, 20.0f, 200.0f, 2000.0f };
+    const int SHAPES_COUNT = 2000;
+    bool all_ok = true;
+    for (int shape_type = 0; shape_type < IM_ARRAYSIZE(shape_names); shape_type++)
+        for (float radius : radii)
+        {
+            // Same parameters as AddCircle() with an explicit segment count, PathArcTo() with automatic segment count, AddEllipse()
+            const ImVec2 radius2(radius, shape_type == ShapeType_Ellipse ? radius * 0.5f : radius);
+            const float rot = shape_type == ShapeType_Ellipse ? 0.4f : 0.0f;
+            const int num_segments = draw_list->_CalcCircleAutoSegmentCount(radius);
+            const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
+            const float arc_length = 2.9f - 0.3f;
+            const int arc_segment_count = ImMax((int)ImCeil(num_segments * arc_length / (IM_PI * 2.0f)), (int)(2.0f * IM_PI / arc_length));
+
+            // Keep best time of each, and error of last shape
+            double best_ms = 0.0, best_ref_ms = 0.0, error = 0.0, error_ref = 0.0;
+            for (int repeat_n = 0; repeat_n < repeat_count; repeat_n++)
+            {
+                for (int ref_n = 0; ref_n < 2; ref_n++)
+                {
+                    const double t0 = GetTimeMs();
+                    for (int n = 0; n < SHAPES_COUNT; n++)
+                    {
+                        draw_list->_Path.resize(0);
+                        switch (shape_type)
+                        {
+                        case ShapeType_Circle:
+                            if (ref_n) PathArcToReference(draw_list, center, radius, 0.0f, a_max, num_segments - 1);
+                            else draw_list->PathArcTo(center, radius, 0.0f, a_max, num_segments - 1);
+                            break;
+                        case ShapeType_Arc: // Arcs with a radius under ArcFastRadiusCutoff use ArcFastVtx[], as before
+                            if (ref_n && radius > draw_list->_Data->ArcFastRadiusCutoff) PathArcToReference(draw_list, center, radius, 0.3f, 2.9f, arc_segment_count);
+                            else draw_list->PathArcTo(center, radius, 0.3f, 2.9f, 0);
+                            break;
+                        case ShapeType_Ellipse:
+                            if (ref_n) PathEllipticalArcToReference(draw_list, center, radius2, rot, 0.0f, a_max, num_segments - 1);
+                            else draw_list->PathEllipticalArcTo(center, radius2, rot, 0.0f, a_max, num_segments - 1);
+                            break;
+                        }
+                    }
+                    const double t1 = GetTimeMs();
+                    double* p_best_ms = ref_n ? &best_ref_ms : &best_ms;
+                    *p_best_ms = (repeat_n == 0) ? (t1 - t0) : std::min(*p_best_ms, t1 - t0);
+                    (ref_n ? error_ref : error) = CalcPathMaxError(draw_list->_Path, center, radius2, rot);
+                }
+            }
+            draw_list->_Path.resize(0);
+
+            // Allow one float ulp of difference at these coordinates
+            const bool ok = error <= error_ref + (center.x + radius) * FLT_EPSILON;
+            printf("- %-12s radius %6.0f: %8.1f ns/shape, reference %8.1f ns/shape, speedup %.2fx, max error %.2e px, reference %.2e px, %s\n", shape_names[shape_type], radius,
+                best_ms * 1e6 / SHAPES_COUNT, best_ref_ms * 1e6 / SHAPES_COUNT, best_ref_ms / best_ms, error, error_ref, ok ? "ok" : "LARGER ERROR");
+            all_ok &= ok;
+        }
+    return all_ok;
+}
+
+//-----------------------------------------------------------------------------
+// Concave polygons
+//-----------------------------------------------------------------------------
+
+// Reference: ear-clipping triangulation, same as ImTriangulator in imgui_draw.cpp (used by AddConcavePolyFilled() for small polygons)
+struct EarClipNode
+{
+    enum NodeType { Convex, Ear, Reflex };
+    NodeType        Type;
+    int             Index;
+    ImVec2          Pos;
+    EarClipNode*    Next;
+    EarClipNode*    Prev;
+};
+
+struct EarClipTriangulator
+{
+    std::vector<EarClipNode>    NodesStorage;
+    std::vector<EarClipNode*>   Ears, Reflexes;
+    EarClipNode*                Nodes = nullptr;
+    int                         TrianglesLeft = 0;
+
+    void Init(const ImVec2* points, int points_count)
+    {
+        NodesStorage.resize((size_t)points_count);
+        Ears.clear();
+        Reflexes.clear();
+        Nodes = NodesStorage.data();
+        TrianglesLeft = points_count - 2;
+        for (int i = 0; i < points_count; i++)
+            Nodes[i] = { EarClipNode::Convex, i, points[i], Nodes + (i + 1) % points_count, Nodes + (i + points_count - 1) % points_count };
+        BuildReflexesAndEars();
+    }
+
+    void BuildReflexesAndEars()
+    {
+        EarClipNode* n1 = Nodes;
+        for (int i = TrianglesLeft; i >= 0; i--, n1 = n1->Next)
+            if (!ImTriangleIsClockwise(n1->Prev->Pos, n1->Pos, n1->Next->Pos))
+            {
+                n1->Type = EarClipNode::Reflex;
+                Reflexes.push_back(n1);
+            }
+        n1 = Nodes;
+        for (int i = TrianglesLeft; i >= 0; i--, n1 = n1->Next)
+            if (n1->Type == EarClipNode::Convex && IsEar(n1->Prev, n1, n1->Next))
+            {
+                n1->Type = EarClipNode::Ear;
+                Ears.push_back(n1);
+            }
+    }
+
+    bool IsEar(const EarClipNode* n0, const EarClipNode* n1, const EarClipNode* n2) const
+    {
+        for (const EarClipNode* reflex : Reflexes)
+            if (reflex != n0 && reflex != n1 && reflex != n2 && ImTriangleContainsPoint(n0->Pos, n1->Pos, n2->Pos, reflex->Pos))
+                return false;
+        return true;
+    }
+
+    static void EraseUnsorted(std::vector<EarClipNode*>& v, EarClipNode* node) { for (size_t i = v.size(); i-- > 0; ) if (v[i] == node) { v[i] = v.back(); v.pop_back(); return; } }
+
+    void ReclassifyNode(EarClipNode* n1)
+    {
+        EarClipNode::NodeType type;
+        if (!ImTriangleIsClockwise(n1->Prev->Pos, n1->Pos, n1->Next->Pos))
+            type = EarClipNode::Reflex;
+        else if (IsEar(n1->Prev, n1, n1->Next))
+            type = EarClipNode::Ear;
+        else
+            type = EarClipNode::Convex;
+        if (type == n1->Type)
+            return;
+        if (n1->Type != EarClipNode::Convex)
+            EraseUnsorted(n1->Type == EarClipNode::Reflex ? Reflexes : Ears, n1);
+        if (type != EarClipNode::Convex)
+            (type == EarClipNode::Reflex ? Reflexes : Ears).push_back(n1);
+        n1->Type = type;
+    }
+
+    void GetNextTriangle(unsigned int out_triangle[3])
+    {
+        if (Ears.empty())
+        {
+            // Flip winding and classify again
+            EarClipNode* node = Nodes;
+            for (int i = TrianglesLeft; i >= 0; i--, node = node->Prev)
+            {
+                std::swap(node->Next, node->Prev);
+                node->Type = EarClipNode::Convex;
+            }
+            Reflexes.clear();
+            BuildReflexesAndEars();
+            if (Ears.empty()) // Degenerated geometry
+                Ears.push_back(Nodes);
+        }
+        EarClipNode* ear = Ears.back();
+        Ears.pop_back();
+        out_triangle[0] = ear->Prev->Index;
+        out_triangle[1] = ear->Index;
+        out_triangle[2] = ear->Next->Index;
+        ear->Next->Prev = ear->Prev;
+        ear->Prev->Next = ear->Next;
+        if (ear == Nodes)
+            Nodes = ear->Next;
+        ReclassifyNode(ear->Prev);
+        ReclassifyNode(ear->Next);
+        TrianglesLeft--;
+    }
+};
+
+// Reference: non anti-aliased path of AddConcavePolyFilled() with ear-clipping only
+static void AddConcavePolyFilledReference(ImDrawList* draw_list, EarClipTriangulator* triangulator, const ImVec2* points, const int points_count, ImU32 col)
+{
+    const ImVec2 uv = draw_list->_Data->TexUvWhitePixel;
+    draw_list->PrimReserve((points_count - 2) * 3, points_count);
+    for (int i = 0; i < points_count; i++, draw_list->_VtxWritePtr++)
+    {
+        draw_list->_VtxWritePtr[0].pos = points[i]; draw_list->_VtxWritePtr[0].uv = uv; draw_list->_VtxWritePtr[0].col = col;
+    }
+    const unsigned int vtx_idx = draw_list->_VtxCurrentIdx;
+    triangulator->Init(points, points_count);
+    unsigned int triangle[3];
+    while (triangulator->TrianglesLeft > 0)
+    {
+        triangulator->GetNextTriangle(triangle);
+        draw_list->_IdxWritePtr[0] = (ImDrawIdx)(vtx_idx + triangle[0]); draw_list->_IdxWritePtr[1] = (ImDrawIdx)(vtx_idx + triangle[1]); draw_list->_IdxWritePtr[2] = (ImDrawIdx)(vtx_idx + triangle[2]);
+        draw_list->_IdxWritePtr += 3;
+    }
+    draw_list->_VtxCurrentIdx += (unsigned int)points_count;
+}
+
+// Check that the draw list holds 'points_count - 2' triangles whose areas sum to the polygon area (overlapping triangles would exceed it)
+static bool CheckTriangulation(const ImDrawList* draw_list, const std::vector<ImVec2>& points)
+{
+    double polygon_area = 0.0;
+    for (size_t i0 = points.size() - 1, i1 = 0; i1 < points.size(); i0 = i1++)
+        polygon_area += (double)points[i0].x * points[i1].y - (double)points[i1].x * points[i0].y;
+    polygon_area = fabs(polygon_area) * 0.5;
+
+    if (draw_list->IdxBuffer.Size != ((int)points.size() - 2) * 3)
+        return false;
+    double triangles_area = 0.0;
+    for (int n = 0; n < draw_list->IdxBuffer.Size; n += 3)
+    {
+        const ImVec2 a = draw_list->VtxBuffer[draw_list->IdxBuffer[n + 0]].pos, b = draw_list->VtxBuffer[draw_list->IdxBuffer[n + 1]].pos, c = draw_list->VtxBuffer[draw_list->IdxBuffer[n + 2]].pos;
+        triangles_area += fabs(((double)b.x - a.x) * ((double)c.y - a.y) - ((double)c.x - a.x) * ((double)b.y - a.y)) * 0.5;
+    }
+    return fabs(triangles_area - polygon_area) <= polygon_area * 1e-4;
+}
+
+static bool BenchConcavePolygons(ImDrawList* draw_list, ImDrawList* draw_list_ref, int repeat_count)
+{
+    // Random radial polygons, like map outlines
+    const int points_counts[] = { 32, 64, 256, 1000, 5000 };
+    std::mt19937 rng(42);
+    EarClipTriangulator triangulator;
+    bool all_ok = true;
+    for (int points_count : points_counts)
+    {
+        std::vector<ImVec2> points((size_t)points_count);
+        for (int n = 0; n < points_count; n++)
+        {
+            const float a = (float)n * IM_PI * 2.0f / (float)points_count;
+            const float r = 400.0f * (0.5f + 0.5f * (float)(rng() % 1001) / 1000.0f);
+            points[n] = ImVec2(500.0f + ImCos(a) * r, 500.0f + ImSin(a) * r);
+        }
+
+        // Keep best time of each. Ear-clipping being quadratic, fewer repeats for large polygons.
+        const int polygon_repeat_count = (points_count >= 1000) ? ImMax(repeat_count / 10, 1) : repeat_count;
+        double best_ms = 0.0, best_ref_ms = 0.0;
+        for (int repeat_n = 0; repeat_n < polygon_repeat_count; repeat_n++)
+        {
+            for (int ref_n = 0; ref_n < 2; ref_n++)
+            {
+                ImDrawList* dl = ref_n ? draw_list_ref : draw_list;
+                dl->ResetForNewFrame();
+                dl->Flags = ImDrawListFlags_None;
+                const double t0 = GetTimeMs();
+                if (ref_n)
+                    AddConcavePolyFilledReference(dl, &triangulator, points.data(), points_count, IM_COL32(0, 200, 255, 255));
+                else
+                    dl->AddConcavePolyFilled(points.data(), points_count, IM_COL32(0, 200, 255, 255));
+                const double t1 = GetTimeMs();
+                double* p_best_ms = ref_n ? &best_ref_ms : &best_ms;
+                *p_best_ms = (repeat_n == 0) ? (t1 - t0) : std::min(*p_best_ms, t1 - t0);
+            }
+        }
+        const bool ok = CheckTriangulation(draw_list, points) && CheckTriangulation(draw_list_ref, points);
+        printf("- AddConcavePolyFilled() %5d points: %10.1f us, ear-clipping reference %10.1f us, speedup %.2fx, %s\n", points_count,
+            best_ms * 1000.0, best_ref_ms * 1000.0, best_ref_ms / best_ms, ok ? "ok" : "BAD TRIANGULATION");
+        all_ok &= ok;
+    }
+    return all_ok;
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    int repeat_count = 20;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--repeat") == 0 && n + 1 < argc)
+            repeat_count = std::max(atoi(argv[++n]), 1);
+        else
+        {
+            printf("Usage: %s [--repeat N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    unsigned char* tex_pixels = nullptr;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    // NewFrame() sets up shared data used by draw lists (e.g. baked lines UVs)
+    ImGui::NewFrame();
+    ImDrawList* draw_list = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+    ImDrawList* draw_list_ref = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+
+    bool all_identical = true;
+    all_identical &= BenchPolylines(draw_list, draw_list_ref, repeat_count);
+    all_identical &= BenchCircles(draw_list, repeat_count);
+    all_identical &= BenchConcavePolygons(draw_list, draw_list_ref, repeat_count);
+
+    IM_DELETE(draw_list);
+    IM_DELETE(draw_list_ref);
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+
+    printf("%s\n", all_identical ? "OK" : "FAILED");
+    return all_identical ? 0 : 1;
+}
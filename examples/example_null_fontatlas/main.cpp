@@ -0,0 +1,170 @@
+// Dear ImGui: headless benchmark of font atlas building, with glyphs rasterized by multiple threads (see ImFontAtlas::BuildWorkersCount)
+// (compile and link imgui, build the same atlas with an increasing number of workers, check that textures are identical)
+// It prints the cost of every build, the speedup over a single worker, and whether output is identical.
+// It then builds the atlas through a cache file (see ImFontAtlas::BuildWithCacheFile()), cold then warm, and checks output is identical.
+// Usage:
+//   example_null_fontatlas [--fonts-dir ../../misc/fonts] [--workers N] [--repeat N] [--cache example_null_fontatlas.cache]
+#include "imgui.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static double GetTimeMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+// Run workers on threads: worker 0 on calling thread, others on new threads.
+// (an application would typically submit them to its existing job system instead)
+static void RunWorkersOnThreads(ImFontAtlas*, void (*worker_func)(void* worker_data, int worker_n), void* worker_data, int workers_count)
+{
+    std::vector<std::thread> threads;
+    for (int worker_n = 1; worker_n < workers_count; worker_n++)
+        threads.emplace_back(worker_func, worker_data, worker_n);
+    worker_func(worker_data, 0);
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+struct AtlasResult
+{
+    double                      BuildMs;
+    int                         Width, Height;
+    int                         GlyphsCount;
+    std::vector<unsigned char>  Pixels;
+    std::vector<ImFontGlyph>    Glyphs;
+};
+
+// Build atlas, or load it from cache file when 'cache_filename' is set
+static bool BuildAtlas(const char* fonts_dir, int workers_count, const char* cache_filename, AtlasResult* result)
+{
+    // A startup-like set of fonts: several faces and sizes, with oversampling and extra ranges
+    static const ImWchar ranges[] = { 0x0020, 0x00FF, 0x0100, 0x024F, 0x0370, 0x03FF, 0x0400, 0x052F, 0x1E00, 0x1EFF, 0x2000, 0x206F, 0 };
+    struct FontDesc { const char* Filename; float Size; int OversampleH; float RasterizerMultiply; };
+    static const FontDesc fonts[] =
+    {
+        { "Roboto-Medium.ttf",      16.0f, 3, 1.0f },
+        { "Roboto-Medium.ttf",      24.0f, 2, 1.0f },
+        { "Roboto-Medium.ttf",      48.0f, 1, 1.0f },
+        { "DroidSans.ttf",          16.0f, 3, 1.2f },
+        { "DroidSans.ttf",          32.0f, 2, 1.0f },
+        { "Cousine-Regular.ttf",    15.0f, 3, 1.0f },
+        { "Cousine-Regular.ttf",    30.0f, 2, 1.0f },
+        { "Karla-Regular.ttf",      18.0f, 3, 1.0f },
+        { "Karla-Regular.ttf",      64.0f, 1, 1.0f },
+        { "ProggyClean.ttf",        13.0f, 1, 1.0f },
+        { "ProggyTiny.ttf",         10.0f, 1, 1.0f },
+    };
+
+    ImFontAtlas atlas;
+    atlas.BuildWorkersCount = workers_count;
+    atlas.BuildRunWorkersFunc = RunWorkersOnThreads;
+    for (const FontDesc& desc : fonts)
+    {
+        char filename[512];
+        snprintf(filename, sizeof(filename), "%s/%s", fonts_dir, desc.Filename);
+        ImFontConfig cfg;
+        cfg.OversampleH = desc.OversampleH;
+        cfg.RasterizerMultiply = desc.RasterizerMultiply;
+        if (atlas.AddFontFromFileTTF(filename, desc.Size, &cfg, ranges) == nullptr)
+        {
+            fprintf(stderr, "Error: cannot load '%s'\n", filename);
+            return false;
+        }
+    }
+
+    const double t0 = GetTimeMs();
+    const bool ok = cache_filename ? atlas.BuildWithCacheFile(cache_filename) : atlas.Build();
+    result->BuildMs = GetTimeMs() - t0;
+    if (!ok)
+        return false;
+    unsigned char* pixels;
+    atlas.GetTexDataAsAlpha8(&pixels, &result->Width, &result->Height);
+    result->Pixels.assign(pixels, pixels + result->Width * result->Height);
+    result->Glyphs.clear();
+    for (ImFont* font : atlas.Fonts)
+        result->Glyphs.insert(result->Glyphs.end(), font->Glyphs.begin(), font->Glyphs.end());
+    result->GlyphsCount = (int)result->Glyphs.size();
+    return true;
+}
+
+static bool IsIdentical(const AtlasResult& a, const AtlasResult& b)
+{
+    return a.Width == b.Width && a.Height == b.Height && a.Pixels == b.Pixels && a.Glyphs.size() == b.Glyphs.size()
+        && (a.Glyphs.empty() || memcmp(a.Glyphs.data(), b.Glyphs.data(), a.Glyphs.size() * sizeof(ImFontGlyph)) == 0);
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    const char* fonts_dir = "../../misc/fonts";
+    int max_workers = std::max((int)std::thread::hardware_concurrency(), 4);
+    int repeat_count = 5;
+    const char* cache_filename = "example_null_fontatlas.cache";
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--fonts-dir") == 0 && n + 1 < argc)
+            fonts_dir = argv[++n];
+        else if (strcmp(argv[n], "--workers") == 0 && n + 1 < argc)
+            max_workers = std::max(atoi(argv[++n]), 1);
+        else if (strcmp(argv[n], "--repeat") == 0 && n + 1 < argc)
+            repeat_count = std::max(atoi(argv[++n]), 1);
+        else if (strcmp(argv[n], "--cache") == 0 && n + 1 < argc)
+            cache_filename = argv[++n];
+        else
+        {
+            printf("Usage: %s [--fonts-dir ../../misc/fonts] [--workers N] [--repeat N] [--cache example_null_fontatlas.cache]\n", argv[0]);
+            return 1;
+        }
+    }
+    printf("Hardware threads: %u\n", std::thread::hardware_concurrency());
+
+    // Build with 1, 2, 4... workers, keep best time of each
+    std::vector<int> workers_counts;
+    for (int workers_count = 1; workers_count < max_workers; workers_count *= 2)
+        workers_counts.push_back(workers_count);
+    workers_counts.push_back(max_workers);
+    AtlasResult reference;
+    bool all_identical = true;
+    double reference_ms = 0.0;
+    for (int workers_count : workers_counts)
+    {
+        double best_ms = 0.0;
+        bool identical = true;
+        for (int repeat_n = 0; repeat_n < repeat_count; repeat_n++)
+        {
+            AtlasResult result;
+            if (!BuildAtlas(fonts_dir, workers_count, nullptr, &result))
+                return 1;
+            if (workers_count == 1 && repeat_n == 0)
+                reference = result;
+            identical &= IsIdentical(reference, result);
+            best_ms = (repeat_n == 0) ? result.BuildMs : std::min(best_ms, result.BuildMs);
+        }
+        if (workers_count == 1)
+        {
+            reference_ms = best_ms;
+            printf("Atlas: %dx%d, %d glyphs\n", reference.Width, reference.Height, reference.GlyphsCount);
+        }
+        printf("- %2d worker(s): build %8.2f ms, speedup %.2fx, %s\n", workers_count, best_ms, reference_ms / best_ms, identical ? "identical" : "MISMATCH");
+        all_identical &= identical;
+    }
+
+    // Cold start builds and writes cache file, warm starts load it
+    remove(cache_filename);
+    for (int repeat_n = 0; repeat_n <= repeat_count; repeat_n++)
+    {
+        AtlasResult result;
+        if (!BuildAtlas(fonts_dir, 1, cache_filename, &result))
+            return 1;
+        const bool identical = IsIdentical(reference, result);
+        printf("- cache %s: %8.2f ms, speedup %.2fx, %s\n", repeat_n == 0 ? "cold" : "warm", result.BuildMs, reference_ms / result.BuildMs, identical ? "identical" : "MISMATCH");
+        all_identical &= identical;
+    }
+    printf("%s\n", all_identical ? "OK" : "FAILED");
+    return all_identical ? 0 : 1;
+}
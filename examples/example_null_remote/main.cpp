@@ -0,0 +1,252 @@
+// Dear ImGui: headless end-to-end test of remote streaming (see misc/remote/imgui_remote.h), POSIX only
+// (compile and link imgui, fork an application process streaming its frames over a local socket to a viewer process)
+// - The application renders the demo and a small test window, only when it received inputs or needs to animate (see GetNextFrameDelay()).
+// - The viewer sends scripted inputs (mouse moves, clicks, text, wheel), reconstructs frames and renders them with imgui_impl_softraster.
+// - The application also renders its frames, and reports pixel hashes and widget state through a pipe: the viewer checks
+//   that reconstructed frames are identical, that inputs reached the application, and prints bandwidth.
+// Usage: example_null_remote
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include "imgui_remote.h"
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <float.h>
+#include <vector>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+static const int WIDTH = 1280;
+static const int HEIGHT = 720;
+
+// Sent by application through side pipe after each frame
+struct FrameReport
+{
+    int         FrameNo;
+    int         InputEventsReceived;
+    float       NextFrameDelay;
+    ImU32       PixelsHash;
+    int         Clicks;
+    char        Text[32];
+    int         BytesRaw, BytesSent;
+    int         ListsSent, ListsReused, BlocksSent, BlocksReused;
+};
+
+static ImU32 RenderAndHash(ImDrawData* draw_data, std::vector<ImU32>& pixels)
+{
+    pixels.assign((size_t)WIDTH * HEIGHT, IM_COL32(114, 140, 153, 255));
+    ImGui_ImplSoftraster_RenderDrawData(draw_data, pixels.data(), WIDTH, HEIGHT, WIDTH * (int)sizeof(ImU32));
+    ImU32 hash = 2166136261u;
+    for (ImU32 pixel : pixels)
+        hash = (hash ^ pixel) * 16777619u;
+    return hash;
+}
+
+static int RunApplication(int socket_fd, int report_fd)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2((float)WIDTH, (float)HEIGHT);
+    ImGui_ImplSoftraster_Init();
+
+    ImGuiRemoteServer server;
+    ImGuiRemote_InitTransportFd(&server.Transport, socket_fd, socket_fd);
+    std::vector<ImU32> pixels;
+    int clicks = 0;
+    static char text[32] = "";
+    float next_frame_delay = 0.0f;
+    while (true)
+    {
+        // Sleep until viewer sends something or we need to animate
+        struct pollfd pfd = { socket_fd, POLLIN, 0 };
+        poll(&pfd, 1, (next_frame_delay == FLT_MAX) ? -1 : (int)(next_frame_delay * 1000.0f));
+        if (!server.NewFrame())
+            break;
+
+        io.DeltaTime = 1.0f / 60.0f;
+        ImGui_ImplSoftraster_NewFrame();
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0, 0));
+        ImGui::SetNextWindowSize(ImVec2(300, 700));
+        ImGui::Begin("Application", nullptr, ImGuiWindowFlags_NoDecoration);
+        if (ImGui::Button("Click me"))
+            clicks++;
+        ImGui::InputText("##text", text, IM_ARRAYSIZE(text));
+        for (int n = 0; n < 200; n++)
+            ImGui::TextColored(ImColor::HSV((n % 16) / 16.0f, 0.6f, 1.0f), "Line %03d: clicks = %d", n, clicks);
+        ImGui::End();
+        ImGui::SetNextWindowPos(ImVec2(320, 0), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(900, 700), ImGuiCond_Once);
+        ImGui::ShowDemoWindow();
+        ImGui::Render();
+        next_frame_delay = ImGui::GetNextFrameDelay();
+        if (!server.SendFrame(ImGui::GetDrawData(), io.Fonts))
+            break;
+
+        FrameReport report = {};
+        report.FrameNo = server.FramesCount - 1;
+        report.InputEventsReceived = server.InputEventsReceived;
+        report.NextFrameDelay = next_frame_delay;
+        report.PixelsHash = RenderAndHash(ImGui::GetDrawData(), pixels);
+        report.Clicks = clicks;
+        strcpy(report.Text, text);
+        report.BytesRaw = (int)server.StatsBytesRaw;
+        report.BytesSent = (int)server.StatsBytesSent;
+        report.ListsSent = server.StatsListsSent;
+        report.ListsReused = server.StatsListsReused;
+        report.BlocksSent = server.StatsBlocksSent;
+        report.BlocksReused = server.StatsBlocksReused;
+        if (write(report_fd, &report, sizeof(report)) != (ssize_t)sizeof(report))
+            break;
+    }
+    ImGuiRemote_ShutdownTransportFd(&server.Transport);
+    ImGui_ImplSoftraster_Shutdown();
+    ImGui::DestroyContext();
+    return 0;
+}
+
+static bool ReadReport(int report_fd, FrameReport* report)
+{
+    char* p = (char*)report;
+    for (size_t remaining = sizeof(*report); remaining > 0; )
+    {
+        const ssize_t n = read(report_fd, p, remaining);
+        if (n <= 0)
+            return false;
+        p += n;
+        remaining -= (size_t)n;
+    }
+    return true;
+}
+
+int main(int, char**)
+{
+    IMGUI_CHECKVERSION();
+    int sockets[2], report_pipe[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets) != 0 || pipe(report_pipe) != 0)
+        return 1;
+    signal(SIGPIPE, SIG_IGN);
+    const pid_t pid = fork();
+    if (pid == 0)
+    {
+        close(sockets[0]);
+        close(report_pipe[0]);
+        return RunApplication(sockets[1], report_pipe[1]);
+    }
+    close(sockets[1]);
+    close(report_pipe[1]);
+
+    // Viewer
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2((float)WIDTH, (float)HEIGHT);
+    ImGui_ImplSoftraster_Init();
+    ImGuiRemoteClient client;
+    ImGuiRemote_InitTransportFd(&client.Transport, sockets[0], sockets[0]);
+    std::vector<ImGui_ImplSoftraster_Texture> textures;
+    textures.reserve(16);
+    std::vector<ImU32> pixels;
+
+    struct Step { const char* Name; float MouseX, MouseY; int Button; const char* Text; float Wheel; };
+    const Step steps[] =
+    {
+        { "Connect",            -FLT_MAX, -FLT_MAX, -1, nullptr,  0.0f },
+        { "Hover button",       20, 15, -1, nullptr,  0.0f },
+        { "Click button",       20, 15,  0, nullptr,  0.0f },
+        { "Click text input",   60, 40,  0, nullptr,  0.0f },
+        { "Type text",          60, 40, -1, "hello",  0.0f },
+        { "Hover demo",        700, 300, -1, nullptr,  0.0f },
+        { "Scroll application", 100, 400, -1, nullptr, -3.0f },
+        { "Scroll application", 100, 400, -1, nullptr, -3.0f },
+    };
+
+    printf("%-20s %6s %12s %12s %8s %14s %16s %s\n", "Step", "Frames", "Raw bytes", "Sent bytes", "Ratio", "Lists sent/all", "Blocks sent/all", "Pixels");
+    int frames_compared = 0, frames_mismatch = 0;
+    long long total_raw = 0, total_sent = 0;
+    FrameReport report = {};
+    bool ok = true;
+    for (const Step& step : steps)
+    {
+        if (step.MouseX != -FLT_MAX)
+            io.AddMousePosEvent(step.MouseX, step.MouseY);
+        if (step.Button >= 0)
+        {
+            io.AddMouseButtonEvent(step.Button, true);
+            io.AddMouseButtonEvent(step.Button, false);
+        }
+        if (step.Text)
+            io.AddInputCharactersUTF8(step.Text);
+        if (step.Wheel != 0.0f)
+            io.AddMouseWheelEvent(0.0f, step.Wheel);
+        if (!client.SendInputs())
+        {
+            ok = false;
+            break;
+        }
+
+        // Process frames until application received our inputs and went idle (only the cursor blinking)
+        long long step_raw = 0, step_sent = 0;
+        int step_frames = 0, lists_sent = 0, lists_total = 0, blocks_sent = 0, blocks_total = 0, step_mismatch = 0;
+        do
+        {
+            if (!ReadReport(report_pipe[0], &report))
+            {
+                ok = false;
+                break;
+            }
+            while (client.Connected && client.FramesCount <= report.FrameNo)
+                if (!client.Update())
+                    usleep(100);
+            if (!client.Connected)
+            {
+                ok = false;
+                break;
+            }
+            for (ImGuiRemoteTexture& tex : client.Textures)
+                if (tex.Updated)
+                {
+                    textures.push_back({ tex.Pixels.Data, tex.Width, tex.Height, tex.BytesPerPixel });
+                    tex.TexID = (ImTextureID)(intptr_t)&textures.back();
+                    tex.Updated = false;
+                }
+            if (client.FramesCount == report.FrameNo + 1)
+            {
+                frames_compared++;
+                if (RenderAndHash(client.GetDrawData(), pixels) != report.PixelsHash)
+                    step_mismatch++;
+            }
+            step_frames++;
+            step_raw += report.BytesRaw;
+            step_sent += report.BytesSent;
+            lists_sent += report.ListsSent;
+            lists_total += report.ListsSent + report.ListsReused;
+            blocks_sent += report.BlocksSent;
+            blocks_total += report.BlocksSent + report.BlocksReused;
+        }
+        while (report.InputEventsReceived < client.InputEventsSent || report.NextFrameDelay < 0.1f);
+        total_raw += step_raw;
+        total_sent += step_sent;
+        frames_mismatch += step_mismatch;
+        printf("%-20s %6d %12lld %12lld %7.1fx %7d/%-6d %8d/%-7d %s\n", step.Name, step_frames, step_raw, step_sent, step_sent ? (double)step_raw / step_sent : 0.0,
+            lists_sent, lists_total, blocks_sent, blocks_total, step_mismatch ? "MISMATCH" : "identical");
+        if (!ok)
+            break;
+    }
+    printf("Total: %lld bytes raw, %lld bytes sent (%.1fx), %d frames compared, %d mismatch\n", total_raw, total_sent, total_sent ? (double)total_raw / total_sent : 0.0, frames_compared, frames_mismatch);
+    printf("Application state: clicks = %d, text = \"%s\"\n", report.Clicks, report.Text);
+    ok = ok && frames_mismatch == 0 && report.Clicks == 1 && strcmp(report.Text, "hello") == 0;
+
+    ImGuiRemote_ShutdownTransportFd(&client.Transport);
+    close(sockets[0]);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    ImGui_ImplSoftraster_Shutdown();
+    ImGui::DestroyContext();
+    printf("%s\n", ok ? "OK" : "FAILED");
+    return ok ? 0 : 1;
+}
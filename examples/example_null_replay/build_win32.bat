@@ -0,0 +1,3 @@
+@REM Build for Visual Studio compiler. Run your copy of vcvars32.bat or vcvarsall.bat to setup command-line compiler.
+mkdir Debug
+cl /nologo /Zi /O2 /MD /utf-8 /I ..\.. /I ..\..\backends /I ..\..\misc\capture %* *.cpp ..\..\*.cpp ..\..\backends\imgui_impl_softraster.cpp ..\..\misc\capture\imgui_capture.cpp /FeDebug/example_null_replay.exe /FoDebug/ /link gdi32.lib shell32.lib imm32.lib
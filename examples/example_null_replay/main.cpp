@@ -0,0 +1,414 @@
+// Dear ImGui: headless tool replaying ImDrawData captures (see misc/capture/imgui_capture.h)
+// (compile and link imgui, create context, replay captured frames with a renderer backend into an offscreen target)
+// This is useful to benchmark renderer backends on real frames, or to diagnose rendering regressions.
+// It prints the cost of every frame, then a summary.
+// Renderers:
+//   softraster     imgui_impl_softraster into a CPU pixel buffer (default).
+//   opengl3        imgui_impl_opengl3 into a framebuffer object of a headless EGL context. Build with 'make WITH_OPENGL3=1'.
+// Usage:
+//   example_null_replay capture.imcap [--renderer NAME] [--threads N] [--repeat N] [--no-render] [--ppm last_frame.ppm]
+//   example_null_replay --capture capture.imcap [frames_count] [--renderer NAME]     (capture the demo windows, headless)
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include "imgui_capture.h"
+#ifdef REPLAY_WITH_OPENGL3
+#include "imgui_impl_opengl3.h"
+#define GL_GLEXT_PROTOTYPES
+#include <GL/gl.h>
+#include <GL/glext.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#ifdef _WIN32
+#include "imgui_internal.h" // ImFileLoadToMemory()
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static double GetTimeMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+// Renderer backend drawing into an offscreen target. A Dear ImGui context must be current.
+struct ReplayRenderer
+{
+    virtual ~ReplayRenderer() {}
+    virtual bool        Init(int threads_count) = 0;                        // Also sets io.BackendFlags, so captures use features supported by this renderer
+    virtual void        Shutdown() = 0;
+    virtual void        NewFrame() = 0;
+    virtual ImTextureID CreateTexture(const ImGuiCaptureTexture& tex) = 0;  // Texture data stays valid until Shutdown()
+    virtual void        Render(ImDrawData* draw_data, int width, int height) = 0;   // Clear target then render, return once rendering is complete
+    virtual void        ReadPixels(ImU32* pixels) = 0;                      // IM_COL32() layout, top to bottom, size of last Render()
+};
+
+static const ImU32 CLEAR_COLOR = IM_COL32(114, 140, 153, 255);
+
+struct ReplayRendererSoftraster : ReplayRenderer
+{
+    std::vector<ImU32>  Pixels;
+    std::vector<ImGui_ImplSoftraster_Texture*> Textures;
+
+    bool Init(int threads_count) override   { return ImGui_ImplSoftraster_Init(threads_count); }
+    void NewFrame() override                { ImGui_ImplSoftraster_NewFrame(); }
+    void ReadPixels(ImU32* pixels) override { memcpy(pixels, Pixels.data(), Pixels.size() * sizeof(ImU32)); }
+    void Shutdown() override
+    {
+        ImGui_ImplSoftraster_Shutdown();
+        for (ImGui_ImplSoftraster_Texture* tex : Textures)
+            delete tex;
+        Textures.clear();
+    }
+    ImTextureID CreateTexture(const ImGuiCaptureTexture& src) override
+    {
+        // Captured pixels are used directly from mapped memory
+        Textures.push_back(new ImGui_ImplSoftraster_Texture { src.Pixels, src.Width, src.Height, src.BytesPerPixel });
+        return (ImTextureID)(intptr_t)Textures.back();
+    }
+    void Render(ImDrawData* draw_data, int width, int height) override
+    {
+        Pixels.resize((size_t)width * height);
+        std::fill(Pixels.begin(), Pixels.end(), CLEAR_COLOR);
+        ImGui_ImplSoftraster_RenderDrawData(draw_data, Pixels.data(), width, height, width * (int)sizeof(ImU32));
+    }
+};
+
+#ifdef REPLAY_WITH_OPENGL3
+struct ReplayRendererOpenGL3 : ReplayRenderer
+{
+    EGLDisplay          Display = EGL_NO_DISPLAY;
+    EGLContext          Context = EGL_NO_CONTEXT;
+    GLuint              Framebuffer = 0, Renderbuffer = 0;
+    int                 Width = 0, Height = 0;
+    std::vector<GLuint> Textures;
+
+    bool Init(int) override
+    {
+        // Surfaceless context: we render into our own framebuffer object
+        PFNEGLGETPLATFORMDISPLAYEXTPROC egl_get_platform_display = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+        if (egl_get_platform_display != nullptr)
+            Display = egl_get_platform_display(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        if (Display == EGL_NO_DISPLAY)
+            Display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+        if (Display == EGL_NO_DISPLAY || !eglInitialize(Display, nullptr, nullptr) || !eglBindAPI(EGL_OPENGL_API))
+            return false;
+        const EGLint context_attribs[] = { EGL_CONTEXT_MAJOR_VERSION, 3, EGL_CONTEXT_MINOR_VERSION, 3, EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT, EGL_NONE };
+        Context = eglCreateContext(Display, (EGLConfig)nullptr, EGL_NO_CONTEXT, context_attribs);
+        if (Context == EGL_NO_CONTEXT || !eglMakeCurrent(Display, EGL_NO_SURFACE, EGL_NO_SURFACE, Context))
+            return false;
+        glGenFramebuffers(1, &Framebuffer);
+        glGenRenderbuffers(1, &Renderbuffer);
+        return ImGui_ImplOpenGL3_Init("#version 330");
+    }
+    void Shutdown() override
+    {
+        ImGui_ImplOpenGL3_Shutdown();
+        glDeleteTextures((GLsizei)Textures.size(), Textures.data());
+        glDeleteRenderbuffers(1, &Renderbuffer);
+        glDeleteFramebuffers(1, &Framebuffer);
+        eglMakeCurrent(Display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        eglDestroyContext(Display, Context);
+        eglTerminate(Display);
+    }
+    void NewFrame() override
+    {
+        ImGui_ImplOpenGL3_NewFrame();
+    }
+    ImTextureID CreateTexture(const ImGuiCaptureTexture& src) override
+    {
+        // The backend samples RGBA textures: expand alpha-only ones as white
+        std::vector<ImU32> rgba;
+        const void* pixels = src.Pixels;
+        if (src.BytesPerPixel == 1)
+        {
+            rgba.resize((size_t)src.Width * src.Height);
+            for (size_t n = 0; n < rgba.size(); n++)
+                rgba[n] = IM_COL32(255, 255, 255, ((const unsigned char*)src.Pixels)[n]);
+            pixels = rgba.data();
+        }
+        GLuint tex;
+        glGenTextures(1, &tex);
+        glBindTexture(GL_TEXTURE_2D, tex);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, src.Width, src.Height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        Textures.push_back(tex);
+        return (ImTextureID)(intptr_t)tex;
+    }
+    void Render(ImDrawData* draw_data, int width, int height) override
+    {
+        if (Width != width || Height != height)
+        {
+            glBindRenderbuffer(GL_RENDERBUFFER, Renderbuffer);
+            glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+            glBindFramebuffer(GL_FRAMEBUFFER, Framebuffer);
+            glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, Renderbuffer);
+            Width = width;
+            Height = height;
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, Framebuffer);
+        glViewport(0, 0, width, height);
+        const ImVec4 clear_color = ImGui::ColorConvertU32ToFloat4(CLEAR_COLOR);
+        glClearColor(clear_color.x, clear_color.y, clear_color.z, clear_color.w);
+        glClear(GL_COLOR_BUFFER_BIT);
+        ImGui_ImplOpenGL3_RenderDrawData(draw_data);
+        glFinish();
+    }
+    void ReadPixels(ImU32* pixels) override
+    {
+        // Rows are read bottom to top
+        glBindFramebuffer(GL_FRAMEBUFFER, Framebuffer);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        for (int y = 0; y < Height; y++)
+            glReadPixels(0, Height - 1 - y, Width, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels + (size_t)y * Width);
+    }
+};
+#endif
+
+static ReplayRenderer* CreateRenderer(const char* name)
+{
+    if (strcmp(name, "softraster") == 0)
+        return new ReplayRendererSoftraster();
+#ifdef REPLAY_WITH_OPENGL3
+    if (strcmp(name, "opengl3") == 0)
+        return new ReplayRendererOpenGL3();
+#endif
+    fprintf(stderr, "Error: unknown renderer '%s'\n", name);
+    return nullptr;
+}
+
+// Capture frames of the demo windows, as example_null_softraster renders them
+static int Capture(const char* filename, int frames_count, const char* renderer_name)
+{
+    ReplayRenderer* renderer = CreateRenderer(renderer_name);
+    if (renderer == nullptr)
+        return 1;
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    if (!renderer->Init(1))
+    {
+        fprintf(stderr, "Error: cannot initialize renderer '%s'\n", renderer_name);
+        return 1;
+    }
+
+    ImGuiCaptureWriter writer;
+    if (!writer.Open(filename))
+    {
+        fprintf(stderr, "Error: cannot open '%s' for writing\n", filename);
+        return 1;
+    }
+    double write_ms = 0.0;
+    for (int n = 0; n < frames_count; n++)
+    {
+        renderer->NewFrame();
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(40, 40), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(800, 1000), ImGuiCond_Once);
+        ImGui::ShowDemoWindow(nullptr);
+        ImGui::SetNextWindowPos(ImVec2(880, 40), ImGuiCond_Once);
+        ImGui::SetNextWindowSize(ImVec2(1000, 1000), ImGuiCond_Once);
+        ImGui::Begin("Dear ImGui Style Editor");
+        ImGui::ShowStyleEditor();
+        ImGui::End();
+        ImGui::Render();
+
+        const double t0 = GetTimeMs();
+        writer.WriteFrame(ImGui::GetDrawData(), io.Fonts);
+        write_ms += GetTimeMs() - t0;
+    }
+    printf("Wrote %d frames to '%s': %.1f KB/frame, %.3f ms/frame\n", writer.FramesCount, filename, writer.BytesWritten / 1024.0 / std::max(writer.FramesCount, 1), write_ms / frames_count);
+    const bool ok = !writer.Error;
+    writer.Close();
+    renderer->Shutdown();
+    delete renderer;
+    ImGui::DestroyContext();
+    return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    const char* filename = nullptr;
+    const char* ppm_filename = nullptr;
+    const char* renderer_name = "softraster";
+    const char* capture_filename = nullptr;
+    int capture_frames_count = 60;
+    int threads_count = 1;
+    int repeat_count = 1;
+    bool render = true;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--capture") == 0 && n + 1 < argc)
+        {
+            capture_filename = argv[++n];
+            if (n + 1 < argc && argv[n + 1][0] != '-')
+                capture_frames_count = atoi(argv[++n]);
+        }
+        else if (strcmp(argv[n], "--renderer") == 0 && n + 1 < argc)
+            renderer_name = argv[++n];
+        else if (strcmp(argv[n], "--threads") == 0 && n + 1 < argc)
+            threads_count = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--repeat") == 0 && n + 1 < argc)
+            repeat_count = std::max(atoi(argv[++n]), 1);
+        else if (strcmp(argv[n], "--no-render") == 0)
+            render = false;
+        else if (strcmp(argv[n], "--ppm") == 0 && n + 1 < argc)
+            ppm_filename = argv[++n];
+        else
+            filename = argv[n];
+    }
+    if (capture_filename != nullptr)
+        return Capture(capture_filename, capture_frames_count, renderer_name);
+    if (filename == nullptr)
+    {
+        printf("Usage: %s capture.imcap [--renderer NAME] [--threads N] [--repeat N] [--no-render] [--ppm last_frame.ppm]\n", argv[0]);
+        printf("       %s --capture capture.imcap [frames_count] [--renderer NAME]\n", argv[0]);
+        printf("Renderers: softraster");
+#ifdef REPLAY_WITH_OPENGL3
+        printf(", opengl3");
+#endif
+        printf("\n");
+        return 1;
+    }
+
+    // Map capture file
+    size_t data_size = 0;
+#ifdef _WIN32
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size);
+#else
+    void* data = nullptr;
+    int fd = open(filename, O_RDONLY);
+    struct stat st;
+    if (fd >= 0 && fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        data_size = (size_t)st.st_size;
+        data = mmap(nullptr, data_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+            data = nullptr;
+    }
+    if (fd >= 0)
+        close(fd);
+#endif
+
+    // Setup renderer: a context is required by the backend
+    ReplayRenderer* renderer = CreateRenderer(renderer_name);
+    if (renderer == nullptr)
+        return 1;
+    ImGui::CreateContext();
+    ImGui::GetIO().IniFilename = nullptr;
+    if (!renderer->Init(threads_count))
+    {
+        fprintf(stderr, "Error: cannot initialize renderer '%s'\n", renderer_name);
+        return 1;
+    }
+
+    // Draw lists using features the renderer doesn't support are converted by the reader
+    ImGuiCaptureReader reader;
+    if (data == nullptr || !reader.Init(data, data_size, ImGui::GetIO().BackendFlags))
+    {
+        fprintf(stderr, "Error: cannot read '%s', or it was captured with a different ImDrawVert/ImDrawIdx layout\n", filename);
+        return 1;
+    }
+    printf("'%s': %d frames, %d textures\n", filename, reader.FramesCount, reader.Textures.Size);
+    const ImGuiBackendFlags missing_flags = reader.CapturedRendererFlags & ~reader.RendererFlags;
+    if (missing_flags != 0)
+        printf("Renderer '%s' doesn't support%s%s%s used by the capture: converting draw lists on decode\n", renderer_name,
+            (missing_flags & ImGuiBackendFlags_RendererHasVtxOffset) ? " VtxOffset" : "",
+            (missing_flags & ImGuiBackendFlags_RendererHasPackedIdx) ? " PackedIdx" : "",
+            (missing_flags & ImGuiBackendFlags_RendererHasRectInstances) ? " RectInstances" : "");
+    renderer->NewFrame(); // Create device objects
+    for (ImGuiCaptureTexture& tex : reader.Textures)
+        tex.TexID = renderer->CreateTexture(tex);
+
+    // Replay
+    std::vector<ImU32> pixels;
+    std::vector<double> render_times;
+    int width = 0, height = 0;
+    double decode_ms = 0.0;
+    for (int repeat_n = 0; repeat_n < repeat_count; repeat_n++)
+        for (int frame_n = 0; frame_n < reader.FramesCount; frame_n++)
+        {
+            const double t0 = GetTimeMs();
+            ImDrawData* draw_data = reader.GetFrame(frame_n);
+            const double t1 = GetTimeMs();
+            decode_ms += t1 - t0;
+            if (draw_data == nullptr)
+            {
+                fprintf(stderr, "Error: frame %d is corrupted, or cannot be converted for renderer '%s'\n", frame_n, renderer_name);
+                continue;
+            }
+            if (!render)
+                continue;
+
+            width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+            height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+            const double t2 = GetTimeMs();
+            renderer->Render(draw_data, width, height);
+            const double t3 = GetTimeMs();
+            render_times.push_back(t3 - t2);
+            if (repeat_n == 0)
+            {
+                int cmds_count = 0;
+                for (ImDrawList* draw_list : draw_data->CmdLists)
+                    cmds_count += draw_list->CmdBuffer.Size;
+                printf("- frame %4d: %3d lists, %5d cmds, %7d vtx, %7d idx: %7.3f ms\n", frame_n, draw_data->CmdListsCount, cmds_count, draw_data->TotalVtxCount, draw_data->TotalIdxCount, t3 - t2);
+            }
+        }
+
+    const int frames_decoded = reader.FramesCount * repeat_count;
+    printf("Decode: %.4f ms/frame\n", frames_decoded > 0 ? decode_ms / frames_decoded : 0.0);
+    if (!render_times.empty())
+    {
+        std::vector<double> sorted = render_times;
+        std::sort(sorted.begin(), sorted.end());
+        double total_ms = 0.0;
+        for (double t : sorted)
+            total_ms += t;
+        printf("Render (%s, %d thread(s), %d frames): avg %.3f ms, min %.3f ms, median %.3f ms, p95 %.3f ms, max %.3f ms\n", renderer_name, threads_count, (int)sorted.size(),
+            total_ms / sorted.size(), sorted.front(), sorted[sorted.size() / 2], sorted[std::min(sorted.size() - 1, sorted.size() * 95 / 100)], sorted.back());
+    }
+
+    // Write last frame
+    if (ppm_filename != nullptr && width > 0 && height > 0)
+    {
+        pixels.resize((size_t)width * height);
+        renderer->ReadPixels(pixels.data());
+        FILE* f = fopen(ppm_filename, "wb");
+        if (f != nullptr)
+        {
+            fprintf(f, "P6 %d %d 255\n", width, height);
+            for (ImU32 pixel : pixels)
+            {
+                const unsigned char rgb[3] = { (unsigned char)(pixel >> IM_COL32_R_SHIFT), (unsigned char)(pixel >> IM_COL32_G_SHIFT), (unsigned char)(pixel >> IM_COL32_B_SHIFT) };
+                fwrite(rgb, 1, 3, f);
+            }
+            fclose(f);
+            printf("Wrote '%s'\n", ppm_filename);
+        }
+    }
+
+    renderer->Shutdown();
+    delete renderer;
+    ImGui::DestroyContext();
+    reader.Clear();
+#ifdef _WIN32
+    IM_FREE(data);
+#else
+    munmap(data, data_size);
+#endif
+    return 0;
+}
@@ -0,0 +1,169 @@
+// Dear ImGui: headless example application with software rendering
+// (compile and link imgui, create context, run headless with NO INPUTS, render into a CPU pixel buffer)
+// This is useful to test rendering or produce screenshots without a graphics API.
+// It renders the demo windows at 4K resolution and prints rendering times for 1 thread and all hardware threads.
+// With --compare, the last frame is compared with a previously written image, e.g. to check IMGUI_USE_COMPACT_DRAWVERT:
+//   make && ./example_null_softraster reference.ppm
+//   make clean && make WITH_COMPACT_DRAWVERT=1 && ./example_null_softraster --compare reference.ppm
+// Usage: example_null_softraster [output.ppm] [--compare reference.ppm]
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static const int WIDTH = 3840;
+static const int HEIGHT = 2160;
+
+static void ShowWindows()
+{
+    ImGui::SetNextWindowPos(ImVec2(40, 40), ImGuiCond_Once);
+    ImGui::SetNextWindowSize(ImVec2(1000, 2000), ImGuiCond_Once);
+    ImGui::ShowDemoWindow(nullptr);
+
+    ImGui::SetNextWindowPos(ImVec2(1100, 40), ImGuiCond_Once);
+    ImGui::SetNextWindowSize(ImVec2(1000, 2000), ImGuiCond_Once);
+    ImGui::Begin("Dear ImGui Style Editor");
+    ImGui::ShowStyleEditor();
+    ImGui::End();
+
+    ImGui::SetNextWindowPos(ImVec2(2160, 40), ImGuiCond_Once);
+    ImGui::SetNextWindowSize(ImVec2(1600, 2000), ImGuiCond_Once);
+    ImGui::Begin("Shapes");
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 p = ImGui::GetCursorScreenPos();
+    for (int n = 0; n < 400; n++)
+    {
+        const ImVec2 c(p.x + 40.0f + (n % 20) * 76.0f, p.y + 40.0f + (n / 20) * 96.0f);
+        const ImU32 col = ImColor::HSV((n % 20) / 20.0f, 0.7f, 0.9f);
+        switch (n % 4)
+        {
+        case 0: draw_list->AddCircleFilled(c, 30.0f, col); break;
+        case 1: draw_list->AddRect(ImVec2(c.x - 30, c.y - 30), ImVec2(c.x + 30, c.y + 30), col, 8.0f, 0, 3.0f); break;
+        case 2: draw_list->AddNgon(c, 30.0f, col, 6, 2.0f); break;
+        case 3: draw_list->AddText(ImVec2(c.x - 30, c.y - 8), col, "Hello!"); break;
+        }
+    }
+    ImGui::End();
+}
+
+static double RenderFrames(int threads_count, int frames_count, std::vector<ImU32>& pixels)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2((float)WIDTH, (float)HEIGHT);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui_ImplSoftraster_Init(threads_count);
+
+    double total_ms = 0.0;
+    for (int n = 0; n < frames_count + 1; n++)
+    {
+        ImGui_ImplSoftraster_NewFrame();
+        ImGui::NewFrame();
+        ShowWindows();
+        ImGui::Render();
+
+        for (ImU32& pixel : pixels)
+            pixel = IM_COL32(114, 140, 153, 255);
+        auto t0 = std::chrono::high_resolution_clock::now();
+        ImGui_ImplSoftraster_RenderDrawData(ImGui::GetDrawData(), pixels.data(), WIDTH, HEIGHT, WIDTH * (int)sizeof(ImU32));
+        auto t1 = std::chrono::high_resolution_clock::now();
+        if (n > 0) // Skip first frame (window sizes are settling, buffers are allocated)
+            total_ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+    }
+
+    ImGui_ImplSoftraster_Shutdown();
+    ImGui::DestroyContext();
+    return total_ms / frames_count;
+}
+
+// Compare with an image previously written by this program. Anti-aliased edges may differ slightly with IMGUI_USE_COMPACT_DRAWVERT,
+// so we fail when more than IMAGE_DIFF_MAX_RATIO of pixels differ, or when any channel differs by more than IMAGE_DIFF_MAX_DELTA.
+// (with the default 3 fractional bits, about 0.8% of pixels differ by up to 16)
+static const double IMAGE_DIFF_MAX_RATIO = 0.02;
+static const int IMAGE_DIFF_MAX_DELTA = 32;
+static bool CompareImage(const char* filename, const std::vector<ImU32>& pixels)
+{
+    FILE* f = fopen(filename, "rb");
+    int w = 0, h = 0, max_value = 0;
+    if (f == nullptr || fscanf(f, "P6 %d %d %d", &w, &h, &max_value) != 3 || fgetc(f) != '\n' || w != WIDTH || h != HEIGHT || max_value != 255)
+    {
+        fprintf(stderr, "Error: cannot read %dx%d image from '%s'\n", WIDTH, HEIGHT, filename);
+        if (f)
+            fclose(f);
+        return false;
+    }
+    std::vector<unsigned char> rgb_ref((size_t)WIDTH * HEIGHT * 3);
+    const bool read_ok = fread(rgb_ref.data(), 1, rgb_ref.size(), f) == rgb_ref.size();
+    fclose(f);
+    if (!read_ok)
+        return false;
+
+    size_t diff_count = 0;
+    int max_delta = 0;
+    for (size_t n = 0; n < pixels.size(); n++)
+    {
+        const ImU32 pixel = pixels[n];
+        const unsigned char rgb[3] = { (unsigned char)(pixel >> IM_COL32_R_SHIFT), (unsigned char)(pixel >> IM_COL32_G_SHIFT), (unsigned char)(pixel >> IM_COL32_B_SHIFT) };
+        int delta = 0;
+        for (int c = 0; c < 3; c++)
+            delta = std::max(delta, abs((int)rgb[c] - (int)rgb_ref[n * 3 + c]));
+        diff_count += (delta > 0) ? 1 : 0;
+        max_delta = std::max(max_delta, delta);
+    }
+    const double diff_ratio = (double)diff_count / pixels.size();
+    const bool ok = diff_ratio <= IMAGE_DIFF_MAX_RATIO && max_delta <= IMAGE_DIFF_MAX_DELTA;
+    printf("Compared with '%s': %d pixels differ (%.3f%%), max channel delta %d: %s\n", filename, (int)diff_count, diff_ratio * 100.0, max_delta, ok ? "OK" : "FAILED");
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    const char* output_filename = nullptr;
+    const char* compare_filename = nullptr;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--compare") == 0 && n + 1 < argc)
+            compare_filename = argv[++n];
+        else if (argv[n][0] != '-' && output_filename == nullptr)
+            output_filename = argv[n];
+        else
+        {
+            printf("Usage: %s [output.ppm] [--compare reference.ppm]\n", argv[0]);
+            return 1;
+        }
+    }
+    std::vector<ImU32> pixels((size_t)WIDTH * HEIGHT);
+
+    const int frames_count = 10;
+    const int max_threads = (std::thread::hardware_concurrency() > 0) ? (int)std::thread::hardware_concurrency() : 1;
+    printf("Rendering %dx%d, average over %d frames:\n", WIDTH, HEIGHT, frames_count);
+    for (int threads_count = 1; threads_count < max_threads; threads_count *= 2)
+        printf("- %2d thread(s): %.2f ms\n", threads_count, RenderFrames(threads_count, frames_count, pixels));
+    printf("- %2d thread(s): %.2f ms\n", max_threads, RenderFrames(max_threads, frames_count, pixels));
+
+    // Write last frame
+    if (output_filename != nullptr)
+    {
+        FILE* f = fopen(output_filename, "wb");
+        if (f == nullptr)
+            return 1;
+        fprintf(f, "P6 %d %d 255\n", WIDTH, HEIGHT);
+        for (ImU32 pixel : pixels)
+        {
+            const unsigned char rgb[3] = { (unsigned char)(pixel >> IM_COL32_R_SHIFT), (unsigned char)(pixel >> IM_COL32_G_SHIFT), (unsigned char)(pixel >> IM_COL32_B_SHIFT) };
+            fwrite(rgb, 1, 3, f);
+        }
+        fclose(f);
+        printf("Wrote '%s'\n", output_filename);
+    }
+    if (compare_filename != nullptr && !CompareImage(compare_filename, pixels))
+        return 1;
+    return 0;
+}
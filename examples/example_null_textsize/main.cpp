@@ -0,0 +1,233 @@
+// Dear ImGui: headless benchmark of text measurement (see ImFont::CalcTextSizeA())
+// (compile and link imgui, measure sets of labels with typical distributions, compare with a reference per-character loop)
+// It prints the cost of measuring every label set with each font, the speedup over the reference loop, and whether results are identical.
+// It then measures the same labels through ImGui::CalcTextSize(), without and with io.ConfigTextSizeCache.
+// Usage:
+//   example_null_textsize [--fonts-dir ../../misc/fonts] [--repeat N]
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+static volatile float g_Sink; // Keep results of measured calls alive
+
+static double GetTimeMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+// Reference: per-character loop of ImFont::CalcTextSizeA() without word-wrapping, decoding every character.
+static ImVec2 CalcTextSizeReference(const ImFont* font, float size, float max_width, const char* text_begin, const char* text_end, const char** remaining)
+{
+    const float scale = size / font->FontSize;
+    ImVec2 text_size(0.0f, 0.0f);
+    float line_width = 0.0f;
+    const char* s = text_begin;
+    while (s < text_end)
+    {
+        const char* prev_s = s;
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+        if (c == '\n')
+        {
+            text_size.x = ImMax(text_size.x, line_width);
+            text_size.y += size;
+            line_width = 0.0f;
+            continue;
+        }
+        if (c == '\r')
+            continue;
+        const float char_width = ((int)c < font->IndexAdvanceX.Size ? font->IndexAdvanceX.Data[c] : font->FallbackAdvanceX) * scale;
+        if (line_width + char_width >= max_width)
+        {
+            s = prev_s;
+            break;
+        }
+        line_width += char_width;
+    }
+    if (text_size.x < line_width)
+        text_size.x = line_width;
+    if (line_width > 0 || text_size.y == 0.0f)
+        text_size.y += size;
+    if (remaining)
+        *remaining = s;
+    return text_size;
+}
+
+// Label sets resembling what a table-heavy application submits every frame
+static void BuildLabels(std::vector<std::string>* short_labels, std::vector<std::string>* long_labels, std::vector<std::string>* mixed_labels)
+{
+    static const char* words[] = { "Name", "Size", "Type", "Modified", "Object", "Transform", "Position", "Enabled", "Value", "Color", "Mesh", "Material", "Texture", "Count", "Index", "Frame", "Delta", "Speed", "Render", "Layer" };
+    static const char* utf8_words[] = { "Caf\xC3\xA9", "\xC3\x9C" "bersicht", "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E", "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82", "\xE2\x80\xA6" };
+    std::mt19937 rng(42);
+    char buf[256];
+    for (int n = 0; n < 4000; n++)
+    {
+        // Table cells and widget labels: numbers, values, names with ids, paths
+        switch (rng() % 6)
+        {
+        case 0: snprintf(buf, sizeof(buf), "%d", (int)(rng() % 100000)); break;
+        case 1: snprintf(buf, sizeof(buf), "%.3f", (rng() % 100000) / 7.0f); break;
+        case 2: snprintf(buf, sizeof(buf), "%s %d", words[rng() % 20], (int)(rng() % 1000)); break;
+        case 3: snprintf(buf, sizeof(buf), "%s##%d", words[rng() % 20], (int)(rng() % 1000)); break;
+        case 4: snprintf(buf, sizeof(buf), "%s %s %s", words[rng() % 20], words[rng() % 20], words[rng() % 20]); break;
+        case 5: snprintf(buf, sizeof(buf), "/assets/%s/%s_%03d.png", words[rng() % 20], words[rng() % 20], (int)(rng() % 1000)); break;
+        }
+        short_labels->push_back(buf);
+
+        // Localized labels and multi-line tooltips
+        snprintf(buf, sizeof(buf), "%s %s: %d%s%s", words[rng() % 20], utf8_words[rng() % 5], (int)(rng() % 1000), (rng() % 2) ? "\n" : "\r\n", words[rng() % 20]);
+        mixed_labels->push_back(buf);
+    }
+
+    // Log lines and text paragraphs
+    for (size_t n = 0; n + 8 <= short_labels->size(); n += 8)
+    {
+        std::string line;
+        for (size_t k = n; k < n + 8; k++)
+            line += (*short_labels)[k] + " ";
+        long_labels->push_back(line);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    const char* fonts_dir = "../../misc/fonts";
+    int repeat_count = 200;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--fonts-dir") == 0 && n + 1 < argc)
+            fonts_dir = argv[++n];
+        else if (strcmp(argv[n], "--repeat") == 0 && n + 1 < argc)
+            repeat_count = std::max(atoi(argv[++n]), 1);
+        else
+        {
+            printf("Usage: %s [--fonts-dir ../../misc/fonts] [--repeat N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImFont* font_default = io.Fonts->AddFontDefault();
+    char filename[512];
+    snprintf(filename, sizeof(filename), "%s/%s", fonts_dir, "Roboto-Medium.ttf");
+    ImFont* font_roboto = io.Fonts->AddFontFromFileTTF(filename, 16.0f);
+    if (font_roboto == nullptr)
+    {
+        fprintf(stderr, "Error: cannot load '%s'\n", filename);
+        return 1;
+    }
+    io.Fonts->Build();
+
+    std::vector<std::string> short_labels, long_labels, mixed_labels;
+    BuildLabels(&short_labels, &long_labels, &mixed_labels);
+
+    // Integer advances at native size (fast path sums blocks of characters), scaled font, fractional advances.
+    struct FontDesc { const char* Name; ImFont* Font; float Size; };
+    const FontDesc fonts[] = { { "Default 13", font_default, 13.0f }, { "Default 20", font_default, 20.0f }, { "Roboto 16", font_roboto, 16.0f } };
+    struct LabelsDesc { const char* Name; const std::vector<std::string>* Labels; };
+    const LabelsDesc labels_sets[] = { { "short", &short_labels }, { "long", &long_labels }, { "utf-8", &mixed_labels } };
+
+    bool all_identical = true;
+    for (const FontDesc& font_desc : fonts)
+        for (const LabelsDesc& labels_desc : labels_sets)
+        {
+            const std::vector<std::string>& labels = *labels_desc.Labels;
+            size_t chars_count = 0;
+            for (const std::string& label : labels)
+                chars_count += label.size();
+
+            // Compare results, including with a max_width stopping in the middle of labels
+            bool identical = true;
+            for (const std::string& label : labels)
+                for (float max_width : { FLT_MAX, 60.0f })
+                {
+                    const char* text_end = label.c_str() + label.size();
+                    const char* remaining = nullptr;
+                    const char* remaining_ref = nullptr;
+                    const ImVec2 size = font_desc.Font->CalcTextSizeA(font_desc.Size, max_width, 0.0f, label.c_str(), text_end, &remaining);
+                    const ImVec2 size_ref = CalcTextSizeReference(font_desc.Font, font_desc.Size, max_width, label.c_str(), text_end, &remaining_ref);
+                    identical &= (memcmp(&size, &size_ref, sizeof(ImVec2)) == 0 && remaining == remaining_ref);
+                }
+
+            // Keep best time of each
+            double best_ms = 0.0, best_ref_ms = 0.0;
+            float sum = 0.0f;
+            for (int repeat_n = 0; repeat_n < repeat_count; repeat_n++)
+            {
+                const double t0 = GetTimeMs();
+                for (const std::string& label : labels)
+                    sum += font_desc.Font->CalcTextSizeA(font_desc.Size, FLT_MAX, 0.0f, label.c_str(), label.c_str() + label.size()).x;
+                const double t1 = GetTimeMs();
+                for (const std::string& label : labels)
+                    sum += CalcTextSizeReference(font_desc.Font, font_desc.Size, FLT_MAX, label.c_str(), label.c_str() + label.size(), nullptr).x;
+                const double t2 = GetTimeMs();
+                best_ms = (repeat_n == 0) ? (t1 - t0) : std::min(best_ms, t1 - t0);
+                best_ref_ms = (repeat_n == 0) ? (t2 - t1) : std::min(best_ref_ms, t2 - t1);
+            }
+            printf("- %-10s %-6s %5d labels, %5.1f chars avg: %7.2f ns/label, reference %7.2f ns/label, speedup %.2fx, %s\n", font_desc.Name, labels_desc.Name,
+                (int)labels.size(), (double)chars_count / labels.size(), best_ms * 1e6 / labels.size(), best_ref_ms * 1e6 / labels.size(), best_ref_ms / best_ms,
+                identical ? "identical" : "MISMATCH");
+            g_Sink = sum;
+            all_identical &= identical;
+        }
+
+    // Same labels through ImGui::CalcTextSize(), which also looks for '##', without and with io.ConfigTextSizeCache
+    ImGui::NewFrame();
+    for (const FontDesc& font_desc : fonts)
+    {
+        ImGui::PushFont(font_desc.Font);
+        ImGui::SetWindowFontScale(font_desc.Size / font_desc.Font->FontSize);
+        for (int labels_set_n = 0; labels_set_n < IM_ARRAYSIZE(labels_sets) + 1; labels_set_n++)
+        {
+            // Last pass measures long labels again, wrapped
+            const bool wrapped = (labels_set_n == IM_ARRAYSIZE(labels_sets));
+            const LabelsDesc& labels_desc = wrapped ? labels_sets[1] : labels_sets[labels_set_n];
+            const float wrap_width = wrapped ? 200.0f : -1.0f;
+            const std::vector<std::string>& labels = *labels_desc.Labels;
+            std::vector<ImVec2> sizes[2];
+            double best_ms[2] = {};
+            for (int cache_n = 0; cache_n < 2; cache_n++)
+            {
+                io.ConfigTextSizeCache = (cache_n == 1);
+                float sum = 0.0f;
+                for (int repeat_n = 0; repeat_n < repeat_count; repeat_n++)
+                {
+                    const double t0 = GetTimeMs();
+                    for (const std::string& label : labels)
+                        sum += ImGui::CalcTextSize(label.c_str(), NULL, true, wrap_width).x;
+                    const double t1 = GetTimeMs();
+                    best_ms[cache_n] = (repeat_n == 0) ? (t1 - t0) : std::min(best_ms[cache_n], t1 - t0);
+                }
+                for (const std::string& label : labels)
+                    sizes[cache_n].push_back(ImGui::CalcTextSize(label.c_str(), NULL, true, wrap_width));
+                g_Sink = sum;
+            }
+            const bool identical = memcmp(sizes[0].data(), sizes[1].data(), sizes[0].size() * sizeof(ImVec2)) == 0;
+            printf("- %-10s %-6s %-7s ImGui::CalcTextSize(): %7.2f ns/label, with io.ConfigTextSizeCache %7.2f ns/label, speedup %.2fx, %s\n", font_desc.Name, labels_desc.Name, wrapped ? "wrapped" : "",
+                best_ms[0] * 1e6 / labels.size(), best_ms[1] * 1e6 / labels.size(), best_ms[0] / best_ms[1], identical ? "identical" : "MISMATCH");
+            all_identical &= identical;
+        }
+        ImGui::SetWindowFontScale(1.0f);
+        ImGui::PopFont();
+    }
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+
+    printf("%s\n", all_identical ? "OK" : "FAILED");
+    return all_identical ? 0 : 1;
+}
@@ -0,0 +1,182 @@
+// Dear ImGui: headless test of draw lists filled by worker threads (see ImGui::BeginDrawListThreads() and ImDrawList::AddDrawList())
+// (compile and link imgui, create context, run headless with NO INPUTS, fill draw lists on worker threads then append them on the main thread)
+// Every frame, workers fill their own draw lists, which are appended to a window draw list, or to ImDrawData after Render().
+// It checks that output is identical to filling the same draw lists on the main thread, for combinations of backend features,
+// and prints timings for each number of threads. Build with 'make WITH_TSAN=1' to run it under ThreadSanitizer.
+// Usage:
+//   example_null_threads [--threads N] [--frames N]
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static const int LISTS_COUNT = 16;
+
+static double GetTimeMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
+}
+
+// Content of a heavy custom canvas, different for each list and frame
+static void FillCanvas(ImDrawList* draw_list, int list_n, int frame_n)
+{
+    draw_list->ResetForNewFrame();
+    const ImVec2 origin((float)(list_n % 4) * 300.0f + 20.0f, (float)(list_n / 4) * 180.0f + 40.0f);
+    char buf[32];
+    for (int n = 0; n < 60; n++)
+    {
+        const float t = (float)(n + frame_n) * 0.1f;
+        const ImVec2 p(origin.x + (float)(n % 10) * 28.0f, origin.y + (float)(n / 10) * 28.0f);
+        const ImU32 col = IM_COL32(50 + n * 3, 100 + list_n * 9, 200 - n * 2, 255);
+        switch (n % 5)
+        {
+        case 0: draw_list->AddRectFilled(p, ImVec2(p.x + 20.0f, p.y + 20.0f), col, 4.0f); break;
+        case 1: draw_list->AddCircle(ImVec2(p.x + 10.0f, p.y + 10.0f), 8.0f + ImSin(t) * 2.0f, col, 0, 1.5f); break;
+        case 2: draw_list->AddLine(p, ImVec2(p.x + 20.0f, p.y + 20.0f * ImCos(t)), col, 2.0f); break;
+        case 3: draw_list->AddTriangleFilled(p, ImVec2(p.x + 20.0f, p.y + 5.0f), ImVec2(p.x + 10.0f, p.y + 20.0f), col); break;
+        case 4: snprintf(buf, sizeof(buf), "%d", list_n * 100 + n + frame_n); draw_list->AddText(p, col, buf); break;
+        }
+    }
+    ImVec2 points[64];
+    for (int n = 0; n < IM_ARRAYSIZE(points); n++)
+        points[n] = ImVec2(origin.x + (float)n * 4.0f, origin.y + 160.0f + ImSin((float)(n + frame_n + list_n) * 0.3f) * 10.0f);
+    draw_list->AddPolyline(points, IM_ARRAYSIZE(points), IM_COL32(255, 255, 0, 255), ImDrawFlags_None, 2.0f);
+}
+
+// Hash of rendered output: vertices, indices (read through IdxSegments[]) and draw commands
+static ImGuiID HashDrawData(const ImDrawData* draw_data)
+{
+    ImGuiID hash = 0;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        hash = ImHashData(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert), hash);
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            const unsigned int header[4] = { cmd.VtxOffset, cmd.IdxOffset, cmd.ElemCount, cmd.RectCount };
+            hash = ImHashData(header, sizeof(header), hash);
+            hash = ImHashData(&cmd.ClipRect, sizeof(cmd.ClipRect), hash);
+            for (unsigned int idx_n = cmd.IdxOffset; idx_n < cmd.IdxOffset + cmd.ElemCount; idx_n++)
+            {
+                const unsigned int idx = draw_list->_GetIdx((int)idx_n);
+                hash = ImHashData(&idx, sizeof(idx), hash);
+            }
+        }
+    }
+    return hash;
+}
+
+// Run all frames, filling draw lists with 'threads_count' threads (0: on the main thread). Return hash of all frames.
+static ImGuiID RunFrames(ImGuiBackendFlags backend_flags, bool frame_arena, int threads_count, int frames_count, double* out_ms)
+{
+    ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.DisplaySize = ImVec2(1280, 800);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= backend_flags;
+    io.ConfigDrawListFrameArena = frame_arena;
+    unsigned char* tex_pixels = nullptr;
+    int tex_w, tex_h;
+    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    std::vector<ImDrawList*> draw_lists;
+    ImGuiID hash = 0;
+    double total_ms = 0.0;
+    for (int frame_n = 0; frame_n < frames_count; frame_n++)
+    {
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0, 0));
+        ImGui::SetNextWindowSize(io.DisplaySize);
+        ImGui::Begin("Canvas", nullptr, ImGuiWindowFlags_NoDecoration);
+        ImGui::Text("Frame %d", frame_n);
+
+        // Fill draw lists
+        const double t0 = GetTimeMs();
+        ImDrawListSharedData* shared_data = ImGui::BeginDrawListThreads();
+        if (draw_lists.empty())
+            for (int list_n = 0; list_n < LISTS_COUNT; list_n++)
+                draw_lists.push_back(IM_NEW(ImDrawList)(shared_data));
+        if (threads_count == 0)
+        {
+            for (int list_n = 0; list_n < LISTS_COUNT; list_n++)
+                FillCanvas(draw_lists[list_n], list_n, frame_n);
+        }
+        else
+        {
+            std::vector<std::thread> threads;
+            for (int thread_n = 0; thread_n < threads_count; thread_n++)
+                threads.emplace_back([&draw_lists, thread_n, threads_count, frame_n]()
+                {
+                    for (int list_n = thread_n; list_n < LISTS_COUNT; list_n += threads_count)
+                        FillCanvas(draw_lists[list_n], list_n, frame_n);
+                });
+            for (std::thread& thread : threads)
+                thread.join();
+        }
+        ImGui::EndDrawListThreads();
+
+        // Append all but last list to window, last one is drawn over everything else
+        for (int list_n = 0; list_n < LISTS_COUNT - 1; list_n++)
+            ImGui::GetWindowDrawList()->AddDrawList(draw_lists[list_n]);
+        total_ms += GetTimeMs() - t0;
+        ImGui::End();
+
+        ImGui::Render();
+        ImGui::GetDrawData()->AddDrawList(draw_lists[LISTS_COUNT - 1]);
+        hash = ImHashData(&hash, sizeof(hash), HashDrawData(ImGui::GetDrawData()));
+    }
+    for (ImDrawList* draw_list : draw_lists)
+        IM_DELETE(draw_list);
+    ImGui::DestroyContext();
+    *out_ms = total_ms / frames_count;
+    return hash;
+}
+
+int main(int argc, char** argv)
+{
+    IMGUI_CHECKVERSION();
+    int max_threads = std::max((int)std::thread::hardware_concurrency(), 4);
+    int frames_count = 60;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--threads") == 0 && n + 1 < argc)
+            max_threads = std::max(atoi(argv[++n]), 1);
+        else if (strcmp(argv[n], "--frames") == 0 && n + 1 < argc)
+            frames_count = std::max(atoi(argv[++n]), 1);
+        else
+        {
+            printf("Usage: %s [--threads N] [--frames N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    struct ConfigDesc { const char* Name; ImGuiBackendFlags BackendFlags; bool FrameArena; };
+    const ConfigDesc configs[] =
+    {
+        { "default",                        ImGuiBackendFlags_None, false },
+        { "VtxOffset",                      ImGuiBackendFlags_RendererHasVtxOffset, false },
+        { "VtxOffset+IdxSegments+arena",    ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasIdxSegments, true },
+    };
+    bool all_identical = true;
+    for (const ConfigDesc& config : configs)
+    {
+        double ref_ms;
+        const ImGuiID ref_hash = RunFrames(config.BackendFlags, config.FrameArena, 0, frames_count, &ref_ms);
+        printf("- %-28s main thread: %6.3f ms/frame\n", config.Name, ref_ms);
+        for (int threads_count = 1; threads_count <= max_threads; threads_count *= 2)
+        {
+            double ms;
+            const bool identical = RunFrames(config.BackendFlags, config.FrameArena, threads_count, frames_count, &ms) == ref_hash;
+            printf("- %-28s %2d threads:  %6.3f ms/frame (including threads start), %s\n", config.Name, threads_count, ms, identical ? "identical" : "MISMATCH");
+            all_identical &= identical;
+        }
+    }
+
+    printf("%s\n", all_identical ? "OK" : "FAILED");
+    return all_identical ? 0 : 1;
+}
@@ -127,6 +127,13 @@ int main(int, char**)
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application, or clear/overwrite your copy of the mouse data.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+        // We sleep until new events arrive or until dear imgui needs a new frame (e.g. for an animation), see ImGui::GetNextFrameDelay().
+        // Remove this if your application needs to update every frame.
+#ifndef __EMSCRIPTEN__
+        const float next_frame_delay = ImGui::GetNextFrameDelay();
+        if (next_frame_delay > 0.0f)
+            SDL_WaitEventTimeout(nullptr, (next_frame_delay == FLT_MAX) ? -1 : (int)(next_frame_delay * 1000.0f) + 1); // Leaves the event in the queue
+#endif
         SDL_Event event;
         while (SDL_PollEvent(&event))
         {
@@ -49,6 +49,7 @@
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
+//#define IMGUI_DISABLE_NEON                                // Disable use of NEON intrinsics even if available
 
 //---- Enable Test Engine / Automation features.
 //#define IMGUI_ENABLE_TEST_ENGINE                          // Enable imgui_test_engine hooks. Generally set automatically by include "imgui_te_config.h", see Test Engine for details.
@@ -110,8 +111,15 @@
 // Your renderer backend will need to support it (most example renderer backends support both 16/32-bit indices).
 // Another way to allow large meshes while keeping 16-bit indices is to handle ImDrawCmd::VtxOffset in your renderer.
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
+// When using 32-bit indices, renderers setting ImGuiBackendFlags_RendererHasPackedIdx get 16-bit indices for draw lists with <= 64K vertices.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12 bytes ImDrawVert (default is 20 bytes): positions as 16-bit fixed-point, UV as 16-bit normalized.
+// Positions are stored with IM_DRAWVERT_POS_FRAC_BITS fractional bits (default 3 = 1/8 pixel, range +/-4096, asserting outside of it). Expect tiny rasterization differences on anti-aliased edges.
+// Your renderer backend will need to support it (OpenGL3, Vulkan and Softraster backends do, DirectX9 and Allegro5 convert vertices on the CPU, others fail to compile).
+//#define IMGUI_USE_COMPACT_DRAWVERT
+//#define IM_DRAWVERT_POS_FRAC_BITS 3
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
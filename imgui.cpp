@@ -373,7 +373,7 @@ CODE
     void MyImGuiRenderFunction(ImDrawData* draw_data)
     {
        // TODO: Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled
-       // TODO: Setup texture sampling state: sample with bilinear filtering (NOT point/nearest filtering). Use 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines;' to allow point/nearest filtering.
+       // TODO: Setup texture sampling state: sample with bilinear filtering (NOT point/nearest filtering). Use 'io.Fonts->Flags |= ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_NoBakedRoundCorners;' to allow point/nearest filtering.
        // TODO: Setup viewport covering draw_data->DisplayPos to draw_data->DisplayPos + draw_data->DisplaySize
        // TODO: Setup orthographic projection matrix cover draw_data->DisplayPos to draw_data->DisplayPos + draw_data->DisplaySize
        // TODO: Setup shader: vertex { float2 pos, float2 uv, u32 color }, fragment shader sample color from 1 texture, multiply by vertex color.
@@ -1283,6 +1283,7 @@ ImGuiStyle::ImGuiStyle()
     AntiAliasedLines            = true;             // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU.
     AntiAliasedLinesUseTex      = true;             // Enable anti-aliased lines/borders using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     AntiAliasedFill             = true;             // Enable anti-aliased filled shapes (rounded rectangles, circles, etc.).
+    RoundCornersUseTex          = true;             // Enable anti-aliased circles and rounded rectangles using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     CurveTessellationTol        = 1.25f;            // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     CircleTessellationMaxError  = 0.30f;            // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
 
@@ -1373,6 +1374,11 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigDrawDataMergeLists = false;
+    ConfigDrawListFrameArena = false;
+    ConfigDrawDataDamageRects = false;
+    ConfigTextSizeCache = false;
+    ConfigTextSizeCacheMaxBytes = 512 * 1024;
     ConfigDebugBeginReturnValueOnce = false;
     ConfigDebugBeginReturnValueLoop = false;
 
@@ -3389,13 +3395,20 @@ const char* ImGui::GetStyleColorName(ImGuiCol idx)
 
 const char* ImGui::FindRenderedTextEnd(const char* text, const char* text_end)
 {
-    const char* text_display_end = text;
+    // Stop at first '\0' or '##'. Using strlen()/memchr() which are vectorized by most C libraries, as this runs on every label.
     if (!text_end)
-        text_end = (const char*)-1;
+        text_end = text + strlen(text);
+    else if (const char* text_zero = (const char*)memchr(text, 0, (size_t)(text_end - text)))
+        text_end = text_zero;
 
-    while (text_display_end < text_end && *text_display_end != '\0' && (text_display_end[0] != '#' || text_display_end[1] != '#'))
+    const char* text_display_end = text;
+    while ((text_display_end = (const char*)memchr(text_display_end, '#', (size_t)(text_end - text_display_end))) != NULL)
+    {
+        if (text_display_end[1] == '#')
+            return text_display_end;
         text_display_end++;
-    return text_display_end;
+    }
+    return text_end;
 }
 
 // Internal ImGui functions to render text
@@ -3767,7 +3780,6 @@ void ImGui::Shutdown()
         IM_DELETE(g.IO.Fonts);
     }
     g.IO.Fonts = NULL;
-    g.DrawListSharedData.TempBuffer.clear();
 
     // Cleanup of other data are conditional on actually having initialized Dear ImGui.
     if (!g.Initialized)
@@ -3832,6 +3844,11 @@ void ImGui::Shutdown()
     g.DebugLogBuf.clear();
     g.DebugLogIndex.clear();
 
+    g.TextSizeCache.ClearFreeMemory();
+
+    // Last, after all draw lists and splitters have been destroyed
+    g.DrawListFrameArena.ClearFreeMemory();
+
     g.Initialized = false;
 }
 
@@ -3886,13 +3903,14 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* ctx, const char* name) : DrawListInst(NUL
     AutoPosLastDirection = ImGuiDir_None;
     SetWindowPosAllowFlags = SetWindowSizeAllowFlags = SetWindowCollapsedAllowFlags = 0;
     SetWindowPosVal = SetWindowPosPivot = ImVec2(FLT_MAX, FLT_MAX);
-    LastFrameActive = -1;
+    LastFrameActive = LastFrameRefreshed = -1;
     LastTimeActive = -1.0f;
     FontWindowScale = 1.0f;
     SettingsOffset = -1;
     DrawList = &DrawListInst;
     DrawList->_Data = &Ctx->DrawListSharedData;
     DrawList->_OwnerName = Name;
+    DrawList->_FrameArena = &Ctx->DrawListFrameArena;
     NavPreferredScoringPosRel[0] = NavPreferredScoringPosRel[1] = ImVec2(FLT_MAX, FLT_MAX);
 }
 
@@ -3923,6 +3941,8 @@ void ImGui::GcCompactTransientMiscBuffers()
     g.ItemFlagsStack.clear();
     g.GroupStack.clear();
     TableGcCompactSettings();
+    g.TextSizeCache.ClearFreeMemory();
+    g.PlotLinesBuffer.clear();
 }
 
 // Free up/compact internal window buffers, we can use this when a window becomes unused.
@@ -3944,10 +3964,14 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
 void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
 {
     // We stored capacity of the ImDrawList buffer to reduce growth-caused allocation/copy when awakening.
-    // The other buffers tends to amortize much faster.
+    // The other buffers tends to amortize much faster. With io.ConfigDrawListFrameArena, they are allocated from the arena as they grow.
+    ImGuiContext& g = *GImGui;
     window->MemoryCompacted = false;
-    window->DrawList->IdxBuffer.reserve(window->MemoryDrawListIdxCapacity);
-    window->DrawList->VtxBuffer.reserve(window->MemoryDrawListVtxCapacity);
+    if (!g.DrawListFrameArena.Enabled)
+    {
+        window->DrawList->IdxBuffer.reserve(window->MemoryDrawListIdxCapacity);
+        window->DrawList->VtxBuffer.reserve(window->MemoryDrawListVtxCapacity);
+    }
     window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
 }
 
@@ -4177,10 +4201,16 @@ bool ImGui::IsItemHovered(ImGuiHoveredFlags flags)
         // but once unlocked on a given item we also moving.
         //if (g.HoverDelayTimer >= delay && (g.HoverDelayTimer - g.IO.DeltaTime < delay || g.MouseStationaryTimer - g.IO.DeltaTime < g.Style.HoverStationaryDelay)) { IMGUI_DEBUG_LOG("HoverDelayTimer = %f/%f, MouseStationaryTimer = %f\n", g.HoverDelayTimer, delay, g.MouseStationaryTimer); }
         if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverItemUnlockedStationaryId != hover_delay_id)
+        {
+            RequestNextFrame(g.Style.HoverStationaryDelay - g.MouseStationaryTimer);
             return false;
+        }
 
         if (g.HoverItemDelayTimer < delay)
+        {
+            RequestNextFrame(delay - g.HoverItemDelayTimer);
             return false;
+        }
     }
 
     return true;
@@ -4324,7 +4354,8 @@ void* ImGui::MemAlloc(size_t size)
     void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ImGuiContext* ctx = GImGui)
-        DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
+        if (!ctx->DrawListThreadsActive)
+            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, size);
 #endif
     return ptr;
 }
@@ -4332,10 +4363,16 @@ void* ImGui::MemAlloc(size_t size)
 // IM_FREE() == ImGui::MemFree()
 void ImGui::MemFree(void* ptr)
 {
+    // Draw lists buffers allocated from the frame arena are not individually freed (see io.ConfigDrawListFrameArena)
+    if (ptr != NULL)
+        if (ImGuiContext* ctx = GImGui)
+            if (ctx->DrawListFrameArena.Contains(ptr))
+                return;
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ptr != NULL)
         if (ImGuiContext* ctx = GImGui)
-            DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
+            if (!ctx->DrawListThreadsActive)
+                DebugAllocHook(&ctx->DebugAllocInfo, ctx->FrameCount, ptr, (size_t)-1);
 #endif
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
@@ -4408,6 +4445,21 @@ int ImGui::GetFrameCount()
     return GImGui->FrameCount;
 }
 
+float ImGui::GetNextFrameDelay()
+{
+    return GImGui->NextFrameDelay;
+}
+
+// Requests made after EndFrame() (e.g. while rendering) apply to the value returned by GetNextFrameDelay() immediately.
+void ImGui::RequestNextFrame(float delay)
+{
+    ImGuiContext& g = *GImGui;
+    delay = ImMax(delay, 0.0f);
+    g.NextFrameDelayRequested = ImMin(g.NextFrameDelayRequested, delay);
+    if (g.FrameCountEnded == g.FrameCount)
+        g.NextFrameDelay = ImMin(g.NextFrameDelay, delay);
+}
+
 static ImDrawList* GetViewportBgFgDrawList(ImGuiViewportP* viewport, size_t drawlist_no, const char* drawlist_name)
 {
     // Create the draw list on demand, because they are not frequently used for all viewports
@@ -4418,6 +4470,7 @@ static ImDrawList* GetViewportBgFgDrawList(ImGuiViewportP* viewport, size_t draw
     {
         draw_list = IM_NEW(ImDrawList)(&g.DrawListSharedData);
         draw_list->_OwnerName = drawlist_name;
+        draw_list->_FrameArena = &g.DrawListFrameArena;
         viewport->BgFgDrawLists[drawlist_no] = draw_list;
     }
 
@@ -4459,6 +4512,58 @@ ImDrawListSharedData* ImGui::GetDrawListSharedData()
     return &GImGui->DrawListSharedData;
 }
 
+// DrawListSharedData is modified while submitting the frame (current font size, circle tables built on first use), so other threads can't read it.
+// We update a copy with ReadOnly set: tables used by small circles are built upfront, other ones are calculated on the fly.
+// Until EndDrawListThreads(), memory allocations are not recorded in DebugAllocInfo (so allocation counts displayed in Metrics may be off).
+// With ImFontAtlasFlags_DynamicGlyphs, text rendered by other threads only uses glyphs already rasterized, and no glyph is evicted until next frame.
+// Missing glyphs are rasterized by EndDrawListThreads(), so they are displayed from next frame.
+ImDrawListSharedData* ImGui::BeginDrawListThreads()
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(!g.DrawListThreadsActive && "Calling BeginDrawListThreads() twice without EndDrawListThreads()?");
+    g.DrawListThreadsActive = true;
+    g.DrawListFrameArena.BlocksLocked = true;
+    if (ImFontAtlasDynamicGlyphs* dg = g.IO.Fonts->DynamicGlyphs)
+    {
+        dg->NoEvictFrame = dg->FrameCount;
+        dg->ThreadsMissed.resize(dg->Glyphs.Size);
+        dg->ThreadsMissedCount = 0;
+    }
+
+    ImDrawListSharedData* src = &g.DrawListSharedData;
+    ImDrawListSharedData* dst = &g.DrawListSharedDataForThreads;
+    for (int radius = 0; radius < IM_ARRAYSIZE(src->CircleSegmentCounts); radius++)
+        src->GetCircleVtx(src->CircleSegmentCounts[radius]);
+    if (dst->CircleVtxBuffer.Size != src->CircleVtxBuffer.Size) // Tables are only ever appended
+    {
+        dst->CircleVtxBuffer = src->CircleVtxBuffer;
+        dst->CircleVtxOffsets = src->CircleVtxOffsets;
+    }
+    dst->TexUvWhitePixel = src->TexUvWhitePixel;
+    dst->TexUvLines = src->TexUvLines;
+    dst->TexUvRoundCornersFilled = src->TexUvRoundCornersFilled;
+    dst->TexUvRoundCornersStroked = src->TexUvRoundCornersStroked;
+    dst->Font = src->Font;
+    dst->FontSize = src->FontSize;
+    dst->FontScale = src->FontScale;
+    dst->CurveTessellationTol = src->CurveTessellationTol;
+    dst->ClipRectFullscreen = src->ClipRectFullscreen;
+    dst->InitialFlags = src->InitialFlags;
+    dst->SetCircleTessellationMaxError(src->CircleSegmentMaxError);
+    dst->ReadOnly = true;
+    return dst;
+}
+
+void ImGui::EndDrawListThreads()
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(g.DrawListThreadsActive && "Calling EndDrawListThreads() without BeginDrawListThreads()?");
+    g.DrawListThreadsActive = false;
+    g.DrawListFrameArena.BlocksLocked = false;
+    if (g.IO.Fonts->DynamicGlyphs)
+        ImFontAtlasBuildLoadDynamicGlyphsMissedByThreads(g.IO.Fonts);
+}
+
 void ImGui::StartMouseMovingWindow(ImGuiWindow* window)
 {
     // Set ActiveId even if the _NoMove flag is set. Without it, dragging away from a window with _NoMove would activate hover on other windows.
@@ -4674,8 +4779,16 @@ static void SetupDrawListSharedData()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
+    if (g.Style.RoundCornersUseTex && !(g.IO.Fonts->Flags & ImFontAtlasFlags_NoBakedRoundCorners))
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_RoundCornersUseTex;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if ((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasPackedIdx) && sizeof(ImDrawIdx) == 4)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowPackedIdx;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasRectInstances)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowRectInstances;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasIdxSegments)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowIdxSegments;
 }
 
 void ImGui::NewFrame()
@@ -4700,6 +4813,7 @@ void ImGui::NewFrame()
     g.Time += g.IO.DeltaTime;
     g.WithinFrameScope = true;
     g.FrameCount += 1;
+    g.NextFrameDelayRequested = FLT_MAX;
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -4720,9 +4834,34 @@ void ImGui::NewFrame()
 
     // Setup current font and draw list shared data
     g.IO.Fonts->Locked = true;
+    if (ImFontAtlasDynamicGlyphs* dg = g.IO.Fonts->DynamicGlyphs)
+    {
+        // Windows which skipped refresh last frame will likely do so again: keep glyphs of their contents from the start of the frame
+        dg->FrameCount++;
+        dg->RetainedFrame = dg->FrameCount;
+        for (ImGuiWindow* window : g.Windows)
+            if (window->Active && window->SkipRefresh)
+                dg->RetainedFrame = ImMin(dg->RetainedFrame, dg->FrameCount - (g.FrameCount - window->LastFrameRefreshed));
+    }
     SetupDrawListSharedData();
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
+    // Draw lists not rendered last frame still point to storage of the arena set about to be reused: move their contents to the heap (e.g. for Metrics/Debugger)
+    if (g.DrawListFrameArena.GetBlocksSize() > 0)
+    {
+        for (ImGuiWindow* window : g.Windows)
+            if (!window->Active)
+                window->DrawListInst._DetachFromFrameArena();
+        for (ImGuiViewportP* viewport : g.Viewports)
+            for (int drawlist_no = 0; drawlist_no < IM_ARRAYSIZE(viewport->BgFgDrawLists); drawlist_no++)
+                if (viewport->BgFgDrawLists[drawlist_no] != NULL && viewport->BgFgDrawListsLastFrame[drawlist_no] != g.FrameCount - 1)
+                    viewport->BgFgDrawLists[drawlist_no]->_DetachFromFrameArena();
+    }
+    g.DrawListFrameArena.Enabled = g.IO.ConfigDrawListFrameArena;
+    g.DrawListFrameArena.NewFrame();
+    g.TextSizeCache.NewFrame();
+    if (!g.IO.ConfigTextSizeCache && g.TextSizeCache.Entries.Size > 0)
+        g.TextSizeCache.ClearFreeMemory();
 
     // Mark rendering data as invalid to prevent user who may have a handle on it to use it.
     for (ImGuiViewportP* viewport : g.Viewports)
@@ -5030,6 +5169,7 @@ static void InitViewportDrawData(ImGuiViewportP* viewport)
     draw_data->Valid = true;
     draw_data->CmdListsCount = 0;
     draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    draw_data->DamageRects.resize(0);
     draw_data->DisplayPos = viewport->Pos;
     draw_data->DisplaySize = viewport->Size;
     draw_data->FramebufferScale = io.DisplayFramebufferScale;
@@ -5075,7 +5215,7 @@ static void ImGui::RenderDimmedBackgroundBehindWindow(ImGuiWindow* window, ImU32
         draw_list->PushClipRect(viewport_rect.Min - ImVec2(1, 1), viewport_rect.Max + ImVec2(1, 1), false); // FIXME: Need to stricty ensure ImDrawCmd are not merged (ElemCount==6 checks below will verify that)
         draw_list->AddRectFilled(viewport_rect.Min, viewport_rect.Max, col);
         ImDrawCmd cmd = draw_list->CmdBuffer.back();
-        IM_ASSERT(cmd.ElemCount == 6);
+        IM_ASSERT(cmd.ElemCount == 6 || cmd.RectCount == 1);
         draw_list->CmdBuffer.pop_back();
         draw_list->CmdBuffer.push_front(cmd);
         draw_list->AddDrawCmd(); // We need to create a command as CmdBuffer.back().IdxOffset won't be correct if we append to same command.
@@ -5138,6 +5278,54 @@ static void ImGui::RenderDimmedBackgrounds()
     }
 }
 
+// Return delay until a new frame is needed if no input is received (see GetNextFrameDelay()).
+// Widgets with time-based behaviors (e.g. hover delays, text cursor blinking) call RequestNextFrame() themselves.
+static float CalcNextFrameDelay()
+{
+    ImGuiContext& g = *GImGui;
+
+    // Pending or just processed inputs: the next frame may react to them (e.g. a value toggled by a click is used before the button)
+    if (g.InputEventsQueue.Size > 0 || g.InputEventsTrail.Size > 0)
+        return 0.0f;
+
+    // Active mouse interactions (e.g. auto-scrolling while dragging), requests processed on next frame, animations
+    if ((g.ActiveId != 0 && ImGui::IsAnyMouseDown()) || g.DragDropActive)
+        return 0.0f;
+    if (g.NavInitRequest || g.NavMoveSubmitted || g.NavMoveForwardToNextFrame || g.NavNextActivateId != 0 || g.NavWindowingTarget != NULL || g.NavWindowingTargetAnim != NULL)
+        return 0.0f;
+    if ((ImGui::GetTopMostPopupModal() != NULL) ? (g.DimBgRatio < 1.0f) : (g.DimBgRatio > 0.0f))
+        return 0.0f;
+    for (ImGuiWindow* window : g.Windows) // Windows hidden while measuring their size (e.g. appearing popups), auto-fitting or scrolling
+        if (window->Active)
+            if ((window->HiddenFramesCannotSkipItems > 0 && !(window->Flags & ImGuiWindowFlags_ChildWindow)) || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->ScrollTarget.x != FLT_MAX || window->ScrollTarget.y != FLT_MAX)
+                return 0.0f;
+
+    // Keyboard/gamepad keys held: next repeat, for any of the repeat rates
+    float delay = g.NextFrameDelayRequested;
+    for (int key = ImGuiKey_Keyboard_BEGIN; key < ImGuiKey_Gamepad_END; key++)
+    {
+        const ImGuiKeyData* key_data = &g.IO.KeysData[key - ImGuiKey_KeysData_OFFSET];
+        if (!key_data->Down || ImGui::IsModKey((ImGuiKey)key))
+            continue;
+        const float t = key_data->DownDuration;
+        const ImGuiInputFlags repeat_rates[] = { ImGuiInputFlags_RepeatRateDefault, ImGuiInputFlags_RepeatRateNavMove, ImGuiInputFlags_RepeatRateNavTweak };
+        for (ImGuiInputFlags repeat_rate_flags : repeat_rates)
+        {
+            float repeat_delay, repeat_rate;
+            ImGui::GetTypematicRepeatRate(repeat_rate_flags, &repeat_delay, &repeat_rate);
+            if (t < repeat_delay)
+                delay = ImMin(delay, repeat_delay - t);
+            else if (repeat_rate > 0.0f)
+                delay = ImMin(delay, repeat_rate - ImFmod(t - repeat_delay, repeat_rate));
+        }
+    }
+
+    // Save .ini settings
+    if (g.SettingsDirtyTimer > 0.0f)
+        delay = ImMin(delay, g.SettingsDirtyTimer);
+    return ImMax(delay, 0.0f);
+}
+
 // This is normally called by Render(). You may want to call it directly if you want to avoid calling Render() but the gain will be very minimal.
 void ImGui::EndFrame()
 {
@@ -5192,6 +5380,9 @@ void ImGui::EndFrame()
         g.DragDropWithinSource = false;
     }
 
+    // Find out when we need the next frame if no input is received
+    g.NextFrameDelay = CalcNextFrameDelay();
+
     // End frame
     g.WithinFrameScope = false;
     g.FrameCountEnded = g.FrameCount;
@@ -5275,6 +5466,7 @@ void ImGui::Render()
 
     // Setup ImDrawData structures for end-user
     g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = 0;
+    g.IO.MetricsRenderDrawCmds = g.IO.MetricsRenderDrawCmdsBeforeMerge = 0;
     for (ImGuiViewportP* viewport : g.Viewports)
     {
         FlattenDrawDataIntoSingleLayer(&viewport->DrawDataBuilder);
@@ -5289,13 +5481,53 @@ void ImGui::Render()
         for (ImDrawList* draw_list : draw_data->CmdLists)
             draw_list->_PopUnusedDrawCmd();
 
+        // Compare output with previous frame. Done before merging draw lists, which would make the comparison depend on merging decisions.
+        if (g.IO.ConfigDrawDataDamageRects)
+            ComputeDrawDataDamageRects(draw_data, &viewport->DrawDataBuilder.DamageState);
+        else if (viewport->DrawDataBuilder.DamageState.Valid)
+            viewport->DrawDataBuilder.DamageState.ClearFreeMemory();
+
+        // Merge consecutive draw lists to reduce draw calls
+        const int cmd_count_before_merge = CalcDrawDataCmdCount(draw_data);
+        if (g.IO.ConfigDrawDataMergeLists)
+            MergeDrawDataLists(draw_data, &viewport->DrawDataBuilder.MergedLists);
+
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
+        g.IO.MetricsRenderDrawCmds += g.IO.ConfigDrawDataMergeLists ? CalcDrawDataCmdCount(draw_data) : cmd_count_before_merge;
+        g.IO.MetricsRenderDrawCmdsBeforeMerge += cmd_count_before_merge;
     }
 
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
 }
 
+// Hash of inputs of CalcTextSize() for io.ConfigTextSizeCache. Text is read 8 bytes at a time:
+// ImHashData() reads one byte at a time, which would cost about as much as measuring the text.
+static ImGuiID TextSizeCacheHash(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end)
+{
+    ImU32 font_size_bits, wrap_width_bits;
+    memcpy(&font_size_bits, &font_size, sizeof(float));
+    memcpy(&wrap_width_bits, &wrap_width, sizeof(float));
+    ImU64 h = (ImU64)(intptr_t)font ^ ((ImU64)font_size_bits << 32 | wrap_width_bits) ^ ((ImU64)(text_end - text) * 0x9E3779B97F4A7C15ULL);
+    for (; text_end - text >= 8; text += 8)
+    {
+        ImU64 v;
+        memcpy(&v, text, 8);
+        h = (h ^ v) * 0x9E3779B97F4A7C15ULL;
+        h ^= h >> 32;
+    }
+    if (text < text_end)
+    {
+        ImU64 v = 0;
+        memcpy(&v, text, (size_t)(text_end - text));
+        h = (h ^ v) * 0x9E3779B97F4A7C15ULL;
+    }
+    h ^= h >> 33; // Final mix from MurmurHash3
+    h *= 0xFF51AFD7ED558CCDULL;
+    h ^= h >> 33;
+    return (ImGuiID)h;
+}
+
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
 // CalcTextSize("") should return ImVec2(0.0f, g.FontSize)
 ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
@@ -5312,6 +5544,31 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
+
+    // Reuse result of a previous call with same inputs (see io.ConfigTextSizeCache)
+    // Short texts without wrapping are skipped: CalcTextSizeA() measures them about as fast as we would look them up.
+    ImGuiTextSizeCache* cache = NULL;
+    ImGuiID cache_hash = 0;
+    if (g.IO.ConfigTextSizeCache)
+    {
+        if (!text_display_end)
+            text_display_end = text + strlen(text);
+        if (wrap_width > 0.0f || text_display_end - text >= IMGUI_TEXT_SIZE_CACHE_MIN_LENGTH)
+            cache = &g.TextSizeCache;
+    }
+    if (cache)
+    {
+        wrap_width = (wrap_width > 0.0f) ? wrap_width : 0.0f; // All values <= 0.0f disable wrapping
+        cache_hash = TextSizeCacheHash(font, font_size, wrap_width, text, text_display_end);
+        ImVec2 cached_text_size;
+        if (cache->Find(font, font_size, wrap_width, text, text_display_end, cache_hash, &cached_text_size))
+        {
+            cache->Hits++;
+            return cached_text_size;
+        }
+        cache->Misses++;
+    }
+
     ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
@@ -5321,9 +5578,118 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     // - https://embarkstudios.github.io/rust-gpu/api/src/libm/math/ceilf.rs.html
     text_size.x = IM_TRUNC(text_size.x + 0.99999f);
 
+    if (cache)
+        cache->Add(font, font_size, wrap_width, text, text_display_end, cache_hash, text_size, g.IO.ConfigTextSizeCacheMaxBytes);
     return text_size;
 }
 
+// Size of hash table to hold 'entries_count' entries while staying at most half full
+static int TextSizeCacheCalcEntriesSize(int entries_count, int current_size)
+{
+    int size = (current_size > 0) ? current_size : 64;
+    while (entries_count * 2 > size)
+        size *= 2;
+    return size;
+}
+
+static int TextSizeCacheCalcMemoryBytesAfterAdd(const ImGuiTextSizeCache* cache, int text_len)
+{
+    const ImVector<char>& text_buf = cache->TextBuf;
+    const int text_capacity = (text_buf.Size + text_len > text_buf.Capacity) ? text_buf._grow_capacity(text_buf.Size + text_len) : text_buf.Capacity;
+    return TextSizeCacheCalcEntriesSize(cache->EntriesCount + 1, cache->Entries.Size) * (int)sizeof(ImGuiTextSizeCacheEntry) + text_capacity;
+}
+
+static void TextSizeCacheInsertEntry(ImVector<ImGuiTextSizeCacheEntry>& entries, const ImGuiTextSizeCacheEntry& entry)
+{
+    const int mask = entries.Size - 1;
+    int slot = (int)(entry.Hash & (ImGuiID)mask);
+    while (entries.Data[slot].Font != NULL)
+        slot = (slot + 1) & mask;
+    entries.Data[slot] = entry;
+}
+
+bool ImGuiTextSizeCache::Find(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end, ImGuiID hash, ImVec2* out_size)
+{
+    // Flush when fonts may have changed
+    if (font->ContainerAtlas != Atlas || font->ContainerAtlas->FontsGeneration != AtlasFontsGeneration)
+    {
+        Flush();
+        Atlas = font->ContainerAtlas;
+        AtlasFontsGeneration = Atlas->FontsGeneration;
+        return false;
+    }
+    if (EntriesCount == 0)
+        return false;
+
+    // Linear probing: table is never full
+    const int text_len = (int)(text_end - text);
+    const int mask = Entries.Size - 1;
+    for (int slot = (int)(hash & (ImGuiID)mask); Entries.Data[slot].Font != NULL; slot = (slot + 1) & mask)
+    {
+        const ImGuiTextSizeCacheEntry& entry = Entries.Data[slot];
+        if (entry.Hash == hash && entry.Font == font && entry.FontSize == font_size && entry.WrapWidth == wrap_width && entry.TextLen == text_len && memcmp(TextBuf.Data + entry.TextOffset, text, (size_t)text_len) == 0)
+        {
+            *out_size = entry.Size;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Entry must not be in cache already (call Find() first)
+void ImGuiTextSizeCache::Add(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end, ImGuiID hash, const ImVec2& size, int max_bytes)
+{
+    // Flush when buffers would need to grow past memory budget. Free them if still too large (e.g. budget was lowered).
+    const int text_len = (int)(text_end - text);
+    if (TextSizeCacheCalcMemoryBytesAfterAdd(this, text_len) > max_bytes)
+    {
+        Flush();
+        if (TextSizeCacheCalcMemoryBytesAfterAdd(this, text_len) > max_bytes)
+        {
+            Entries.clear();
+            TextBuf.clear();
+            if (TextSizeCacheCalcMemoryBytesAfterAdd(this, text_len) > max_bytes)
+                return;
+        }
+    }
+
+    // Grow hash table
+    const int entries_size = TextSizeCacheCalcEntriesSize(EntriesCount + 1, Entries.Size);
+    if (entries_size != Entries.Size)
+    {
+        ImVector<ImGuiTextSizeCacheEntry> old_entries;
+        old_entries.swap(Entries);
+        Entries.resize(entries_size);
+        memset(Entries.Data, 0, (size_t)Entries.size_in_bytes());
+        for (const ImGuiTextSizeCacheEntry& entry : old_entries)
+            if (entry.Font != NULL)
+                TextSizeCacheInsertEntry(Entries, entry);
+    }
+
+    ImGuiTextSizeCacheEntry entry;
+    entry.Font = font;
+    entry.FontSize = font_size;
+    entry.WrapWidth = wrap_width;
+    entry.Hash = hash;
+    entry.TextOffset = TextBuf.Size;
+    entry.TextLen = text_len;
+    entry.Size = size;
+    TextBuf.resize(TextBuf.Size + text_len);
+    memcpy(TextBuf.Data + entry.TextOffset, text, (size_t)text_len);
+    TextSizeCacheInsertEntry(Entries, entry);
+    EntriesCount++;
+}
+
+void ImGuiTextSizeCache::Flush()
+{
+    if (EntriesCount == 0)
+        return;
+    memset(Entries.Data, 0, (size_t)Entries.size_in_bytes());
+    TextBuf.resize(0);
+    EntriesCount = 0;
+    FlushesCount++;
+}
+
 // Find window given position, search front-to-back
 // - Typically write output back to g.HoveredWindow and g.HoveredWindowUnderMovingWindow.
 // - FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programmatically
@@ -6107,7 +6473,10 @@ static int ImGui::UpdateWindowManualResize(ImGuiWindow* window, const ImVec2& si
         ButtonBehavior(border_rect, border_id, &hovered, &held, ImGuiButtonFlags_FlattenChildren | ImGuiButtonFlags_NoNavFocus);
         //GetForegroundDrawList(window)->AddRect(border_rect.Min, border_rect.Max, IM_COL32(255, 255, 0, 255));
         if (hovered && g.HoveredIdTimer <= WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER)
+        {
+            RequestNextFrame(WINDOWS_RESIZE_FROM_EDGES_FEEDBACK_TIMER - g.HoveredIdTimer);
             hovered = false;
+        }
         if (hovered || held)
             g.MouseCursor = (axis == ImGuiAxis_X) ? ImGuiMouseCursor_ResizeEW : ImGuiMouseCursor_ResizeNS;
         if (held && g.IO.MouseDoubleClicked[0])
@@ -6494,7 +6863,12 @@ void ImGui::UpdateWindowSkipRefresh(ImGuiWindow* window)
         if ((g.NextWindowData.RefreshFlagsVal & ImGuiWindowRefreshFlags_RefreshOnFocus) && g.NavWindow && window->RootWindow == g.NavWindow->RootWindow)
             return;
         window->DrawList = NULL;
+        window->DrawListInst._DetachFromFrameArena(); // Previous frame contents will be rendered again
         window->SkipRefresh = true;
+
+        // Glyphs rasterized on demand used by previous contents must stay in texture
+        if (ImFontAtlasDynamicGlyphs* dg = g.IO.Fonts->DynamicGlyphs)
+            dg->RetainedFrame = ImMin(dg->RetainedFrame, dg->FrameCount - (g.FrameCount - window->LastFrameRefreshed));
     }
 }
 
@@ -6715,6 +7089,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->ClipRect = ImVec4(-FLT_MAX, -FLT_MAX, +FLT_MAX, +FLT_MAX);
         window->IDStack.resize(1);
         window->DrawList->_ResetForNewFrame();
+        window->LastFrameRefreshed = g.FrameCount;
         window->DC.CurrentTableIdx = -1;
 
         // Restore buffer capacity when woken from a compacted state, to avoid
@@ -7062,7 +7437,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
                 ImGuiWindow* previous_child = parent_window->DC.ChildWindows.Size >= 2 ? parent_window->DC.ChildWindows[parent_window->DC.ChildWindows.Size - 2] : NULL;
                 bool previous_child_overlapping = previous_child ? previous_child->Rect().Overlaps(window->Rect()) : false;
                 bool parent_is_empty = (parent_window->DrawList->VtxBuffer.Size == 0);
-                if (window->DrawList->CmdBuffer.back().ElemCount == 0 && !parent_is_empty && !previous_child_overlapping)
+                if (window->DrawList->CmdBuffer.back().ElemCount == 0 && window->DrawList->CmdBuffer.back().RectCount == 0 && !parent_is_empty && !previous_child_overlapping)
                     render_decorations_in_parent = true;
             }
             if (render_decorations_in_parent)
@@ -7523,6 +7898,8 @@ void ImGui::SetCurrentFont(ImFont* font)
     ImFontAtlas* atlas = g.Font->ContainerAtlas;
     g.DrawListSharedData.TexUvWhitePixel = atlas->TexUvWhitePixel;
     g.DrawListSharedData.TexUvLines = atlas->TexUvLines;
+    g.DrawListSharedData.TexUvRoundCornersFilled = atlas->TexUvRoundCornersFilled;
+    g.DrawListSharedData.TexUvRoundCornersStroked = atlas->TexUvRoundCornersStroked;
     g.DrawListSharedData.Font = g.Font;
     g.DrawListSharedData.FontSize = g.FontSize;
     g.DrawListSharedData.FontScale = g.FontScale;
@@ -7744,7 +8121,10 @@ bool ImGui::IsWindowHovered(ImGuiHoveredFlags flags)
     if (flags & ImGuiHoveredFlags_ForTooltip)
         flags = ApplyHoverFlagsForTooltip(flags, g.Style.HoverFlagsForTooltipMouse);
     if ((flags & ImGuiHoveredFlags_Stationary) != 0 && g.HoverWindowUnlockedStationaryId != ref_window->ID)
+    {
+        RequestNextFrame(g.Style.HoverStationaryDelay - g.MouseStationaryTimer);
         return false;
+    }
 
     return true;
 }
@@ -9951,6 +10331,11 @@ static void ImGui::ErrorCheckNewFrameSanityChecks()
     IM_ASSERT((g.FrameCount == 0 || g.FrameCountEnded == g.FrameCount)  && "Forgot to call Render() or EndFrame() at the end of the previous frame?");
     IM_ASSERT(g.IO.DisplaySize.x >= 0.0f && g.IO.DisplaySize.y >= 0.0f  && "Invalid DisplaySize value!");
     IM_ASSERT(g.IO.Fonts->IsBuilt()                                     && "Font Atlas not built! Make sure you called ImGui_ImplXXXX_NewFrame() function for renderer backend, which should call io.Fonts->GetTexDataAsRGBA32() / GetTexDataAsAlpha8()");
+    if (g.IO.Fonts->Flags & ImFontAtlasFlags_DynamicGlyphs)
+    {
+        IM_ASSERT((g.IO.BackendFlags & ImGuiBackendFlags_RendererHasTexUpdates) && "ImFontAtlasFlags_DynamicGlyphs requires a renderer backend uploading io.Fonts->TexUpdates[]!");
+        IM_ASSERT(g.IO.Fonts->TexPixelsAlpha8 != NULL                   && "ImFontAtlasFlags_DynamicGlyphs requires texture data to be kept: don't call io.Fonts->ClearTexData()!");
+    }
     IM_ASSERT(g.Style.CurveTessellationTol > 0.0f                       && "Invalid style setting!");
     IM_ASSERT(g.Style.CircleTessellationMaxError > 0.0f                 && "Invalid style setting!");
     IM_ASSERT(g.Style.Alpha >= 0.0f && g.Style.Alpha <= 1.0f            && "Invalid style setting!"); // Allows us to avoid a few clamps in color computations
@@ -14649,6 +15034,14 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
         Image(atlas->TexID, ImVec2((float)atlas->TexWidth, (float)atlas->TexHeight), ImVec2(0.0f, 0.0f), ImVec2(1.0f, 1.0f), tint_col, border_col);
         TreePop();
     }
+    if (ImFontAtlasDynamicGlyphs* dg = atlas->DynamicGlyphs)
+    {
+        int resident_count = 0;
+        for (const ImFontAtlasDynamicSlot& slot : dg->Slots)
+            resident_count += (slot.GlyphIndex != -1) ? 1 : 0;
+        BulletText("Dynamic glyphs: %d/%d resident, %d shelves, %d/%d rows used", resident_count, dg->Glyphs.Size, dg->Shelves.Size, dg->ShelvesY, atlas->TexHeight);
+        BulletText("Dynamic glyphs: %d loaded, %d evicted, %d failed", dg->StatsLoaded, dg->StatsEvicted, dg->StatsFailed);
+    }
 }
 
 void ImGui::ShowMetricsWindow(bool* p_open)
@@ -14679,7 +15072,15 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     }
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
+    if (io.ConfigDrawDataMergeLists)
+        Text("%d draw commands (%d before merging draw lists)", io.MetricsRenderDrawCmds, io.MetricsRenderDrawCmdsBeforeMerge);
+    else
+        Text("%d draw commands", io.MetricsRenderDrawCmds);
     Text("%d visible windows, %d current allocations", io.MetricsRenderWindows, g.DebugAllocInfo.TotalAllocCount - g.DebugAllocInfo.TotalFreeCount);
+    if (g.NextFrameDelay == FLT_MAX)
+        Text("Next frame needed on next input (idle)");
+    else
+        Text("Next frame needed in %.3f sec", g.NextFrameDelay);
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
     Separator();
@@ -15011,6 +15412,15 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
         Text("%d current allocations", info->TotalAllocCount - info->TotalFreeCount);
         if (SmallButton("GC now")) { g.GcCompactAll = true; }
+        if (g.DrawListFrameArena.GetBlocksSize() > 0)
+            Text("Draw lists frame arena: %d KB used by last frame, %d KB reserved", (int)(g.DrawListFrameArena.UsedBytesPrevFrame / 1024), (int)(g.DrawListFrameArena.GetBlocksSize() / 1024));
+        if (g.IO.ConfigTextSizeCache)
+        {
+            const ImGuiTextSizeCache& cache = g.TextSizeCache;
+            const int lookups_count = cache.HitsPrevFrame + cache.MissesPrevFrame;
+            Text("Text size cache: %d entries, %d KB / %d KB, %d flushes", cache.EntriesCount, cache.GetMemoryBytes() / 1024, g.IO.ConfigTextSizeCacheMaxBytes / 1024, cache.FlushesCount);
+            Text("Text size cache: %d hits, %d misses by last frame (%.1f%% hit rate)", cache.HitsPrevFrame, cache.MissesPrevFrame, lookups_count ? cache.HitsPrevFrame * 100.0f / lookups_count : 0.0f);
+        }
         Text("Recent frames with allocations:");
         int buf_size = IM_ARRAYSIZE(info->LastEntriesBuf);
         for (int n = buf_size - 1; n >= 0; n--)
@@ -15313,9 +15723,11 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
     IM_UNUSED(viewport); // Used in docking branch
     ImGuiMetricsConfig* cfg = &g.DebugMetricsConfig;
     int cmd_count = draw_list->CmdBuffer.Size;
-    if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
+    if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().RectCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
         cmd_count--;
-    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
+    bool node_open = draw_list->RectBuffer.Size > 0
+        ? TreeNode(draw_list, "%s: '%s' %d vtx, %d indices (%d-bit), %d rects, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, draw_list->IdxSize * 8, draw_list->RectBuffer.Size, cmd_count)
+        : TreeNode(draw_list, "%s: '%s' %d vtx, %d indices (%d-bit), %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, draw_list->IdxSize * 8, cmd_count);
     if (draw_list == GetWindowDrawList())
     {
         SameLine();
@@ -15333,6 +15745,8 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
 
     if (window && !window->WasActive)
         TextDisabled("Warning: owning Window is inactive. This DrawList is not being rendered!");
+    if (draw_list->_CulledPrimCount > 0)
+        BulletText("Culled primitives: %d (ImDrawListFlags_CullPrimitives)", draw_list->_CulledPrimCount);
 
     for (const ImDrawCmd* pcmd = draw_list->CmdBuffer.Data; pcmd < draw_list->CmdBuffer.Data + cmd_count; pcmd++)
     {
@@ -15345,24 +15759,44 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         char texid_desc[20];
         FormatTextureIDForDebugDisplay(texid_desc, IM_ARRAYSIZE(texid_desc), pcmd->TextureId);
         char buf[300];
-        ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d tris, Tex %s, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
-            pcmd->ElemCount / 3, texid_desc, pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
+        if (pcmd->RectCount != 0)
+            ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d rects, Tex %s, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
+                pcmd->RectCount, texid_desc, pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
+        else
+            ImFormatString(buf, IM_ARRAYSIZE(buf), "DrawCmd:%5d tris, Tex %s, ClipRect (%4.0f,%4.0f)-(%4.0f,%4.0f)",
+                pcmd->ElemCount / 3, texid_desc, pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
         bool pcmd_node_open = TreeNode((void*)(pcmd - draw_list->CmdBuffer.begin()), "%s", buf);
         if (IsItemHovered() && (cfg->ShowDrawCmdMesh || cfg->ShowDrawCmdBoundingBoxes) && fg_draw_list)
             DebugNodeDrawCmdShowMeshAndBoundingBox(fg_draw_list, draw_list, pcmd, cfg->ShowDrawCmdMesh, cfg->ShowDrawCmdBoundingBoxes);
         if (!pcmd_node_open)
             continue;
 
+        // Display rectangle instances
+        if (pcmd->RectCount != 0)
+        {
+            for (unsigned int rect_n = pcmd->RectOffset; rect_n < pcmd->RectOffset + pcmd->RectCount; rect_n++)
+            {
+                const ImDrawRectInstance& rect = draw_list->RectBuffer[rect_n];
+                ImFormatString(buf, IM_ARRAYSIZE(buf), "Rect: %04d: (%8.2f,%8.2f)-(%8.2f,%8.2f), col %08X, rounding %.2f, thickness %.2f, flags 0x%02X",
+                    rect_n, rect.Min.x, rect.Min.y, rect.Max.x, rect.Max.y, rect.Col, rect.Rounding, rect.Thickness, rect.Flags);
+                Selectable(buf, false);
+                if (fg_draw_list && IsItemHovered())
+                    fg_draw_list->AddRect(rect.Min, rect.Max, IM_COL32(255, 255, 0, 255));
+            }
+            TreePop();
+            continue;
+        }
+
         // Calculate approximate coverage area (touched pixel count)
         // This will be in pixels squared as long there's no post-scaling happening to the renderer output.
-        const ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
+        const bool has_idx_buffer = (draw_list->IdxBuffer.Size > 0);
         const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + pcmd->VtxOffset;
         float total_area = 0.0f;
         for (unsigned int idx_n = pcmd->IdxOffset; idx_n < pcmd->IdxOffset + pcmd->ElemCount; )
         {
             ImVec2 triangle[3];
             for (int n = 0; n < 3; n++, idx_n++)
-                triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos;
+                triangle[n] = vtx_buffer[has_idx_buffer ? draw_list->_GetIdx(idx_n) : idx_n].pos;
             total_area += ImTriangleArea(triangle[0], triangle[1], triangle[2]);
         }
 
@@ -15382,7 +15816,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 ImVec2 triangle[3];
                 for (int n = 0; n < 3; n++, idx_i++)
                 {
-                    const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
+                    const ImDrawVert& v = vtx_buffer[has_idx_buffer ? draw_list->_GetIdx(idx_i) : idx_i];
                     triangle[n] = v.pos;
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
                         (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
@@ -15414,15 +15848,22 @@ void ImGui::DebugNodeDrawCmdShowMeshAndBoundingBox(ImDrawList* out_draw_list, co
     out_draw_list->Flags &= ~ImDrawListFlags_AntiAliasedLines; // Disable AA on triangle outlines is more readable for very large and thin triangles.
     for (unsigned int idx_n = draw_cmd->IdxOffset, idx_end = draw_cmd->IdxOffset + draw_cmd->ElemCount; idx_n < idx_end; )
     {
-        ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL; // We don't hold on those pointers past iterations as ->AddPolyline() may invalidate them if out_draw_list==draw_list
-        ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + draw_cmd->VtxOffset;
+        const bool has_idx_buffer = (draw_list->IdxBuffer.Size > 0);
+        ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + draw_cmd->VtxOffset; // We don't hold on those pointers past iterations as ->AddPolyline() may invalidate them if out_draw_list==draw_list
 
         ImVec2 triangle[3];
         for (int n = 0; n < 3; n++, idx_n++)
-            vtxs_rect.Add((triangle[n] = vtx_buffer[idx_buffer ? idx_buffer[idx_n] : idx_n].pos));
+            vtxs_rect.Add((triangle[n] = vtx_buffer[has_idx_buffer ? draw_list->_GetIdx(idx_n) : idx_n].pos));
         if (show_mesh)
             out_draw_list->AddPolyline(triangle, 3, IM_COL32(255, 255, 0, 255), ImDrawFlags_Closed, 1.0f); // In yellow: mesh triangles
     }
+    for (unsigned int rect_n = draw_cmd->RectOffset, rect_end = draw_cmd->RectOffset + draw_cmd->RectCount; rect_n < rect_end; rect_n++)
+    {
+        ImDrawRectInstance rect = draw_list->RectBuffer[rect_n]; // Copy as ->AddRect() may invalidate pointers if out_draw_list==draw_list
+        vtxs_rect.Add(ImRect(rect.Min, rect.Max));
+        if (show_mesh)
+            out_draw_list->AddRect(rect.Min, rect.Max, IM_COL32(255, 255, 0, 255)); // In yellow: rectangle instances
+    }
     // Draw bounding boxes
     if (show_aabb)
     {
@@ -15604,6 +16045,16 @@ void ImGui::DebugNodeViewport(ImGuiViewportP* viewport)
             (flags & ImGuiViewportFlags_IsPlatformWindow)  ? " IsPlatformWindow"  : "",
             (flags & ImGuiViewportFlags_IsPlatformMonitor) ? " IsPlatformMonitor" : "",
             (flags & ImGuiViewportFlags_OwnedByApp)        ? " OwnedByApp"        : "");
+        if (g.IO.ConfigDrawDataDamageRects)
+        {
+            float damage_area = 0.0f;
+            for (const ImVec4& rect : viewport->DrawDataP.DamageRects)
+                damage_area += (rect.z - rect.x) * (rect.w - rect.y);
+            BulletText("DamageRects: %d (%.1f%% of display)", viewport->DrawDataP.DamageRects.Size, (viewport->Size.x * viewport->Size.y > 0.0f) ? damage_area * 100.0f / (viewport->Size.x * viewport->Size.y) : 0.0f);
+            if (IsItemHovered())
+                for (const ImVec4& rect : viewport->DrawDataP.DamageRects)
+                    GetForegroundDrawList(viewport)->AddRect(ImVec2(rect.x, rect.y), ImVec2(rect.z, rect.w), IM_COL32(255, 0, 0, 255));
+        }
         for (ImDrawList* draw_list : viewport->DrawDataP.CmdLists)
             DebugNodeDrawList(NULL, viewport, draw_list, "DrawList");
         TreePop();
@@ -44,7 +44,7 @@ Index of this file:
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
 // [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
-// [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
+// [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListRecording, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
 // [SECTION] Platform Dependent Interfaces (ImGuiPlatformImeData)
@@ -158,12 +158,18 @@ typedef unsigned long long  ImU64;  // 64-bit unsigned integer
 struct ImDrawChannel;               // Temporary storage to output draw commands out of order, used by ImDrawListSplitter and ImDrawList::ChannelsSplit()
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
+struct ImDrawIdxSegment;            // A range of a draw list index buffer stored in a separate buffer, linked by ImDrawListSplitter::Merge() instead of being copied
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
+struct ImDrawListRecording;         // Pre-tessellated copy of primitives captured from a draw list, which can be replayed at a different position with ImDrawList::AddRecording()
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
+struct ImDrawListFrameArena;        // Memory shared by the buffers of all draw lists of a frame (owned by parent ImGui context, see io.ConfigDrawListFrameArena)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawRectInstance;          // A single rectangle instance, expanded to a filled or stroked rounded rectangle by the renderer (32 bytes)
+struct ImDrawTransform;             // A 2D affine transform applied to positions submitted to a draw list (see ImDrawList::PushTransform())
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
+struct ImFontAtlasDynamicGlyphs;    // Opaque storage for glyphs rasterized on demand (see ImFontAtlasFlags_DynamicGlyphs)
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
@@ -248,6 +254,7 @@ typedef void* ImTextureID;          // Default: store a pointer or an integer fi
 // ImDrawIdx: vertex index. [Compile-time configurable type]
 // - To use 16-bit indices + allow large meshes: backend need to set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset' and handle ImDrawCmd::VtxOffset (recommended).
 // - To use 32-bit indices: override with '#define ImDrawIdx unsigned int' in your imconfig.h file.
+// - To use 32-bit indices only in draw lists which need them: use 32-bit indices + backend need to set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasPackedIdx' and handle ImDrawList::IdxSize.
 #ifndef ImDrawIdx
 typedef unsigned short ImDrawIdx;   // Default: 16-bit (for maximum compatibility with renderer backends)
 #endif
@@ -267,6 +274,7 @@ typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
+typedef void    (*ImFontAtlasRunWorkersFunc)(ImFontAtlas* atlas, void (*worker_func)(void* worker_data, int worker_n), void* worker_data, int workers_count); // Function signature for ImFontAtlas::BuildRunWorkersFunc
 
 // ImVec2: 2D vector used to store positions, sizes etc. [Compile-time configurable type]
 // This is a frequently used type in the API. Consider using IM_VEC2_CLASS_EXTRA to create implicit cast from/to our preferred type.
@@ -916,7 +924,11 @@ namespace ImGui
     IMGUI_API bool          IsRectVisible(const ImVec2& rect_min, const ImVec2& rect_max);      // test if rectangle (in screen space) is visible / not clipped. to perform coarse clipping on user's side.
     IMGUI_API double        GetTime();                                                          // get global imgui time. incremented by io.DeltaTime every frame.
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
+    IMGUI_API float         GetNextFrameDelay();                                                // after EndFrame()/Render(): delay in seconds before a new frame is needed if no input is received. 0.0f = immediately (pending inputs, animations, active interactions), FLT_MAX = idle until next input. e.g. pass to glfwWaitEventsTimeout().
+    IMGUI_API void          RequestNextFrame(float delay = 0.0f);                               // request a new frame within 'delay' seconds even if no input is received, e.g. for your own animations. Call every frame while needed. Lowers value returned by GetNextFrameDelay().
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances.
+    IMGUI_API ImDrawListSharedData* BeginDrawListThreads();                                     // same, for ImDrawList instances filled on other threads until EndDrawListThreads(). See ImDrawList::AddDrawList().
+    IMGUI_API void          EndDrawListThreads();                                               // call after other threads are done with draw lists.
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);                                    // get a string corresponding to the enum value (for display, saving, etc.).
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
     IMGUI_API ImGuiStorage* GetStateStorage();
@@ -1574,6 +1586,10 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasPackedIdx  = 1 << 4,   // Backend Renderer supports ImDrawList::IdxSize == 2 while ImDrawIdx is 32-bit. This enables packing indices of draw lists with <= 64K vertices to 16-bit, while larger meshes use 32-bit indices.
+    ImGuiBackendFlags_RendererHasRectInstances = 1 << 5, // Backend Renderer supports ImDrawCmd::RectCount. This enables output of AddRect()/AddRectFilled() as compact ImDrawRectInstance records expanded by the GPU, instead of tessellated triangles.
+    ImGuiBackendFlags_RendererHasIdxSegments = 1 << 6, // Backend Renderer supports ImDrawList::IdxSegments[]. This enables merging large ImDrawListSplitter channels (e.g. tables columns) without copying their indices.
+    ImGuiBackendFlags_RendererHasTexUpdates = 1 << 7,  // Backend Renderer supports ImFontAtlas::TexUpdates[]. This enables ImFontAtlasFlags_DynamicGlyphs, where glyphs are rasterized into the font texture on demand.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2137,6 +2153,7 @@ struct ImGuiStyle
     bool        AntiAliasedLines;           // Enable anti-aliased lines/borders. Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedLinesUseTex;     // Enable anti-aliased lines/borders using textures where possible. Require backend to render with bilinear filtering (NOT point/nearest filtering). Latched at the beginning of the frame (copied to ImDrawList).
     bool        AntiAliasedFill;            // Enable anti-aliased edges around filled shapes (rounded rectangles, circles, etc.). Disable if you are really tight on CPU/GPU. Latched at the beginning of the frame (copied to ImDrawList).
+    bool        RoundCornersUseTex;         // Enable anti-aliased circles and rounded rectangles using textures where possible (filled, or 1.0f thick borders). Require backend to render with bilinear filtering (NOT point/nearest filtering). Latched at the beginning of the frame (copied to ImDrawList).
     float       CurveTessellationTol;       // Tessellation tolerance when using PathBezierCurveTo() without a specific number of segments. Decrease for highly tessellated curves (higher quality, more polygons), increase to reduce quality.
     float       CircleTessellationMaxError; // Maximum error (in pixels) allowed when using AddCircle()/AddCircleFilled() or drawing rounded corner rectangles with no explicit segment count specified. Decrease for higher quality but more geometry.
     ImVec4      Colors[ImGuiCol_COUNT];
@@ -2204,6 +2221,11 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigDrawDataMergeLists;       // = false          // Merge consecutive draw lists of ImDrawData into shared buffers, and merge compatible draw commands across them. Reduces draw calls and buffer uploads, but ImDrawData::CmdLists[] will not contain your windows' ImDrawList anymore. Lists with user callbacks are never merged.
+    bool        ConfigDrawListFrameArena;       // = false          // Allocate buffers of the draw lists owned by Dear ImGui (windows, background/foreground) from a single arena reset every frame, instead of separate heap allocations. The arena is double-buffered so ImDrawData stays valid until the end of the next frame. Memory is only released on context destruction.
+    bool        ConfigDrawDataDamageRects;      // = false          // Compute ImDrawData::DamageRects[]: regions of the display whose output changed since the previous call to Render(), found by hashing the output of draw commands. Use to only redraw/present/stream changed pixels. Changes of texture contents are not detected.
+    bool        ConfigTextSizeCache;            // = false          // Keep results of CalcTextSize() across frames, keyed by font, size, wrap width and text. Most labels (buttons, headers, tabs, menus) are measured again every frame with the same inputs. Short texts without wrapping are not cached, as measuring them costs about as much as a lookup. The cache is flushed when fonts are rebuilt. See Metrics/Debugger->Memory allocations for hit rate.
+    int         ConfigTextSizeCacheMaxBytes;    // = 512*1024       // Memory budget of the above cache. When full, it is flushed and refilled.
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2310,6 +2332,8 @@ struct ImGuiIO
     float       Framerate;                          // Estimate of application framerate (rolling average over 60 frames, based on io.DeltaTime), in frame per second. Solely for convenience. Slow applications may not want to use a moving average or may want to reset underlying buffers occasionally.
     int         MetricsRenderVertices;              // Vertices output during last call to Render()
     int         MetricsRenderIndices;               // Indices output during last call to Render() = number of triangles * 3
+    int         MetricsRenderDrawCmds;              // Draw commands output during last call to Render() (~ number of draw calls)
+    int         MetricsRenderDrawCmdsBeforeMerge;   // Draw commands output during last call to Render(), before merging draw lists (see io.ConfigDrawDataMergeLists)
     int         MetricsRenderWindows;               // Number of visible windows
     int         MetricsActiveWindows;               // Number of active windows
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
@@ -2697,7 +2721,7 @@ struct ImColor
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
+// [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListRecording, ImDrawListFlags, ImDrawList, ImDrawData)
 // Hold a series of drawing commands. The user provides a renderer for ImDrawData which essentially contains an array of ImDrawList.
 //-----------------------------------------------------------------------------
 
@@ -2706,6 +2730,11 @@ struct ImColor
 #define IM_DRAWLIST_TEX_LINES_WIDTH_MAX     (63)
 #endif
 
+// The maximum radius to bake anti-aliased quarter circles for, used by circles and rounded rectangles. Build atlas with ImFontAtlasFlags_NoBakedRoundCorners to disable baking.
+#ifndef IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX
+#define IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX    (16)
+#endif
+
 // ImDrawCallback: Draw callbacks for advanced uses [configurable type: override in imconfig.h]
 // NB: You most likely do NOT need to use draw callbacks just to create your own widget or customized UI rendering,
 // you can poke into the draw list for that! Draw callback may be useful for example to:
@@ -2727,6 +2756,8 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // - VtxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   this fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
 //   Backends made for <1.71. will typically ignore the VtxOffset fields.
+// - RectOffset/RectCount: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasRectInstances' is enabled,
+//   a command may draw 'RectCount' rectangle instances from ImDrawList::RectBuffer[] instead of triangles. Such commands always have ElemCount == 0.
 // - The ClipRect/TextureId/VtxOffset fields must be contiguous as we memcmp() them together (this is asserted for).
 struct ImDrawCmd
 {
@@ -2737,6 +2768,8 @@ struct ImDrawCmd
     unsigned int    ElemCount;          // 4    // Number of indices (multiple of 3) to be rendered as triangles. Vertices are stored in the callee ImDrawList's vtx_buffer[] array, indices in idx_buffer[].
     ImDrawCallback  UserCallback;       // 4-8  // If != NULL, call the function instead of rendering the vertices. clip_rect and texture_id will be set normally.
     void*           UserCallbackData;   // 4-8  // The draw callback code can access this.
+    unsigned int    RectOffset;         // 4    // Start offset in rectangle instance buffer.
+    unsigned int    RectCount;          // 4    // Number of rectangle instances to be rendered (only with ImGuiBackendFlags_RendererHasRectInstances). Instances are stored in the callee ImDrawList's RectBuffer[] array.
 
     ImDrawCmd() { memset(this, 0, sizeof(*this)); } // Also ensure our padding fields are zeroed
 
@@ -2745,7 +2778,45 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_USE_COMPACT_DRAWVERT)
+// Compact vertex layout (12 bytes instead of 20 bytes), enabled by defining IMGUI_USE_COMPACT_DRAWVERT in imconfig.h
+// - pos: 16-bit signed fixed-point, in 1/IM_DRAWVERT_POS_SCALE pixel units. Default covers -4096..+4096 with 1/8 pixel precision.
+//   Values outside the range assert (and are clamped if asserts are disabled): for larger displays, reduce IM_DRAWVERT_POS_FRAC_BITS.
+// - uv: 16-bit unsigned normalized. Values outside 0..1 are clamped, so texture repeat is not supported.
+// Members convert from/to float and ImVec2, so code writing vertices doesn't need to know about this layout.
+// Renderers need to declare positions as 16-bit signed integers, and multiply them by (1.0f / IM_DRAWVERT_POS_SCALE) e.g. in their projection matrix.
+#ifndef IM_DRAWVERT_POS_FRAC_BITS
+#define IM_DRAWVERT_POS_FRAC_BITS   3
+#endif
+#define IM_DRAWVERT_POS_SCALE       ((float)(1 << IM_DRAWVERT_POS_FRAC_BITS))
+struct ImDrawVertFixed16
+{
+    ImS16   Value;
+    inline ImDrawVertFixed16& operator=(float f)    { f *= IM_DRAWVERT_POS_SCALE; IM_ASSERT(f > -32768.5f && f < 32767.5f && "Vertex position out of IMGUI_USE_COMPACT_DRAWVERT range. Reduce IM_DRAWVERT_POS_FRAC_BITS?"); Value = (ImS16)((f >= 32767.0f) ? 32767 : (f <= -32768.0f) ? -32768 : (int)(f + ((f >= 0.0f) ? 0.5f : -0.5f))); return *this; }
+    inline ImDrawVertFixed16& operator+=(float f)   { return *this = (float)*this + f; }
+    inline ImDrawVertFixed16& operator-=(float f)   { return *this = (float)*this - f; }
+    inline operator float() const                   { return (float)Value * (1.0f / IM_DRAWVERT_POS_SCALE); }
+};
+struct ImDrawVertUnorm16
+{
+    ImU16   Value;
+    inline ImDrawVertUnorm16& operator=(float f)    { Value = (ImU16)((f >= 1.0f) ? 65535 : (f <= 0.0f) ? 0 : (int)(f * 65535.0f + 0.5f)); return *this; }
+    inline operator float() const                   { return (float)Value * (1.0f / 65535.0f); }
+};
+template<typename T>
+struct ImDrawVertVec2
+{
+    T       x, y;
+    inline ImDrawVertVec2& operator=(const ImVec2& v) { x = v.x; y = v.y; return *this; }
+    inline operator ImVec2() const                  { return ImVec2(x, y); }
+};
+struct ImDrawVert
+{
+    ImDrawVertVec2<ImDrawVertFixed16>   pos;
+    ImDrawVertVec2<ImDrawVertUnorm16>   uv;
+    ImU32                               col;
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
@@ -2760,6 +2831,37 @@ struct ImDrawVert
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
+// Rectangle instance (see ImGuiBackendFlags_RendererHasRectInstances)
+// Renderers expand each instance to a quad covering the rectangle (+ half thickness + 1.0f for anti-aliasing),
+// and compute coverage from the distance to the rounded rectangle edges (filled) or to its outline (stroked).
+// Flags: bits 0-3 are rounded corners (top-left, top-right, bottom-left, bottom-right, == ImDrawFlags_RoundCornersXXX >> 4), bit 4 is set when edges are anti-aliased.
+struct ImDrawRectInstance
+{
+    ImVec2  Min;        // Upper-left corner. For stroked rectangles, position of the center of the border.
+    ImVec2  Max;        // Lower-right corner
+    ImU32   Col;
+    float   Rounding;   // Radius of rounded corners, already clamped to fit the rectangle
+    float   Thickness;  // Thickness of the border, 0.0f for filled rectangles
+    ImU32   Flags;
+};
+
+// 2D affine transform (see ImDrawList::PushTransform())
+// Transformed position = Offset + pos.x * AxisX + pos.y * AxisY
+struct ImDrawTransform
+{
+    ImVec2  AxisX;      // Image of (1,0)
+    ImVec2  AxisY;      // Image of (0,1)
+    ImVec2  Offset;     // Image of (0,0)
+
+    ImDrawTransform()                                                   { AxisX = ImVec2(1.0f, 0.0f); AxisY = ImVec2(0.0f, 1.0f); Offset = ImVec2(0.0f, 0.0f); }
+    ImDrawTransform(const ImVec2& axis_x, const ImVec2& axis_y, const ImVec2& offset) { AxisX = axis_x; AxisY = axis_y; Offset = offset; }
+    IMGUI_API ImDrawTransform(const ImVec2& offset, float scale, float rot = 0.0f); // Scale, then rotate (radians, clockwise on screen), then translate.
+    ImVec2          Apply(const ImVec2& p) const                        { return ImVec2(Offset.x + p.x * AxisX.x + p.y * AxisY.x, Offset.y + p.x * AxisX.y + p.y * AxisY.y); }
+    IMGUI_API ImDrawTransform Combine(const ImDrawTransform& inner) const; // Transform applying 'inner' first, then this one.
+    IMGUI_API ImDrawTransform GetInverse() const;
+    IMGUI_API float GetScale() const;                                   // Largest length a unit vector may get, used to scale thickness and tessellation tolerances.
+};
+
 // [Internal] For use by ImDrawList
 struct ImDrawCmdHeader
 {
@@ -2793,6 +2895,40 @@ struct ImDrawListSplitter
     IMGUI_API void              SetCurrentChannel(ImDrawList* draw_list, int channel_idx);
 };
 
+// Index buffer range stored out of ImDrawList::IdxBuffer[] (see ImGuiBackendFlags_RendererHasIdxSegments)
+// - When ImDrawListFlags_AllowIdxSegments is set, ImDrawListSplitter::Merge() moves large channels index buffers into the parent draw list instead of copying them.
+// - The matching range IdxBuffer[IdxOffset] to IdxBuffer[IdxOffset + IdxBuffer.Size - 1] in the parent draw list has undefined content:
+//   renderers should upload IdxBuffer[] content between segments, then each segment at its own offset.
+// - Segments are sorted by IdxOffset and don't overlap. Their indices are packed along with the parent draw list (see ImDrawList::IdxSize).
+struct ImDrawIdxSegment
+{
+    unsigned int                IdxOffset;  // Start offset in parent ImDrawList::IdxBuffer[]
+    ImVector<ImDrawIdx>         IdxBuffer;  // Indices
+};
+
+// Recorded primitives, captured with ImDrawList::RecordBegin()/RecordEnd() and replayed with ImDrawList::AddRecording().
+// This is used to avoid tessellating identical shapes and text again every frame when they are only moving around (e.g. node editor bodies).
+// - Vertices are stored as they were emitted. Indices are relative to the first recorded vertex (ImDrawCmd::VtxOffset is unused).
+// - Textures identifiers and font atlas UV are stored too: a recording needs to be recreated if the font atlas is rebuilt.
+//   With ImFontAtlasFlags_DynamicGlyphs, glyphs of code points >= 0x100 may be evicted from the texture once unused: don't record such text.
+struct ImDrawListRecording
+{
+    ImVector<ImDrawCmd>         CmdBuffer;  // Recorded commands. IdxOffset is relative to IdxBuffer[] below.
+    ImVector<ImDrawIdx>         IdxBuffer;  // Recorded indices, relative to VtxBuffer[0].
+    ImVector<ImDrawVert>        VtxBuffer;  // Recorded vertices.
+    ImVector<ImDrawRectInstance> RectBuffer; // Recorded rectangle instances. RectOffset is relative to RectBuffer[0].
+    ImVec4                      ClipRect;   // Clipping rectangle at the time of RecordBegin(). Commands using it are replayed with the clipping rectangle current at the time of AddRecording().
+    int                         _CmdStart;  // [Internal] CmdBuffer.Size-1 at the time of RecordBegin(), -1 when not recording
+    int                         _IdxStart;  // [Internal] IdxBuffer.Size at the time of RecordBegin()
+    int                         _VtxStart;  // [Internal] VtxBuffer.Size at the time of RecordBegin()
+    int                         _RectStart; // [Internal] RectBuffer.Size at the time of RecordBegin()
+
+    inline ImDrawListRecording()    { memset(this, 0, sizeof(*this)); _CmdStart = _IdxStart = _VtxStart = _RectStart = -1; }
+    inline ~ImDrawListRecording()   { ClearFreeMemory(); }
+    inline void                 Clear()             { CmdBuffer.resize(0); IdxBuffer.resize(0); VtxBuffer.resize(0); RectBuffer.resize(0); } // Keep allocations so they are reused by next recording
+    inline void                 ClearFreeMemory()   { CmdBuffer.clear(); IdxBuffer.clear(); VtxBuffer.clear(); RectBuffer.clear(); }
+};
+
 // Flags for ImDrawList functions
 // (Legacy: bit 0 must always correspond to ImDrawFlags_Closed to be backward compatible with old API using a bool. Bits 1..3 must be unused)
 enum ImDrawFlags_
@@ -2822,6 +2958,11 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_AllowPackedIdx          = 1 << 4,  // Can pack 32-bit indices to 16-bit ones (IdxSize == 2) once the list is finished. Set when 'ImGuiBackendFlags_RendererHasPackedIdx' is enabled and ImDrawIdx is 32-bit.
+    ImDrawListFlags_AllowRectInstances      = 1 << 5,  // Can emit rectangle instances ('RectCount > 0') from AddRect()/AddRectFilled(). Set when 'ImGuiBackendFlags_RendererHasRectInstances' is enabled.
+    ImDrawListFlags_AllowIdxSegments        = 1 << 6,  // Can link indices of merged ImDrawListSplitter channels into IdxSegments[] instead of copying them. Set when 'ImGuiBackendFlags_RendererHasIdxSegments' is enabled.
+    ImDrawListFlags_CullPrimitives          = 1 << 7,  // Skip AddXXX() primitives whose bounding box is entirely outside the current clip rectangle, instead of tessellating them. Requires a renderer honoring ImDrawCmd::ClipRect. Set it yourself around drawing code submitting many off-screen shapes (e.g. a scrolled canvas).
+    ImDrawListFlags_RoundCornersUseTex      = 1 << 8,  // Enable anti-aliased circles and rounded rectangles using textures when possible: a few quads sampling quarter circles baked in the atlas, instead of tessellated polygons. Require backend to render with bilinear filtering (NOT point/nearest filtering).
 };
 
 // Draw command list
@@ -2839,7 +2980,10 @@ struct ImDrawList
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
+    ImVector<ImDrawRectInstance> RectBuffer;    // Rectangle instance buffer. Each command consume ImDrawCmd::RectCount of those (only with ImGuiBackendFlags_RendererHasRectInstances).
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
+    int                     IdxSize;            // Size of each index in IdxBuffer, in bytes. == sizeof(ImDrawIdx), unless indices were packed to 16-bit (== 2) after rendering (see ImGuiBackendFlags_RendererHasPackedIdx). IdxBuffer.Size and ImDrawCmd fields are always expressed in number of indices.
+    ImVector<ImDrawIdxSegment> IdxSegments;     // Ranges of IdxBuffer[] whose indices are stored separately (only with ImGuiBackendFlags_RendererHasIdxSegments). Unused entries past IdxSegments.Size keep their allocations.
 
     // [Internal, used while building lists]
     unsigned int            _VtxCurrentIdx;     // [Internal] generally == VtxBuffer.Size unless we are past 64K vertices, in which case this gets reset to 0.
@@ -2847,15 +2991,26 @@ struct ImDrawList
     ImDrawVert*             _VtxWritePtr;       // [Internal] point within VtxBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
     ImDrawIdx*              _IdxWritePtr;       // [Internal] point within IdxBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
     ImVector<ImVec2>        _Path;              // [Internal] current path building
+    ImVector<ImVec2>        _TempBuffer;        // [Internal] scratch buffer for AddPolyline() normals and polygon triangulation. Owned by each draw list so separate draw lists can be built concurrently.
     ImDrawCmdHeader         _CmdHeader;         // [Internal] template of active commands. Fields should match those of CmdBuffer.back().
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api (note: prefer using your own persistent instance of ImDrawListSplitter!)
+    int                     _SplitterChannelDepth; // [Internal] number of ImDrawListSplitter currently writing to a channel other than 0. IdxSegments[] can only refer to the channel 0 IdxBuffer[], so nested merges copy indices while > 0.
     ImVector<ImVec4>        _ClipRectStack;     // [Internal]
     ImVector<ImTextureID>   _TextureIdStack;    // [Internal]
+    ImVector<ImDrawTransform> _TransformStack;  // [Internal]
+    ImDrawTransform         _Transform;         // [Internal] current transform, only valid when _TransformStack.Size > 0
+    float                   _TransformScale;    // [Internal] == _Transform.GetScale(), 1.0f when _TransformStack.Size == 0
+    ImVector<ImVec2>        _TransformBuffer;   // [Internal] transformed points for AddPolyline(), AddConvexPolyFilled() and AddConcavePolyFilled()
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
     const char*             _OwnerName;         // Pointer to owner window's name for debugging
+    int                     _CulledPrimCount;   // [Internal] number of primitives skipped since last reset, see ImDrawListFlags_CullPrimitives
+    ImVector<ImVec4>        _RectMergeBounds;   // [Internal] bounding boxes of triangles of current command, when it follows a command of rectangle instances (see _TryAddRectInstance())
+    unsigned int            _RectMergeIdxOffset; // [Internal] IdxOffset of the command described by _RectMergeBounds
+    unsigned int            _RectMergeIdxEnd;   // [Internal] end of indices accounted for in _RectMergeBounds, (unsigned int)-1 when invalid
+    ImDrawListFrameArena*   _FrameArena;        // [Internal] arena to allocate buffers from, only set on draw lists reset every frame by their owner (see io.ConfigDrawListFrameArena)
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
-    ImDrawList(ImDrawListSharedData* shared_data) { memset(this, 0, sizeof(*this)); _Data = shared_data; }
+    ImDrawList(ImDrawListSharedData* shared_data) { memset(this, 0, sizeof(*this)); IdxSize = sizeof(ImDrawIdx); _Data = shared_data; _TransformScale = 1.0f; }
 
     ~ImDrawList() { _ClearFreeMemory(); }
     IMGUI_API void  PushClipRect(const ImVec2& clip_rect_min, const ImVec2& clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
@@ -2863,6 +3018,8 @@ struct ImDrawList
     IMGUI_API void  PopClipRect();
     IMGUI_API void  PushTextureID(ImTextureID texture_id);
     IMGUI_API void  PopTextureID();
+    IMGUI_API void  PushTransform(const ImDrawTransform& transform, bool combine_with_current_transform = true); // Transform positions passed to subsequent primitives (see below).
+    IMGUI_API void  PopTransform();
     inline ImVec2   GetClipRectMin() const { const ImVec4& cr = _ClipRectStack.back(); return ImVec2(cr.x, cr.y); }
     inline ImVec2   GetClipRectMax() const { const ImVec4& cr = _ClipRectStack.back(); return ImVec2(cr.z, cr.w); }
 
@@ -2873,6 +3030,9 @@ struct ImDrawList
     //   In older versions (until Dear ImGui 1.77) the AddCircle functions defaulted to num_segments == 12.
     //   In future versions we will use textures to provide cheaper and higher-quality circles.
     //   Use AddNgon() and AddNgonFilled() functions if you need to guarantee a specific number of sides.
+    // - With PushTransform(), positions (including those of paths and text) are transformed when vertices are emitted. Thickness and automatic
+    //   tessellation of circles and curves are scaled by the transform, anti-aliasing fringes stay 1 pixel wide. Clipping rectangles are not transformed.
+    //   AddRect()/AddRectFilled() don't output rectangle instances or baked round corners while a transform is pushed.
     IMGUI_API void  AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float thickness = 1.0f);
     IMGUI_API void  AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding = 0.0f, ImDrawFlags flags = 0, float thickness = 1.0f);   // a: upper-left, b: lower-right (== upper-left + size)
     IMGUI_API void  AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, float rounding = 0.0f, ImDrawFlags flags = 0);                     // a: upper-left, b: lower-right (== upper-left + size)
@@ -2896,6 +3056,7 @@ struct ImDrawList
     // - Only simple polygons are supported by filling functions (no self-intersections, no holes).
     // - Concave polygon fill is more expensive than convex one: it has O(N^2) complexity. Provided as a convenience fo user but not used by main library.
     IMGUI_API void  AddPolyline(const ImVec2* points, int num_points, ImU32 col, ImDrawFlags flags, float thickness);
+    IMGUI_API void  AddPolylineDecimated(const ImVec2* points, int num_points, ImU32 col, float thickness = 1.0f); // Open polyline with points sorted by increasing x (e.g. a plot). Points sharing a pixel column are reduced to their first/min/max/last ones before tessellation.
     IMGUI_API void  AddConvexPolyFilled(const ImVec2* points, int num_points, ImU32 col);
     IMGUI_API void  AddConcavePolyFilled(const ImVec2* points, int num_points, ImU32 col);
 
@@ -2928,6 +3089,28 @@ struct ImDrawList
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
 
+    // Advanced: Recording
+    // - Use to capture primitives emitted between RecordBegin() and RecordEnd() into a ImDrawListRecording, then replay them any number of times with AddRecording().
+    //   Replaying copies the pre-tessellated vertices with a position offset and a color multiplier applied, instead of building paths and text again.
+    // - On replay, clipping rectangles pushed while recording are moved by the same offset and intersected with the current clipping rectangle.
+    // - With PushTransform(), replayed vertices are transformed after the offset is applied (they are not tessellated again).
+    // - Don't change channel (see ChannelsSetCurrent(), ImDrawListSplitter) between RecordBegin() and RecordEnd().
+    IMGUI_API void  RecordBegin(ImDrawListRecording* recording);
+    IMGUI_API void  RecordEnd(ImDrawListRecording* recording);
+    IMGUI_API void  AddRecording(const ImDrawListRecording* recording, const ImVec2& offset = ImVec2(0, 0), ImU32 col_mul = IM_COL32_WHITE);
+
+    // Advanced: Multi-threading
+    // - Separate ImDrawList instances may be filled concurrently by worker threads, as long as their shared data is not modified meanwhile:
+    //   on the main thread call 'shared_data = ImGui::BeginDrawListThreads()' and create draw lists with 'IM_NEW(ImDrawList)(shared_data)'.
+    //   On worker threads, call ResetForNewFrame() before adding primitives.
+    //   AddText() without a font uses the font current at the time of BeginDrawListThreads(). With ImFontAtlasFlags_DynamicGlyphs, glyphs not yet rasterized are skipped (they are rasterized by EndDrawListThreads(), for next frame).
+    // - Once workers are done, on the main thread: call ImGui::EndDrawListThreads(), then use AddDrawList() to append their output to
+    //   e.g. a window draw list, or use ImDrawData::AddDrawList() after Render() to draw them over everything else without any copy.
+    // - AddDrawList() copies vertices once and doesn't tessellate again. Large index buffers are moved when ImDrawListFlags_AllowIdxSegments is set.
+    //   'src' is reset and keeps its allocations for next frame.
+    IMGUI_API void  ResetForNewFrame();                     // Clear contents (keeping allocations), then push a full-screen clip rectangle and the font atlas texture of shared data. For draw lists you own.
+    IMGUI_API void  AddDrawList(ImDrawList* src);
+
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
     // - Use to minimize draw calls (e.g. if going back-and-forth between multiple clipping rectangles, prefer to append into separate channels then merge at the end)
@@ -2946,7 +3129,7 @@ struct ImDrawList
     IMGUI_API void  PrimRect(const ImVec2& a, const ImVec2& b, ImU32 col);      // Axis aligned rectangle (composed of two triangles)
     IMGUI_API void  PrimRectUV(const ImVec2& a, const ImVec2& b, const ImVec2& uv_a, const ImVec2& uv_b, ImU32 col);
     IMGUI_API void  PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& d, const ImVec2& uv_a, const ImVec2& uv_b, const ImVec2& uv_c, const ImVec2& uv_d, ImU32 col);
-    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { _VtxWritePtr->pos = pos; _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
+    inline    void  PrimWriteVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)    { _VtxWritePtr->pos = (_TransformStack.Size > 0) ? _Transform.Apply(pos) : pos; _VtxWritePtr->uv = uv; _VtxWritePtr->col = col; _VtxWritePtr++; _VtxCurrentIdx++; }
     inline    void  PrimWriteIdx(ImDrawIdx idx)                                     { *_IdxWritePtr = idx; _IdxWritePtr++; }
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)         { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); } // Write vertex with unique index
 
@@ -2960,7 +3143,20 @@ struct ImDrawList
     // [Internal helpers]
     IMGUI_API void  _ResetForNewFrame();
     IMGUI_API void  _ClearFreeMemory();
+    IMGUI_API void  _DetachFromFrameArena();
     IMGUI_API void  _PopUnusedDrawCmd();
+    IMGUI_API void  _PackIdxBuffer();
+    IMGUI_API bool  _TryAddRectInstance(const ImVec2& a, const ImVec2& b, ImU32 col, float rounding, ImDrawFlags flags, float thickness);
+    IMGUI_API bool  _RectInstanceCanSkipCurrentCmd(const ImVec2& bb_min, const ImVec2& bb_max);
+    IMGUI_API bool  _TryAddRoundCornersTex(const ImVec2& c_min, const ImVec2& c_max, float radius, ImU32 col, float thickness);
+    inline unsigned int _GetIdx(int idx_n) const { const void* p = (IdxSegments.Size > 0) ? _GetIdxPtrFromSegments(idx_n, &idx_n) : IdxBuffer.Data; return (IdxSize == 2) ? (unsigned int)((const ImU16*)p)[idx_n] : (unsigned int)((const ImDrawIdx*)p)[idx_n]; } // Read index, honoring IdxSize and IdxSegments[]
+    IMGUI_API const void* _GetIdxPtrFromSegments(int idx_n, int* out_idx_n) const;
+    IMGUI_API ImDrawIdxSegment* _AddIdxSegment();
+    inline bool     _CullBoundingBox(const ImVec2& bb_min, const ImVec2& bb_max, float pad) { if (_TransformStack.Size > 0) return _CullTransformedBoundingBox(bb_min, bb_max, pad); const ImVec4& cr = _CmdHeader.ClipRect; if (bb_min.x - pad <= cr.z && bb_min.y - pad <= cr.w && bb_max.x + pad >= cr.x && bb_max.y + pad >= cr.y) return false; _CulledPrimCount++; return true; } // Return true (and count) if a primitive is entirely outside the current clip rectangle
+    IMGUI_API bool  _CullPoints(const ImVec2* points, int points_count, float pad);
+    IMGUI_API bool  _CullTransformedBoundingBox(const ImVec2& bb_min, const ImVec2& bb_max, float pad);
+    IMGUI_API const ImVec2* _TransformPoints(const ImVec2* points, int points_count);
+    IMGUI_API void  _FlattenIdxSegments();
     IMGUI_API void  _TryMergeDrawCmds();
     IMGUI_API void  _OnChangedClipRect();
     IMGUI_API void  _OnChangedTextureID();
@@ -2984,13 +3180,14 @@ struct ImDrawData
     ImVec2              DisplaySize;        // Size of the viewport to render (== GetMainViewport()->Size for the main viewport, == io.DisplaySize in most single-viewport applications)
     ImVec2              FramebufferScale;   // Amount of pixels for each unit of DisplaySize. Based on io.DisplayFramebufferScale. Generally (1,1) on normal display, (2,2) on OSX with Retina display.
     ImGuiViewport*      OwnerViewport;      // Viewport carrying the ImDrawData instance, might be of use to the renderer (generally not).
+    ImVector<ImVec4>    DamageRects;        // Only with io.ConfigDrawDataDamageRects: regions (x1, y1, x2, y2) whose output may differ from the previous call to Render(), in the same coordinates as ImDrawCmd::ClipRect. Pixels outside of them are unchanged. Empty when nothing changed, covers the whole display on the first frame or after a change of display position/size/scale.
 
     // Functions
     ImDrawData()    { Clear(); }
     IMGUI_API void  Clear();
     IMGUI_API void  AddDrawList(ImDrawList* draw_list);     // Helper to add an external draw list into an existing ImDrawData.
     IMGUI_API void  DeIndexAllBuffers();                    // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
-    IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    IMGUI_API void  ScaleClipRects(const ImVec2& fb_scale); // Helper to scale the ClipRect field of each ImDrawCmd (and DamageRects[]). Use if your final output buffer is at a different scale than Dear ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 };
 
 //-----------------------------------------------------------------------------
@@ -3031,7 +3228,8 @@ struct ImFontGlyph
 {
     unsigned int    Colored : 1;        // Flag to indicate glyph is colored and should generally ignore tinting (make it usable with no shift on little-endian as this is used in loops)
     unsigned int    Visible : 1;        // Flag to indicate glyph has no visible pixels (e.g. space). Allow early out when rendering.
-    unsigned int    Codepoint : 30;     // 0x0000..0x10FFFF
+    unsigned int    Dynamic : 1;        // Flag to indicate glyph is rasterized on demand (see ImFontAtlasFlags_DynamicGlyphs): UV are only valid while it is resident in the texture.
+    unsigned int    Codepoint : 29;     // 0x0000..0x10FFFF
     float           AdvanceX;           // Distance to next character (= data from font + ImFontConfig::GlyphExtraSpacing.x baked in)
     float           X0, Y0, X1, Y1;     // Glyph corners
     float           U0, V0, U1, V1;     // Texture coordinates
@@ -3066,13 +3264,22 @@ struct ImFontAtlasCustomRect
     bool IsPacked() const           { return X != 0xFFFF; }
 };
 
+// Rectangle of the font texture modified after Build(), to be uploaded by the renderer backend (see ImFontAtlas::TexUpdates).
+struct ImFontAtlasTexUpdate
+{
+    unsigned short  X, Y;
+    unsigned short  Width, Height;
+};
+
 // Flags for ImFontAtlas build
 enum ImFontAtlasFlags_
 {
-    ImFontAtlasFlags_None               = 0,
-    ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
-    ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
-    ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_None                = 0,
+    ImFontAtlasFlags_NoPowerOfTwoHeight  = 1 << 0,   // Don't round the height to next power of two
+    ImFontAtlasFlags_NoMouseCursors      = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
+    ImFontAtlasFlags_NoBakedLines        = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedRoundCorners = 1 << 3,   // Don't build quarter circle textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The RoundCornersUseTex feature uses them, otherwise circles and rounded rectangles will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_DynamicGlyphs       = 1 << 4,   // Only rasterize glyphs of code points >= 0x100 when first rendered, into free texture space, evicting least recently used ones when full (stb_truetype builder only). Useful with large ranges e.g. GetGlyphRangesChineseFull(). Requires ImGuiBackendFlags_RendererHasTexUpdates, and keeping texture data (don't call ClearTexData()).
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -3118,6 +3325,15 @@ struct ImFontAtlas
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't build texture but effectively we should check TexID != 0 except that would be backend dependent...
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // Cache output of Build() (texture pixels, glyphs, custom rectangle positions), to skip parsing and rasterizing fonts in next runs.
+    // - Cache data is keyed by a hash of all inputs (font data, ImFontConfig settings and glyph ranges, atlas flags and settings, custom rectangles):
+    //   add fonts and custom rectangles first, then load. Cache data is only valid for the same build of the library on the same machine.
+    // - Pixels of your custom rectangles are cached as they were when saving: render into them after loading as you would after Build().
+    // - Not supported with ImFontAtlasFlags_DynamicGlyphs.
+    IMGUI_API bool              BuildWithCacheFile(const char* filename);               // Load from cache file if it matches current inputs, otherwise Build() and (re)write cache file. Return false if Build() failed.
+    IMGUI_API bool              LoadCacheData(const void* data, size_t data_size);      // Load from cache data (e.g. a memory-mapped file). Return false if it doesn't match current inputs, or is truncated/corrupted (then call Build()).
+    IMGUI_API bool              SaveCacheData(ImVector<char>* out_data);                // Write cache data of built atlas. Return false if atlas is not built or texture data was cleared.
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
@@ -3165,10 +3381,13 @@ struct ImFontAtlas
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0 (will also need to set AntiAliasedLinesUseTex = false).
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
     void*                       UserData;           // Store your own atlas related user-data (if e.g. you have multiple font atlas).
+    int                         BuildWorkersCount;  // Number of workers rasterizing glyphs during Build() (stb_truetype builder only). Defaults to 1. Output is identical whatever the count.
+    ImFontAtlasRunWorkersFunc   BuildRunWorkersFunc;// Called by Build() when BuildWorkersCount > 1: must call worker_func(worker_data, worker_n) for each worker_n in [0, workers_count), concurrently (e.g. one call per thread), and return once all calls returned. Allocator functions (see SetAllocatorFunctions()) must be thread-safe.
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
     bool                        TexReady;           // Set when texture was built matching current font input
+    int                         FontsGeneration;    // Incremented when metrics of fonts may have changed (build, ImFont::AddRemapChar(), ClearFonts()). Used to invalidate caches of text sizes.
     bool                        TexPixelsUseColors; // Tell whether our texture data is known to use colors (rather than just alpha channel), in order to help backend select a format.
     unsigned char*              TexPixelsAlpha8;    // 1 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight
     unsigned int*               TexPixelsRGBA32;    // 4 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight * 4
@@ -3180,6 +3399,10 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    ImVec4                      TexUvRoundCornersFilled[IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX + 1];      // UVs for baked anti-aliased quarter circles, by radius: xy = center, zw = outer corner
+    ImVec4                      TexUvRoundCornersStroked[IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX * 2 + 1]; // UVs for baked anti-aliased 1 pixel thick quarter rings, by radius * 2: xy = center, zw = outer corner
+    ImVector<ImFontAtlasTexUpdate> TexUpdates;      // Rectangles of texture data modified since last upload (with ImFontAtlasFlags_DynamicGlyphs). Renderer backend copies them from GetTexDataAsXXXX() pixels to its texture then clears this.
+    ImFontAtlasDynamicGlyphs*   DynamicGlyphs;      // State of glyphs rasterized on demand (with ImFontAtlasFlags_DynamicGlyphs)
 
     // [Internal] Font builder
     const ImFontBuilderIO*      FontBuilderIO;      // Opaque interface to a font builder (default to stb_truetype, can be changed to use FreeType by defining IMGUI_ENABLE_FREETYPE).
@@ -3188,6 +3411,7 @@ struct ImFontAtlas
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    int                         PackIdRoundCorners; // Custom texture rectangle ID for first baked anti-aliased quarter circle (filled then stroked ones follow, by increasing radius)
 
     // [Obsolete]
     //typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
@@ -3218,9 +3442,11 @@ struct ImFont
     float                       EllipsisWidth;      // 4     // out               // Width
     float                       EllipsisCharStep;   // 4     // out               // Step between characters when EllipsisCount > 0
     bool                        DirtyLookupTables;  // 1     // out //
+    bool                        AdvanceXAsciiIsInteger;// 1  // out //            // IndexAdvanceX[] of printable ASCII characters are all small non-negative integers, allowing CalcTextSizeA() to sum them in blocks
     float                       Scale;              // 4     // in  // = 1.f      // Base font scale, multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize] (unscaled)
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
+    ImVector<int>               DynamicGlyphsIndex; // 12-16 // out //            // Index of each glyph in ContainerAtlas->DynamicGlyphs->Glyphs[], -1 if not dynamic (with ImFontAtlasFlags_DynamicGlyphs)
     ImU8                        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8]; // 2 bytes if ImWchar=ImWchar16, 34 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
 
     // Methods
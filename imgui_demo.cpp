@@ -501,6 +501,14 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::Checkbox("io.ConfigWindowsMoveFromTitleBarOnly", &io.ConfigWindowsMoveFromTitleBarOnly);
             ImGui::Checkbox("io.ConfigMacOSXBehaviors", &io.ConfigMacOSXBehaviors);
             ImGui::SameLine(); HelpMarker("Swap Cmd<>Ctrl keys, enable various MacOS style behaviors.");
+            ImGui::Checkbox("io.ConfigDrawDataMergeLists", &io.ConfigDrawDataMergeLists);
+            ImGui::SameLine(); HelpMarker("Merge consecutive draw lists into shared buffers to reduce draw calls.\nSee Metrics/Debugger window for draw commands count.");
+            ImGui::Checkbox("io.ConfigDrawListFrameArena", &io.ConfigDrawListFrameArena);
+            ImGui::SameLine(); HelpMarker("Allocate draw lists buffers from a single arena reset every frame.\nSee Metrics/Debugger->Memory allocations for arena usage.");
+            ImGui::Checkbox("io.ConfigDrawDataDamageRects", &io.ConfigDrawDataDamageRects);
+            ImGui::SameLine(); HelpMarker("Compute regions of the display which changed since last frame, in ImDrawData::DamageRects[].\nSee Metrics/Debugger->Viewports for a visualization.");
+            ImGui::Checkbox("io.ConfigTextSizeCache", &io.ConfigTextSizeCache);
+            ImGui::SameLine(); HelpMarker("Keep results of CalcTextSize() across frames.\nSee Metrics/Debugger->Memory allocations for hit rate.");
             ImGui::Text("Also see Style->Rendering for rendering options.");
 
             ImGui::SeparatorText("Debug");
@@ -534,6 +542,9 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: HasMouseCursors",      &io.BackendFlags, ImGuiBackendFlags_HasMouseCursors);
             ImGui::CheckboxFlags("io.BackendFlags: HasSetMousePos",       &io.BackendFlags, ImGuiBackendFlags_HasSetMousePos);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset", &io.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasPackedIdx", &io.BackendFlags, ImGuiBackendFlags_RendererHasPackedIdx);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasRectInstances", &io.BackendFlags, ImGuiBackendFlags_RendererHasRectInstances);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasIdxSegments", &io.BackendFlags, ImGuiBackendFlags_RendererHasIdxSegments);
             ImGui::EndDisabled();
             ImGui::TreePop();
             ImGui::Spacing();
@@ -1881,6 +1892,8 @@ static void ShowDemoWindowWidgets()
             phase += 0.10f * values_offset;
             refresh_time += 1.0f / 60.0f;
         }
+        if (animate)
+            ImGui::RequestNextFrame(); // Keep animating if the application waits for inputs between frames (see GetNextFrameDelay())
 
         // Plots can display overlay texts
         // (in this example, we will display an average value)
@@ -1924,6 +1937,7 @@ static void ShowDemoWindowWidgets()
         progress += progress_dir * 0.4f * ImGui::GetIO().DeltaTime;
         if (progress >= +1.1f) { progress = +1.1f; progress_dir *= -1.0f; }
         if (progress <= -0.1f) { progress = -0.1f; progress_dir *= -1.0f; }
+        ImGui::RequestNextFrame();
 
         // Typically we would use ImVec2(-1.0f,0.0f) or ImVec2(-FLT_MIN,0.0f) to use all available width,
         // or ImVec2(width,0.0f) for a specified width. ImVec2(0.0f,0.0f) uses ItemWidth.
@@ -4995,6 +5009,31 @@ static void ShowDemoWindowTables()
             ImGui::TableNextColumn(); ImGui::Text("A1 Row 1");
             ImGui::EndTable();
         }
+
+        // Large columns of a nested table are merged into a column of the parent table, which is itself merged later.
+        // With ImGuiBackendFlags_RendererHasIdxSegments, this verifies that index buffers of nested channels are merged correctly.
+        static bool show_large_nested = false;
+        ImGui::Checkbox("Show large nested table", &show_large_nested);
+        if (show_large_nested && ImGui::BeginTable("table_nested3", 2, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable))
+        {
+            ImGui::TableNextColumn();
+            ImGui::Text("C0 Row 0");
+            ImGui::TableNextColumn();
+            if (ImGui::BeginTable("table_nested4", 2, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable))
+            {
+                for (int row = 0; row < 20; row++)
+                {
+                    ImGui::TableNextColumn();
+                    ImGui::Text("D0 Row %d: some text to fill index buffers", row);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("D1 Row %d", row);
+                }
+                ImGui::EndTable();
+            }
+            ImGui::TableNextColumn(); ImGui::Text("C0 Row 1");
+            ImGui::TableNextColumn(); ImGui::Text("C1 Row 1");
+            ImGui::EndTable();
+        }
         ImGui::TreePop();
     }
 
@@ -6634,11 +6673,18 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
         if (io.ConfigMemoryCompactTimer >= 0.0f)                        ImGui::Text("io.ConfigMemoryCompactTimer = %.1f", io.ConfigMemoryCompactTimer);
+        if (io.ConfigDrawDataMergeLists)                                ImGui::Text("io.ConfigDrawDataMergeLists");
+        if (io.ConfigDrawListFrameArena)                                ImGui::Text("io.ConfigDrawListFrameArena");
+        if (io.ConfigDrawDataDamageRects)                               ImGui::Text("io.ConfigDrawDataDamageRects");
+        if (io.ConfigTextSizeCache)                                     ImGui::Text("io.ConfigTextSizeCache, io.ConfigTextSizeCacheMaxBytes = %d", io.ConfigTextSizeCacheMaxBytes);
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
         if (io.BackendFlags & ImGuiBackendFlags_HasSetMousePos)         ImGui::Text(" HasSetMousePos");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasPackedIdx)   ImGui::Text(" RendererHasPackedIdx");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasRectInstances) ImGui::Text(" RendererHasRectInstances");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasIdxSegments) ImGui::Text(" RendererHasIdxSegments");
         ImGui::Separator();
         ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexWidth, io.Fonts->TexHeight);
         ImGui::Text("io.DisplaySize: %.2f,%.2f", io.DisplaySize.x, io.DisplaySize.y);
@@ -6939,6 +6985,10 @@ void ImGui::ShowStyleEditor(ImGuiStyle* ref)
             HelpMarker("Faster lines using texture data. Require backend to render with bilinear filtering (not point/nearest filtering).");
 
             ImGui::Checkbox("Anti-aliased fill", &style.AntiAliasedFill);
+
+            ImGui::Checkbox("Round corners use texture", &style.RoundCornersUseTex);
+            ImGui::SameLine();
+            HelpMarker("Faster circles and rounded rectangles using texture data. Require backend to render with bilinear filtering (not point/nearest filtering).");
             ImGui::PushItemWidth(ImGui::GetFontSize() * 8);
             ImGui::DragFloat("Curve Tessellation Tolerance", &style.CurveTessellationTol, 0.02f, 0.10f, 10.0f, "%.2f");
             if (style.CurveTessellationTol < 0.10f) style.CurveTessellationTol = 0.10f;
@@ -8399,13 +8449,17 @@ static void ShowExampleAppCustomRendering(bool* p_open)
         {
             static ImVector<ImVec2> points;
             static ImVec2 scrolling(0.0f, 0.0f);
+            static float zoom = 1.0f;
             static bool opt_enable_grid = true;
             static bool opt_enable_context_menu = true;
+            static bool opt_cull_primitives = true;
             static bool adding_line = false;
 
             ImGui::Checkbox("Enable grid", &opt_enable_grid);
             ImGui::Checkbox("Enable context menu", &opt_enable_context_menu);
-            ImGui::Text("Mouse Left: drag to add lines,\nMouse Right: drag to scroll, click for context menu.");
+            ImGui::Checkbox("Cull lines outside canvas", &opt_cull_primitives);
+            ImGui::SameLine(); HelpMarker("Set ImDrawListFlags_CullPrimitives while drawing lines, so lines scrolled out of the canvas clip rectangle are not tessellated.\nSee culled primitives count in Metrics/Debugger->DrawLists.");
+            ImGui::Text("Mouse Left: drag to add lines,\nMouse Right: drag to scroll, click for context menu.\nMouse Wheel: zoom (%.2fx).", zoom);
 
             // Typically you would use a BeginChild()/EndChild() pair to benefit from a clipping region + own scrolling.
             // Here we demonstrate that this can be replaced by simple offsetting + custom drawing + PushClipRect/PopClipRect() calls.
@@ -8435,8 +8489,18 @@ static void ShowExampleAppCustomRendering(bool* p_open)
             ImGui::InvisibleButton("canvas", canvas_sz, ImGuiButtonFlags_MouseButtonLeft | ImGuiButtonFlags_MouseButtonRight);
             const bool is_hovered = ImGui::IsItemHovered(); // Hovered
             const bool is_active = ImGui::IsItemActive();   // Held
+
+            // Zoom around mouse position
+            if (is_hovered && io.MouseWheel != 0.0f)
+            {
+                float new_zoom = zoom * powf(1.2f, io.MouseWheel);
+                new_zoom = (new_zoom < 0.1f) ? 0.1f : (new_zoom > 10.0f) ? 10.0f : new_zoom;
+                scrolling.x = io.MousePos.x - canvas_p0.x - (io.MousePos.x - canvas_p0.x - scrolling.x) * new_zoom / zoom;
+                scrolling.y = io.MousePos.y - canvas_p0.y - (io.MousePos.y - canvas_p0.y - scrolling.y) * new_zoom / zoom;
+                zoom = new_zoom;
+            }
             const ImVec2 origin(canvas_p0.x + scrolling.x, canvas_p0.y + scrolling.y); // Lock scrolled origin
-            const ImVec2 mouse_pos_in_canvas(io.MousePos.x - origin.x, io.MousePos.y - origin.y);
+            const ImVec2 mouse_pos_in_canvas((io.MousePos.x - origin.x) / zoom, (io.MousePos.y - origin.y) / zoom);
 
             // Add first and second point
             if (is_hovered && !adding_line && ImGui::IsMouseClicked(ImGuiMouseButton_Left))
@@ -8479,14 +8543,22 @@ static void ShowExampleAppCustomRendering(bool* p_open)
             draw_list->PushClipRect(canvas_p0, canvas_p1, true);
             if (opt_enable_grid)
             {
-                const float GRID_STEP = 64.0f;
+                const float GRID_STEP = 64.0f * zoom;
                 for (float x = fmodf(scrolling.x, GRID_STEP); x < canvas_sz.x; x += GRID_STEP)
                     draw_list->AddLine(ImVec2(canvas_p0.x + x, canvas_p0.y), ImVec2(canvas_p0.x + x, canvas_p1.y), IM_COL32(200, 200, 200, 40));
                 for (float y = fmodf(scrolling.y, GRID_STEP); y < canvas_sz.y; y += GRID_STEP)
                     draw_list->AddLine(ImVec2(canvas_p0.x, canvas_p0.y + y), ImVec2(canvas_p1.x, canvas_p0.y + y), IM_COL32(200, 200, 200, 40));
             }
+            const ImDrawListFlags backup_flags = draw_list->Flags;
+            if (opt_cull_primitives)
+                draw_list->Flags |= ImDrawListFlags_CullPrimitives;
+
+            // Lines are stored in canvas coordinates: let the draw list transform them to screen coordinates (thickness is scaled too)
+            draw_list->PushTransform(ImDrawTransform(origin, zoom));
             for (int n = 0; n < points.Size; n += 2)
-                draw_list->AddLine(ImVec2(origin.x + points[n].x, origin.y + points[n].y), ImVec2(origin.x + points[n + 1].x, origin.y + points[n + 1].y), IM_COL32(255, 255, 0, 255), 2.0f);
+                draw_list->AddLine(points[n], points[n + 1], IM_COL32(255, 255, 0, 255), 2.0f);
+            draw_list->PopTransform();
+            draw_list->Flags = backup_flags;
             draw_list->PopClipRect();
 
             ImGui::EndTabItem();
@@ -10,10 +10,12 @@ Index of this file:
 // [SECTION] ImDrawList
 // [SECTION] ImTriangulator, ImDrawList concave polygon fill
 // [SECTION] ImDrawListSplitter
+// [SECTION] ImDrawList recording
 // [SECTION] ImDrawData
 // [SECTION] Helpers ShadeVertsXXX functions
 // [SECTION] ImFontConfig
 // [SECTION] ImFontAtlas
+// [SECTION] ImFontAtlas cache
 // [SECTION] ImFontAtlas glyph ranges helpers
 // [SECTION] ImFontGlyphRangesBuilder
 // [SECTION] ImFont
@@ -39,6 +41,9 @@ Index of this file:
 #endif
 
 #include <stdio.h>      // vsnprintf, sscanf, printf
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>     // _InterlockedExchange, _InterlockedExchangeAdd
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -128,10 +133,12 @@ namespace IMGUI_STB_NAMESPACE
 #endif
 
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
+// Glyph rasterization workers set stbtt_fontinfo::userdata to an ImFontBuildAllocator, bypassing ImGui::MemAlloc() which updates statistics of the current context.
+struct ImFontBuildAllocator { ImGuiMemAllocFunc AllocFunc; ImGuiMemFreeFunc FreeFunc; void* UserData; };
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+#define STBTT_malloc(x,u)   ((u) ? ((ImFontBuildAllocator*)(u))->AllocFunc(x, ((ImFontBuildAllocator*)(u))->UserData) : IM_ALLOC(x))
+#define STBTT_free(x,u)     ((u) ? ((ImFontBuildAllocator*)(u))->FreeFunc(x, ((ImFontBuildAllocator*)(u))->UserData) : IM_FREE(x))
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -367,6 +374,50 @@ void ImGui::StyleColorsLight(ImGuiStyle* dst)
 // [SECTION] ImDrawList
 //-----------------------------------------------------------------------------
 
+ImDrawTransform::ImDrawTransform(const ImVec2& offset, float scale, float rot)
+{
+    const float c = ImCos(rot) * scale;
+    const float s = ImSin(rot) * scale;
+    AxisX = ImVec2(c, s);
+    AxisY = ImVec2(-s, c);
+    Offset = offset;
+}
+
+ImDrawTransform ImDrawTransform::Combine(const ImDrawTransform& inner) const
+{
+    return ImDrawTransform(AxisX * inner.AxisX.x + AxisY * inner.AxisX.y, AxisX * inner.AxisY.x + AxisY * inner.AxisY.y, Apply(inner.Offset));
+}
+
+// Return an all-zero transform if this one isn't invertible.
+ImDrawTransform ImDrawTransform::GetInverse() const
+{
+    const float det = AxisX.x * AxisY.y - AxisY.x * AxisX.y;
+    if (det == 0.0f)
+        return ImDrawTransform(ImVec2(0.0f, 0.0f), ImVec2(0.0f, 0.0f), ImVec2(0.0f, 0.0f));
+    const float inv_det = 1.0f / det;
+    ImDrawTransform inv(ImVec2(AxisY.y * inv_det, -AxisX.y * inv_det), ImVec2(-AxisY.x * inv_det, AxisX.x * inv_det), ImVec2(0.0f, 0.0f));
+    inv.Offset = ImVec2(0.0f, 0.0f) - inv.Apply(Offset);
+    return inv;
+}
+
+// Largest singular value of the linear part
+float ImDrawTransform::GetScale() const
+{
+    const float e = (AxisX.x * AxisX.x + AxisX.y * AxisX.y + AxisY.x * AxisY.x + AxisY.y * AxisY.y) * 0.5f;
+    const float det = AxisX.x * AxisY.y - AxisY.x * AxisX.y;
+    return ImSqrt(e + ImSqrt(ImMax(e * e - det * det, 0.0f)));
+}
+
+// Bounding box of a transformed rectangle (x1, y1, x2, y2)
+static ImVec4 ImDrawTransformRect(const ImDrawTransform& tr, const ImVec4& r)
+{
+    const ImVec2 p1 = tr.Apply(ImVec2(r.x, r.y)), p2 = tr.Apply(ImVec2(r.z, r.y));
+    const ImVec2 p3 = tr.Apply(ImVec2(r.z, r.w)), p4 = tr.Apply(ImVec2(r.x, r.w));
+    const ImVec2 bb_min = ImMin(ImMin(p1, p2), ImMin(p3, p4));
+    const ImVec2 bb_max = ImMax(ImMax(p1, p2), ImMax(p3, p4));
+    return ImVec4(bb_min.x, bb_min.y, bb_max.x, bb_max.y);
+}
+
 ImDrawListSharedData::ImDrawListSharedData()
 {
     memset(this, 0, sizeof(*this));
@@ -393,6 +444,172 @@ void ImDrawListSharedData::SetCircleTessellationMaxError(float max_error)
     ArcFastRadiusCutoff = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC_R(IM_DRAWLIST_ARCFAST_SAMPLE_MAX, CircleSegmentMaxError);
 }
 
+// Tables are appended to a single buffer, so returned pointer is only valid until next call.
+const ImVec2* ImDrawListSharedData::GetCircleVtx(int num_segments)
+{
+    if (num_segments < 3 || num_segments > IM_DRAWLIST_CIRCLE_VTX_CACHE_MAX)
+        return NULL;
+    if (ReadOnly && (num_segments >= CircleVtxOffsets.Size || CircleVtxOffsets[num_segments] == -1))
+        return NULL;
+    if (CircleVtxOffsets.Size <= num_segments)
+    {
+        const int old_size = CircleVtxOffsets.Size;
+        CircleVtxOffsets.resize(num_segments + 1);
+        for (int n = old_size; n <= num_segments; n++)
+            CircleVtxOffsets[n] = -1;
+    }
+    int offset = CircleVtxOffsets[num_segments];
+    if (offset == -1)
+    {
+        offset = CircleVtxOffsets[num_segments] = CircleVtxBuffer.Size;
+        CircleVtxBuffer.resize(offset + num_segments);
+        for (int i = 0; i < num_segments; i++)
+        {
+            const float a = ((float)i * 2 * IM_PI) / (float)num_segments;
+            CircleVtxBuffer[offset + i] = ImVec2(ImCos(a), ImSin(a));
+        }
+    }
+    return CircleVtxBuffer.Data + offset;
+}
+
+void* ImDrawListFrameArena::Alloc(size_t size)
+{
+    size = (size + 15) & ~(size_t)15;
+    ImVector<ImDrawListFrameArenaBlock>& blocks = Blocks[CurrentSet];
+    for (ImDrawListFrameArenaBlock& block : blocks)
+        if (block.Offset + size <= block.Size)
+        {
+            void* ptr = block.Data + block.Offset;
+            block.Offset += size;
+            UsedBytes += size;
+            return ptr;
+        }
+    if (BlocksLocked)
+        return NULL;
+
+    // New block is at least as large as all previous ones, so a set quickly ends up needing a single block
+    ImDrawListFrameArenaBlock block;
+    block.Size = 64 * 1024;
+    for (const ImDrawListFrameArenaBlock& prev_block : blocks)
+        block.Size += prev_block.Size;
+    block.Size = ImMax(block.Size, size);
+    block.Data = (char*)IM_ALLOC(block.Size);
+    block.Offset = size;
+    blocks.push_back(block);
+    UsedBytes += size;
+    return block.Data;
+}
+
+bool ImDrawListFrameArena::Extend(void* ptr, size_t old_size, size_t new_size)
+{
+    old_size = (old_size + 15) & ~(size_t)15;
+    new_size = (new_size + 15) & ~(size_t)15;
+    for (ImDrawListFrameArenaBlock& block : Blocks[CurrentSet])
+        if ((char*)ptr >= block.Data && (char*)ptr < block.Data + block.Size)
+        {
+            if ((char*)ptr + old_size != block.Data + block.Offset || block.Offset - old_size + new_size > block.Size)
+                return false;
+            block.Offset += new_size - old_size;
+            UsedBytes += new_size - old_size;
+            return true;
+        }
+    return false;
+}
+
+bool ImDrawListFrameArena::Contains(const void* ptr) const
+{
+    for (const ImVector<ImDrawListFrameArenaBlock>& blocks : Blocks)
+        for (const ImDrawListFrameArenaBlock& block : blocks)
+            if ((const char*)ptr >= block.Data && (const char*)ptr < block.Data + block.Size)
+                return true;
+    return false;
+}
+
+// Start carving from the other set of blocks. Allocations made two frames ago are now invalid.
+void ImDrawListFrameArena::NewFrame()
+{
+    CurrentSet ^= 1;
+    for (ImDrawListFrameArenaBlock& block : Blocks[CurrentSet])
+        block.Offset = 0;
+    for (void* ptr : PendingFrees[CurrentSet])
+        IM_FREE(ptr);
+    PendingFrees[CurrentSet].resize(0);
+    UsedBytesPrevFrame = UsedBytes;
+    UsedBytes = 0;
+}
+
+// Only call when no draw list may point to the arena anymore.
+void ImDrawListFrameArena::ClearFreeMemory()
+{
+    for (ImVector<ImDrawListFrameArenaBlock>& set_blocks : Blocks)
+    {
+        ImVector<ImDrawListFrameArenaBlock> blocks;
+        blocks.swap(set_blocks); // So Contains() doesn't match the blocks we are freeing
+        for (ImDrawListFrameArenaBlock& block : blocks)
+            IM_FREE(block.Data);
+    }
+    for (ImVector<void*>& pending_frees : PendingFrees)
+    {
+        for (void* ptr : pending_frees)
+            IM_FREE(ptr);
+        pending_frees.clear();
+    }
+    UsedBytes = UsedBytesPrevFrame = 0;
+}
+
+size_t ImDrawListFrameArena::GetBlocksSize() const
+{
+    size_t size = 0;
+    for (const ImVector<ImDrawListFrameArenaBlock>& blocks : Blocks)
+        for (const ImDrawListFrameArenaBlock& block : blocks)
+            size += block.Size;
+    return size;
+}
+
+// Grow capacity of a draw list buffer about to be resized to 'new_size', carving new storage from the frame arena when enabled.
+// Otherwise ImVector<> grows it from the heap as usual. Freeing the old storage is a no-op if it came from the arena.
+template<typename T>
+static inline void ImDrawListGrowFromArena(ImDrawListFrameArena* arena, ImVector<T>& buf, int new_size)
+{
+    if (new_size <= buf.Capacity || arena == NULL || !arena->Enabled)
+        return;
+    const int new_capacity = buf._grow_capacity(new_size);
+    if (buf.Data != NULL && arena->Extend(buf.Data, (size_t)buf.Capacity * sizeof(T), (size_t)new_capacity * sizeof(T)))
+    {
+        buf.Capacity = new_capacity;
+        return;
+    }
+    if (T* new_data = (T*)arena->Alloc((size_t)new_capacity * sizeof(T)))
+    {
+        if (buf.Data != NULL)
+        {
+            memcpy((void*)new_data, (const void*)buf.Data, (size_t)buf.Size * sizeof(T));
+            IM_FREE(buf.Data);
+        }
+        buf.Data = new_data;
+        buf.Capacity = new_capacity;
+    }
+}
+
+// Release storage which is either from the arena (to be reused by later frames: we must stop using it) or from the heap when the arena is enabled,
+// then carve storage for the same size as previous frame (plus some slack), so in steady state each buffer is allocated once per frame next to the other ones.
+template<typename T>
+static void ImDrawListResetFromArena(ImDrawListFrameArena* arena, ImVector<T>& buf)
+{
+    const int prev_size = buf.Size;
+    if (arena->Contains(buf.Data))
+    {
+        buf.clear(); // MemFree() ignores it
+    }
+    else if (arena->Enabled && buf.Data != NULL)
+    {
+        arena->FreeLater(buf.Data); // Previous frame ImDrawData may still be read from
+        buf.Data = NULL;
+        buf.Size = buf.Capacity = 0;
+    }
+    ImDrawListGrowFromArena(arena, buf, prev_size + prev_size / 4);
+}
+
 // Initialize before use in a new frame. We always have a command ready in the buffer.
 // In the majority of cases, you would want to call PushClipRect() and PushTextureID() after this.
 void ImDrawList::_ResetForNewFrame()
@@ -403,21 +620,47 @@ void ImDrawList::_ResetForNewFrame()
     IM_STATIC_ASSERT(offsetof(ImDrawCmd, VtxOffset) == sizeof(ImVec4) + sizeof(ImTextureID));
     if (_Splitter._Count > 1)
         _Splitter.Merge(this);
+    if (_FrameArena != NULL)
+    {
+        ImDrawListResetFromArena(_FrameArena, CmdBuffer);
+        ImDrawListResetFromArena(_FrameArena, IdxBuffer);
+        ImDrawListResetFromArena(_FrameArena, VtxBuffer);
+        if (_FrameArena->Contains(RectBuffer.Data))
+            RectBuffer.clear();
+    }
 
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
     VtxBuffer.resize(0);
+    RectBuffer.resize(0);
+    IdxSegments.resize(0);
     Flags = _Data->InitialFlags;
+    IdxSize = sizeof(ImDrawIdx);
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
     _IdxWritePtr = NULL;
     _ClipRectStack.resize(0);
     _TextureIdStack.resize(0);
+    _TransformStack.resize(0);
+    _TransformScale = 1.0f;
     _Path.resize(0);
     _Splitter.Clear();
+    _SplitterChannelDepth = 0;
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = 1.0f;
+    _CulledPrimCount = 0;
+    _RectMergeBounds.resize(0);
+    _RectMergeIdxEnd = (unsigned int)-1;
+}
+
+// Public version of _ResetForNewFrame() for draw lists not owned by Dear ImGui, e.g. filled by worker threads (see ImGui::BeginDrawListThreads())
+void ImDrawList::ResetForNewFrame()
+{
+    _ResetForNewFrame();
+    PushClipRectFullScreen();
+    if (_Data->Font != NULL)
+        PushTextureID(_Data->Font->ContainerAtlas->TexID);
 }
 
 void ImDrawList::_ClearFreeMemory()
@@ -425,23 +668,63 @@ void ImDrawList::_ClearFreeMemory()
     CmdBuffer.clear();
     IdxBuffer.clear();
     VtxBuffer.clear();
+    RectBuffer.clear();
+    for (int n = 0; n < IdxSegments.Capacity; n++)
+        IdxSegments.Data[n].IdxBuffer.clear();
+    IdxSegments.clear();
     Flags = ImDrawListFlags_None;
+    IdxSize = sizeof(ImDrawIdx);
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
     _IdxWritePtr = NULL;
     _ClipRectStack.clear();
     _TextureIdStack.clear();
+    _TransformStack.clear();
+    _TransformScale = 1.0f;
     _Path.clear();
+    _TempBuffer.clear();
+    _TransformBuffer.clear();
+    _RectMergeBounds.clear();
+    _RectMergeIdxEnd = (unsigned int)-1;
     _Splitter.ClearFreeMemory();
 }
 
+template<typename T>
+static void ImDrawListDetachFromArena(ImDrawListFrameArena* arena, ImVector<T>& buf)
+{
+    if (!arena->Contains(buf.Data))
+        return;
+    ImVector<T> heap_buf;
+    heap_buf = buf;
+    buf.swap(heap_buf); // Destructor of 'heap_buf' doesn't free arena storage
+}
+
+// Move buffers allocated from the frame arena to the heap, so contents stay valid after two frames without calling _ResetForNewFrame().
+void ImDrawList::_DetachFromFrameArena()
+{
+    if (_FrameArena == NULL)
+        return;
+    ImDrawListDetachFromArena(_FrameArena, CmdBuffer);
+    ImDrawListDetachFromArena(_FrameArena, IdxBuffer);
+    ImDrawListDetachFromArena(_FrameArena, VtxBuffer);
+    ImDrawListDetachFromArena(_FrameArena, RectBuffer);
+    for (ImDrawIdxSegment& segment : IdxSegments)
+        ImDrawListDetachFromArena(_FrameArena, segment.IdxBuffer);
+    _VtxWritePtr = VtxBuffer.Data + VtxBuffer.Size;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+}
+
 ImDrawList* ImDrawList::CloneOutput() const
 {
     ImDrawList* dst = IM_NEW(ImDrawList(_Data));
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
+    for (const ImDrawIdxSegment& segment : IdxSegments)
+        memcpy((char*)dst->IdxBuffer.Data + segment.IdxOffset * IdxSize, segment.IdxBuffer.Data, (size_t)segment.IdxBuffer.Size * IdxSize);
     dst->VtxBuffer = VtxBuffer;
+    dst->RectBuffer = RectBuffer;
     dst->Flags = Flags;
+    dst->IdxSize = IdxSize;
     return dst;
 }
 
@@ -452,8 +735,10 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.TextureId = _CmdHeader.TextureId;
     draw_cmd.VtxOffset = _CmdHeader.VtxOffset;
     draw_cmd.IdxOffset = IdxBuffer.Size;
+    draw_cmd.RectOffset = RectBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
+    ImDrawListGrowFromArena(_FrameArena, CmdBuffer, CmdBuffer.Size + 1);
     CmdBuffer.push_back(draw_cmd);
 }
 
@@ -464,18 +749,87 @@ void ImDrawList::_PopUnusedDrawCmd()
     while (CmdBuffer.Size > 0)
     {
         ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-        if (curr_cmd->ElemCount != 0 || curr_cmd->UserCallback != NULL)
+        if (curr_cmd->ElemCount != 0 || curr_cmd->RectCount != 0 || curr_cmd->UserCallback != NULL)
             return;// break;
         CmdBuffer.pop_back();
     }
 }
 
+// Pack 32-bit indices to 16-bit ones in place, if every vertex can be addressed with a 16-bit index.
+// - Called on finished draw lists when ImDrawListFlags_AllowPackedIdx is set (see ImGuiBackendFlags_RendererHasPackedIdx).
+// - IdxBuffer.Size, ImDrawCmd::IdxOffset and ImDrawCmd::ElemCount are unchanged and still expressed in number of indices.
+// - Note that this leaves the ImDrawList in a state unfit for further commands.
+void ImDrawList::_PackIdxBuffer()
+{
+    if (sizeof(ImDrawIdx) != 4 || IdxSize != 4 || VtxBuffer.Size > (1 << 16))
+        return;
+    for (int segment_n = -1; segment_n < IdxSegments.Size; segment_n++)
+    {
+        ImVector<ImDrawIdx>& buf = (segment_n < 0) ? IdxBuffer : IdxSegments.Data[segment_n].IdxBuffer;
+        const ImDrawIdx* src = buf.Data;
+        ImU16* dst = (ImU16*)(void*)buf.Data; // Writing index n never overwrites indices >= n
+        for (int idx_n = 0; idx_n < buf.Size; idx_n++)
+            dst[idx_n] = (ImU16)src[idx_n];
+    }
+    IdxSize = 2;
+}
+
+// Use next entry of IdxSegments[], reusing allocation left there by a previous frame (see ImDrawListSplitter::Merge()).
+ImDrawIdxSegment* ImDrawList::_AddIdxSegment()
+{
+    if (IdxSegments.Size == IdxSegments.Capacity)
+    {
+        // ImVector<> only preserves [0..Size) when growing, which here is every entry. Clear new unused entries.
+        const int old_capacity = IdxSegments.Capacity;
+        IdxSegments.reserve(IdxSegments._grow_capacity(old_capacity + 1));
+        memset((void*)(IdxSegments.Data + old_capacity), 0, (size_t)(IdxSegments.Capacity - old_capacity) * sizeof(ImDrawIdxSegment));
+    }
+    ImDrawIdxSegment* segment = &IdxSegments.Data[IdxSegments.Size++];
+    if (_FrameArena != NULL && _FrameArena->Contains(segment->IdxBuffer.Data))
+        segment->IdxBuffer.clear(); // Allocated from the frame arena by a previous frame: don't reuse
+    segment->IdxBuffer.resize(0);
+    return segment;
+}
+
+// Copy indices of IdxSegments[] into their range of IdxBuffer[]. Needed before reading IdxBuffer[] directly.
+void ImDrawList::_FlattenIdxSegments()
+{
+    for (const ImDrawIdxSegment& segment : IdxSegments)
+        memcpy((char*)IdxBuffer.Data + segment.IdxOffset * IdxSize, segment.IdxBuffer.Data, (size_t)segment.IdxBuffer.Size * IdxSize);
+    IdxSegments.resize(0);
+}
+
+// Return buffer holding index 'idx_n' (IdxBuffer[] or one of IdxSegments[]) and index position in this buffer.
+const void* ImDrawList::_GetIdxPtrFromSegments(int idx_n, int* out_idx_n) const
+{
+    int lo = 0, hi = IdxSegments.Size;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        if (IdxSegments.Data[mid].IdxOffset <= (unsigned int)idx_n)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo > 0)
+    {
+        const ImDrawIdxSegment& segment = IdxSegments.Data[lo - 1];
+        if ((unsigned int)idx_n < segment.IdxOffset + (unsigned int)segment.IdxBuffer.Size)
+        {
+            *out_idx_n = idx_n - (int)segment.IdxOffset;
+            return segment.IdxBuffer.Data;
+        }
+    }
+    *out_idx_n = idx_n;
+    return IdxBuffer.Data;
+}
+
 void ImDrawList::AddCallback(ImDrawCallback callback, void* callback_data)
 {
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     IM_ASSERT(curr_cmd->UserCallback == NULL);
-    if (curr_cmd->ElemCount != 0)
+    if (curr_cmd->ElemCount != 0 || curr_cmd->RectCount != 0)
     {
         AddDrawCmd();
         curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
@@ -491,6 +845,7 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* callback_data)
 #define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset
 #define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)          (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TextureId, VtxOffset
 #define ImDrawCmd_AreSequentialIdxOffset(CMD_0, CMD_1)  (CMD_0->IdxOffset + CMD_0->ElemCount == CMD_1->IdxOffset)
+#define ImDrawCmd_AreSequentialRects(CMD_0, CMD_1)      (CMD_0->ElemCount == 0 && CMD_1->ElemCount == 0 && CMD_0->RectOffset + CMD_0->RectCount == CMD_1->RectOffset) // Both commands only draw rectangle instances, which are contiguous
 
 // Try to merge two last draw commands
 void ImDrawList::_TryMergeDrawCmds()
@@ -500,6 +855,12 @@ void ImDrawList::_TryMergeDrawCmds()
     ImDrawCmd* prev_cmd = curr_cmd - 1;
     if (ImDrawCmd_HeaderCompare(curr_cmd, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && curr_cmd->UserCallback == NULL && prev_cmd->UserCallback == NULL)
     {
+        if (curr_cmd->RectCount != 0 || prev_cmd->RectCount != 0)
+        {
+            if (!ImDrawCmd_AreSequentialRects(prev_cmd, curr_cmd))
+                return;
+            prev_cmd->RectCount += curr_cmd->RectCount;
+        }
         prev_cmd->ElemCount += curr_cmd->ElemCount;
         CmdBuffer.pop_back();
     }
@@ -512,7 +873,7 @@ void ImDrawList::_OnChangedClipRect()
     // If current command is used with different settings we need to add a new command
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount != 0 && memcmp(&curr_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
+    if ((curr_cmd->ElemCount != 0 || curr_cmd->RectCount != 0) && memcmp(&curr_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
     {
         AddDrawCmd();
         return;
@@ -521,7 +882,7 @@ void ImDrawList::_OnChangedClipRect()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->RectCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
     {
         CmdBuffer.pop_back();
         return;
@@ -535,7 +896,7 @@ void ImDrawList::_OnChangedTextureID()
     // If current command is used with different settings we need to add a new command
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount != 0 && curr_cmd->TextureId != _CmdHeader.TextureId)
+    if ((curr_cmd->ElemCount != 0 || curr_cmd->RectCount != 0) && curr_cmd->TextureId != _CmdHeader.TextureId)
     {
         AddDrawCmd();
         return;
@@ -544,7 +905,7 @@ void ImDrawList::_OnChangedTextureID()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->RectCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
     {
         CmdBuffer.pop_back();
         return;
@@ -560,7 +921,7 @@ void ImDrawList::_OnChangedVtxOffset()
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     //IM_ASSERT(curr_cmd->VtxOffset != _CmdHeader.VtxOffset); // See #3349
-    if (curr_cmd->ElemCount != 0)
+    if (curr_cmd->ElemCount != 0 || curr_cmd->RectCount != 0)
     {
         AddDrawCmd();
         return;
@@ -571,7 +932,9 @@ void ImDrawList::_OnChangedVtxOffset()
 
 int ImDrawList::_CalcCircleAutoSegmentCount(float radius) const
 {
-    // Automatic segment count
+    // Automatic segment count, for radius after transform
+    if (_TransformStack.Size > 0)
+        radius *= _TransformScale;
     const int radius_idx = (int)(radius + 0.999999f); // ceil to never reduce accuracy
     if (radius_idx >= 0 && radius_idx < IM_ARRAYSIZE(_Data->CircleSegmentCounts))
         return _Data->CircleSegmentCounts[radius_idx]; // Use cached value
@@ -625,6 +988,22 @@ void ImDrawList::PopTextureID()
     _OnChangedTextureID();
 }
 
+// Transform positions of subsequent primitives. Unlike post-processing vertices, this lets tessellation and anti-aliasing fringes adapt to the transform.
+void ImDrawList::PushTransform(const ImDrawTransform& transform, bool combine_with_current_transform)
+{
+    _Transform = (combine_with_current_transform && _TransformStack.Size > 0) ? _Transform.Combine(transform) : transform;
+    _TransformStack.push_back(_Transform);
+    _TransformScale = _Transform.GetScale();
+}
+
+void ImDrawList::PopTransform()
+{
+    _TransformStack.pop_back();
+    if (_TransformStack.Size > 0)
+        _Transform = _TransformStack.Data[_TransformStack.Size - 1];
+    _TransformScale = (_TransformStack.Size > 0) ? _Transform.GetScale() : 1.0f;
+}
+
 // Reserve space for a number of vertices and indices.
 // You must finish filling your reserved data before calling PrimReserve() again, as it may reallocate or
 // submit the intermediate results. PrimUnreserve() can be used to release unused allocations.
@@ -641,14 +1020,22 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
         _OnChangedVtxOffset();
     }
 
+    // Triangles and rectangle instances are never mixed in a same command
     ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if (draw_cmd->RectCount != 0)
+    {
+        AddDrawCmd();
+        draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    }
     draw_cmd->ElemCount += idx_count;
 
     int vtx_buffer_old_size = VtxBuffer.Size;
+    ImDrawListGrowFromArena(_FrameArena, VtxBuffer, vtx_buffer_old_size + vtx_count);
     VtxBuffer.resize(vtx_buffer_old_size + vtx_count);
     _VtxWritePtr = VtxBuffer.Data + vtx_buffer_old_size;
 
     int idx_buffer_old_size = IdxBuffer.Size;
+    ImDrawListGrowFromArena(_FrameArena, IdxBuffer, idx_buffer_old_size + idx_count);
     IdxBuffer.resize(idx_buffer_old_size + idx_count);
     _IdxWritePtr = IdxBuffer.Data + idx_buffer_old_size;
 }
@@ -660,6 +1047,7 @@ void ImDrawList::PrimUnreserve(int idx_count, int vtx_count)
 
     ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     draw_cmd->ElemCount -= idx_count;
+    _RectMergeIdxEnd = (unsigned int)-1; // Released indices may be overwritten, see _RectInstanceCanSkipCurrentCmd()
     VtxBuffer.shrink(VtxBuffer.Size - vtx_count);
     IdxBuffer.shrink(IdxBuffer.Size - idx_count);
 }
@@ -668,6 +1056,11 @@ void ImDrawList::PrimUnreserve(int idx_count, int vtx_count)
 void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
 {
     ImVec2 b(c.x, a.y), d(a.x, c.y), uv(_Data->TexUvWhitePixel);
+    if (_TransformStack.Size > 0)
+    {
+        PrimQuadUV(a, b, c, d, uv, uv, uv, uv, col);
+        return;
+    }
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
@@ -683,6 +1076,11 @@ void ImDrawList::PrimRect(const ImVec2& a, const ImVec2& c, ImU32 col)
 void ImDrawList::PrimRectUV(const ImVec2& a, const ImVec2& c, const ImVec2& uv_a, const ImVec2& uv_c, ImU32 col)
 {
     ImVec2 b(c.x, a.y), d(a.x, c.y), uv_b(uv_c.x, uv_a.y), uv_d(uv_a.x, uv_c.y);
+    if (_TransformStack.Size > 0)
+    {
+        PrimQuadUV(a, b, c, d, uv_a, uv_b, uv_c, uv_d, col);
+        return;
+    }
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
@@ -700,10 +1098,20 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
     ImDrawIdx idx = (ImDrawIdx)_VtxCurrentIdx;
     _IdxWritePtr[0] = idx; _IdxWritePtr[1] = (ImDrawIdx)(idx+1); _IdxWritePtr[2] = (ImDrawIdx)(idx+2);
     _IdxWritePtr[3] = idx; _IdxWritePtr[4] = (ImDrawIdx)(idx+2); _IdxWritePtr[5] = (ImDrawIdx)(idx+3);
-    _VtxWritePtr[0].pos = a; _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
-    _VtxWritePtr[1].pos = b; _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
-    _VtxWritePtr[2].pos = c; _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
-    _VtxWritePtr[3].pos = d; _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
+    if (_TransformStack.Size > 0)
+    {
+        _VtxWritePtr[0].pos = _Transform.Apply(a); _VtxWritePtr[1].pos = _Transform.Apply(b);
+        _VtxWritePtr[2].pos = _Transform.Apply(c); _VtxWritePtr[3].pos = _Transform.Apply(d);
+    }
+    else
+    {
+        _VtxWritePtr[0].pos = a; _VtxWritePtr[1].pos = b;
+        _VtxWritePtr[2].pos = c; _VtxWritePtr[3].pos = d;
+    }
+    _VtxWritePtr[0].uv = uv_a; _VtxWritePtr[0].col = col;
+    _VtxWritePtr[1].uv = uv_b; _VtxWritePtr[1].col = col;
+    _VtxWritePtr[2].uv = uv_c; _VtxWritePtr[2].col = col;
+    _VtxWritePtr[3].uv = uv_d; _VtxWritePtr[3].col = col;
     _VtxWritePtr += 4;
     _VtxCurrentIdx += 4;
     _IdxWritePtr += 6;
@@ -716,12 +1124,299 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// Margins added by ImDrawListFlags_CullPrimitives to the bounding box of input points.
+// IM_FIXNORMAL2F() lets miter joins and anti-aliased fringes extend up to sqrt(IM_FIXNORMAL2F_MAX_INVLEN2) = 10 times their nominal width.
+#define IM_DRAWLIST_CULL_PAD_FILL                       (_FringeScale * 10.0f)
+#define IM_DRAWLIST_CULL_PAD_STROKE(THICKNESS)          (((THICKNESS) * 0.5f + _FringeScale) * 10.0f)
+
+// Same as _CullBoundingBox() for the bounding box of 'points'
+bool ImDrawList::_CullPoints(const ImVec2* points, int points_count, float pad)
+{
+    ImVec2 bb_min = points[0], bb_max = points[0];
+    for (int i = 1; i < points_count; i++)
+    {
+        bb_min = ImMin(bb_min, points[i]);
+        bb_max = ImMax(bb_max, points[i]);
+    }
+    return _CullBoundingBox(bb_min, bb_max, pad);
+}
+
+// SIMD helpers used by AddPolyline() and ImFindMinMaxIndices(), processing 4 points or values at a time.
+// - Output is bit-identical to the scalar path: we only use IEEE operations, and our vector reciprocal square root matches ImRsqrt():
+//   SSE: _mm_rsqrt_ps() shares its approximation with _mm_rsqrt_ss(). NEON: vsqrtq_f32() + vdivq_f32() match 1.0f / sqrtf().
+// - Disabled when IMGUI_DISABLE_DEFAULT_MATH_FUNCTIONS is set, as we cannot match a user-provided ImRsqrt().
+#if (defined(IMGUI_ENABLE_SSE) || defined(IMGUI_ENABLE_NEON)) && !defined(IMGUI_DISABLE_DEFAULT_MATH_FUNCTIONS)
+#define IM_DRAWLIST_POLYLINE_SIMD
+#ifdef IMGUI_ENABLE_SSE
+typedef __m128 ImFloat4;
+static inline ImFloat4  ImFloat4Set1(float v)                           { return _mm_set1_ps(v); }
+static inline ImFloat4  ImFloat4Load(const float* p)                    { return _mm_loadu_ps(p); }
+static inline void      ImFloat4Store(float* p, ImFloat4 v)             { _mm_storeu_ps(p, v); }
+static inline ImFloat4  ImFloat4Min(ImFloat4 a, ImFloat4 b)             { return _mm_min_ps(a, b); } // Return b where a is NaN
+static inline ImFloat4  ImFloat4Max(ImFloat4 a, ImFloat4 b)             { return _mm_max_ps(a, b); } // Return b where a is NaN
+static inline ImFloat4  ImFloat4Add(ImFloat4 a, ImFloat4 b)             { return _mm_add_ps(a, b); }
+static inline ImFloat4  ImFloat4Sub(ImFloat4 a, ImFloat4 b)             { return _mm_sub_ps(a, b); }
+static inline ImFloat4  ImFloat4Mul(ImFloat4 a, ImFloat4 b)             { return _mm_mul_ps(a, b); }
+static inline ImFloat4  ImFloat4Div(ImFloat4 a, ImFloat4 b)             { return _mm_div_ps(a, b); }
+static inline ImFloat4  ImFloat4Neg(ImFloat4 a)                         { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+static inline ImFloat4  ImFloat4Rsqrt(ImFloat4 a)                       { return _mm_rsqrt_ps(a); }
+static inline ImFloat4  ImFloat4SelectGt(ImFloat4 a, ImFloat4 b, ImFloat4 v_true, ImFloat4 v_false) { ImFloat4 m = _mm_cmpgt_ps(a, b); return _mm_or_ps(_mm_and_ps(m, v_true), _mm_andnot_ps(m, v_false)); } // (a > b) ? v_true : v_false
+static inline void      ImFloat4LoadVec2(const ImVec2* p, ImFloat4* out_x, ImFloat4* out_y) { ImFloat4 a = _mm_loadu_ps(&p[0].x), b = _mm_loadu_ps(&p[2].x); *out_x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)); *out_y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)); }
+static inline void      ImFloat4StoreVec2(ImVec2* p, ImFloat4 x, ImFloat4 y)                { _mm_storeu_ps(&p[0].x, _mm_unpacklo_ps(x, y)); _mm_storeu_ps(&p[2].x, _mm_unpackhi_ps(x, y)); }
+static inline void      ImFloat4StoreTransposed(float* p, int stride, ImFloat4 a, ImFloat4 b, ImFloat4 c, ImFloat4 d) { _MM_TRANSPOSE4_PS(a, b, c, d); _mm_storeu_ps(p, a); _mm_storeu_ps(p + stride, b); _mm_storeu_ps(p + stride * 2, c); _mm_storeu_ps(p + stride * 3, d); }
+#else
+typedef float32x4_t ImFloat4;
+static inline ImFloat4  ImFloat4Set1(float v)                           { return vdupq_n_f32(v); }
+static inline ImFloat4  ImFloat4Load(const float* p)                    { return vld1q_f32(p); }
+static inline void      ImFloat4Store(float* p, ImFloat4 v)             { vst1q_f32(p, v); }
+static inline ImFloat4  ImFloat4Min(ImFloat4 a, ImFloat4 b)             { return vminnmq_f32(a, b); } // Return b where a is NaN
+static inline ImFloat4  ImFloat4Max(ImFloat4 a, ImFloat4 b)             { return vmaxnmq_f32(a, b); } // Return b where a is NaN
+static inline ImFloat4  ImFloat4Add(ImFloat4 a, ImFloat4 b)             { return vaddq_f32(a, b); }
+static inline ImFloat4  ImFloat4Sub(ImFloat4 a, ImFloat4 b)             { return vsubq_f32(a, b); }
+static inline ImFloat4  ImFloat4Mul(ImFloat4 a, ImFloat4 b)             { return vmulq_f32(a, b); }
+static inline ImFloat4  ImFloat4Div(ImFloat4 a, ImFloat4 b)             { return vdivq_f32(a, b); }
+static inline ImFloat4  ImFloat4Neg(ImFloat4 a)                         { return vnegq_f32(a); }
+static inline ImFloat4  ImFloat4Rsqrt(ImFloat4 a)                       { return vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(a)); }
+static inline ImFloat4  ImFloat4SelectGt(ImFloat4 a, ImFloat4 b, ImFloat4 v_true, ImFloat4 v_false) { return vbslq_f32(vcgtq_f32(a, b), v_true, v_false); }
+static inline void      ImFloat4LoadVec2(const ImVec2* p, ImFloat4* out_x, ImFloat4* out_y) { float32x4x2_t v = vld2q_f32(&p[0].x); *out_x = v.val[0]; *out_y = v.val[1]; }
+static inline void      ImFloat4StoreVec2(ImVec2* p, ImFloat4 x, ImFloat4 y)                { float32x4x2_t v; v.val[0] = x; v.val[1] = y; vst2q_f32(&p[0].x, v); }
+static inline void      ImFloat4StoreTransposed(float* p, int stride, ImFloat4 a, ImFloat4 b, ImFloat4 c, ImFloat4 d) { float32x4x2_t ac = vzipq_f32(a, c), bd = vzipq_f32(b, d), r01 = vzipq_f32(ac.val[0], bd.val[0]), r23 = vzipq_f32(ac.val[1], bd.val[1]); vst1q_f32(p, r01.val[0]); vst1q_f32(p + stride, r01.val[1]); vst1q_f32(p + stride * 2, r23.val[0]); vst1q_f32(p + stride * 3, r23.val[1]); }
+#endif
+
+// Same as IM_NORMALIZE2F_OVER_ZERO()
+static inline void ImFloat4Normalize2OverZero(ImFloat4* vx, ImFloat4* vy)
+{
+    const ImFloat4 d2 = ImFloat4Add(ImFloat4Mul(*vx, *vx), ImFloat4Mul(*vy, *vy));
+    const ImFloat4 inv_len = ImFloat4Rsqrt(d2);
+    const ImFloat4 zero = ImFloat4Set1(0.0f);
+    *vx = ImFloat4SelectGt(d2, zero, ImFloat4Mul(*vx, inv_len), *vx);
+    *vy = ImFloat4SelectGt(d2, zero, ImFloat4Mul(*vy, inv_len), *vy);
+}
+
+// Same as IM_FIXNORMAL2F()
+static inline void ImFloat4FixNormal2(ImFloat4* vx, ImFloat4* vy)
+{
+    const ImFloat4 d2 = ImFloat4Add(ImFloat4Mul(*vx, *vx), ImFloat4Mul(*vy, *vy));
+    ImFloat4 inv_len2 = ImFloat4Div(ImFloat4Set1(1.0f), d2);
+    inv_len2 = ImFloat4SelectGt(inv_len2, ImFloat4Set1(IM_FIXNORMAL2F_MAX_INVLEN2), ImFloat4Set1(IM_FIXNORMAL2F_MAX_INVLEN2), inv_len2);
+    const ImFloat4 min_d2 = ImFloat4Set1(0.000001f);
+    *vx = ImFloat4SelectGt(d2, min_d2, ImFloat4Mul(*vx, inv_len2), *vx);
+    *vy = ImFloat4SelectGt(d2, min_d2, ImFloat4Mul(*vy, inv_len2), *vy);
+}
+#endif // #if IM_DRAWLIST_POLYLINE_SIMD
+
+// Calculate normals (tangents) for each line segment. Segment i1 goes from point i1 to point i1+1 (wrapping to 0 for the last segment of a closed line).
+static void PolylineCalcSegmentNormals(const ImVec2* points, const int points_count, const int count, ImVec2* out_normals)
+{
+    int i1 = 0;
+#ifdef IM_DRAWLIST_POLYLINE_SIMD
+    for (; i1 + 4 < points_count; i1 += 4)
+    {
+        ImFloat4 p1_x, p1_y, p2_x, p2_y;
+        ImFloat4LoadVec2(&points[i1], &p1_x, &p1_y);
+        ImFloat4LoadVec2(&points[i1 + 1], &p2_x, &p2_y);
+        ImFloat4 dx = ImFloat4Sub(p2_x, p1_x);
+        ImFloat4 dy = ImFloat4Sub(p2_y, p1_y);
+        ImFloat4Normalize2OverZero(&dx, &dy);
+        ImFloat4StoreVec2(&out_normals[i1], dy, ImFloat4Neg(dx));
+    }
+#endif
+    for (; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i1].x = dy;
+        out_normals[i1].y = -dx;
+    }
+}
+
+// Calculate edge points for each line point, offset by averaged normals.
+// - The edge points of point i2 are written at out_points[i2 * offsets_count + n], offsets_count is 2 or 4.
+// - With 2 offsets: (+offsets[0], -offsets[0]). With 4 offsets: (+offsets[1], +offsets[0], -offsets[0], -offsets[1]).
+// - This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps).
+static void PolylineCalcEdgePoints(const ImVec2* points, const ImVec2* normals, const int points_count, const int count, const float* offsets, const int offsets_count, ImVec2* out_points)
+{
+    IM_ASSERT_PARANOID(offsets_count == 2 || offsets_count == 4);
+    int i1 = 0;
+#ifdef IM_DRAWLIST_POLYLINE_SIMD
+    const ImFloat4 half = ImFloat4Set1(0.5f);
+    const ImFloat4 offset_in = ImFloat4Set1(offsets[0]);
+    const ImFloat4 offset_out = ImFloat4Set1(offsets[1]);
+    for (; i1 + 4 < points_count; i1 += 4)
+    {
+        // Average normals
+        ImFloat4 n1_x, n1_y, n2_x, n2_y, p2_x, p2_y;
+        ImFloat4LoadVec2(&normals[i1], &n1_x, &n1_y);
+        ImFloat4LoadVec2(&normals[i1 + 1], &n2_x, &n2_y);
+        ImFloat4LoadVec2(&points[i1 + 1], &p2_x, &p2_y);
+        ImFloat4 dm_x = ImFloat4Mul(ImFloat4Add(n1_x, n2_x), half);
+        ImFloat4 dm_y = ImFloat4Mul(ImFloat4Add(n1_y, n2_y), half);
+        ImFloat4FixNormal2(&dm_x, &dm_y);
+
+        const ImFloat4 dm_in_x = ImFloat4Mul(dm_x, offset_in);
+        const ImFloat4 dm_in_y = ImFloat4Mul(dm_y, offset_in);
+        float* out = &out_points[(i1 + 1) * offsets_count].x;
+        if (offsets_count == 2)
+        {
+            ImFloat4StoreTransposed(out, 4, ImFloat4Add(p2_x, dm_in_x), ImFloat4Add(p2_y, dm_in_y), ImFloat4Sub(p2_x, dm_in_x), ImFloat4Sub(p2_y, dm_in_y));
+        }
+        else
+        {
+            const ImFloat4 dm_out_x = ImFloat4Mul(dm_x, offset_out);
+            const ImFloat4 dm_out_y = ImFloat4Mul(dm_y, offset_out);
+            ImFloat4StoreTransposed(out + 0, 8, ImFloat4Add(p2_x, dm_out_x), ImFloat4Add(p2_y, dm_out_y), ImFloat4Add(p2_x, dm_in_x), ImFloat4Add(p2_y, dm_in_y));
+            ImFloat4StoreTransposed(out + 4, 8, ImFloat4Sub(p2_x, dm_in_x), ImFloat4Sub(p2_y, dm_in_y), ImFloat4Sub(p2_x, dm_out_x), ImFloat4Sub(p2_y, dm_out_y));
+        }
+    }
+#endif
+    for (; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+
+        // Average normals
+        float dm_x = (normals[i1].x + normals[i2].x) * 0.5f;
+        float dm_y = (normals[i1].y + normals[i2].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        const float dm_in_x = dm_x * offsets[0];
+        const float dm_in_y = dm_y * offsets[0];
+
+        ImVec2* out_vtx = &out_points[i2 * offsets_count];
+        if (offsets_count == 2)
+        {
+            out_vtx[0].x = points[i2].x + dm_in_x;
+            out_vtx[0].y = points[i2].y + dm_in_y;
+            out_vtx[1].x = points[i2].x - dm_in_x;
+            out_vtx[1].y = points[i2].y - dm_in_y;
+        }
+        else
+        {
+            const float dm_out_x = dm_x * offsets[1];
+            const float dm_out_y = dm_y * offsets[1];
+            out_vtx[0].x = points[i2].x + dm_out_x;
+            out_vtx[0].y = points[i2].y + dm_out_y;
+            out_vtx[1].x = points[i2].x + dm_in_x;
+            out_vtx[1].y = points[i2].y + dm_in_y;
+            out_vtx[2].x = points[i2].x - dm_in_x;
+            out_vtx[2].y = points[i2].y - dm_in_y;
+            out_vtx[3].x = points[i2].x - dm_out_x;
+            out_vtx[3].y = points[i2].y - dm_out_y;
+        }
+    }
+}
+
+// Same as _CullBoundingBox() for a bounding box in coordinates before transform. 'pad' is scaled as it may include thickness.
+bool ImDrawList::_CullTransformedBoundingBox(const ImVec2& bb_min, const ImVec2& bb_max, float pad)
+{
+    const ImVec4 bb = ImDrawTransformRect(_Transform, ImVec4(bb_min.x, bb_min.y, bb_max.x, bb_max.y));
+    pad *= ImMax(_TransformScale, 1.0f);
+    const ImVec4& cr = _CmdHeader.ClipRect;
+    if (bb.x - pad <= cr.z && bb.y - pad <= cr.w && bb.z + pad >= cr.x && bb.w + pad >= cr.y)
+        return false;
+    _CulledPrimCount++;
+    return true;
+}
+
+// Return transformed copy of 'points', valid until next call.
+const ImVec2* ImDrawList::_TransformPoints(const ImVec2* points, int points_count)
+{
+    _TransformBuffer.reserve_discard(points_count);
+    ImVec2* out = _TransformBuffer.Data;
+    const ImDrawTransform& tr = _Transform;
+    for (int i = 0; i < points_count; i++)
+        out[i] = tr.Apply(points[i]);
+    return out;
+}
+
+// Find indices of the smallest and largest values in a strided array (values_stride in bytes). On ties the lowest index is reported.
+bool ImFindMinMaxIndices(const float* values, int values_count, int values_stride, int* out_idx_min, int* out_idx_max)
+{
+    int idx_min = -1, idx_max = -1;
+    float v_min = FLT_MAX, v_max = -FLT_MAX;
+    int i = 0;
+#ifdef IM_DRAWLIST_POLYLINE_SIMD
+    // Find smallest and largest values with SIMD min/max over blocks of values, remembering which blocks they came from, then rescan those two blocks.
+    if (values_stride == sizeof(float) || values_stride == sizeof(ImVec2))
+    {
+        // With an 8 bytes stride each load also reads the float following the 4th value: stop one value early so we never read past the last value.
+        const int values_step = values_stride / (int)sizeof(float);
+        const int simd_count = (values_step == 1) ? (values_count & ~3) : (ImMax(values_count - 1, 0) & ~3);
+        const int block_size = 256;
+        int block_min = -1, block_max = -1;
+        for (int block_begin = 0; block_begin < simd_count; block_begin += block_size)
+        {
+            const int block_end = ImMin(block_begin + block_size, simd_count);
+            ImFloat4 vec_min = ImFloat4Set1(INFINITY), vec_max = ImFloat4Set1(-INFINITY);
+            if (values_step == 1)
+            {
+                for (int n = block_begin; n < block_end; n += 4)
+                {
+                    const ImFloat4 v = ImFloat4Load(values + n);
+                    vec_min = ImFloat4Min(v, vec_min);
+                    vec_max = ImFloat4Max(v, vec_max);
+                }
+            }
+            else
+            {
+                for (int n = block_begin; n < block_end; n += 4)
+                {
+                    ImFloat4 v, v_unused;
+                    ImFloat4LoadVec2((const ImVec2*)(const void*)(values + n * 2), &v, &v_unused);
+                    vec_min = ImFloat4Min(v, vec_min);
+                    vec_max = ImFloat4Max(v, vec_max);
+                }
+            }
+            float lanes_min[4], lanes_max[4];
+            ImFloat4Store(lanes_min, vec_min);
+            ImFloat4Store(lanes_max, vec_max);
+            const float block_v_min = ImMin(ImMin(lanes_min[0], lanes_min[1]), ImMin(lanes_min[2], lanes_min[3]));
+            const float block_v_max = ImMax(ImMax(lanes_max[0], lanes_max[1]), ImMax(lanes_max[2], lanes_max[3]));
+            if (block_v_min > block_v_max) // Only NaN values
+                continue;
+            if (block_min == -1 || block_v_min < v_min)
+                { v_min = block_v_min; block_min = block_begin; }
+            if (block_max == -1 || block_v_max > v_max)
+                { v_max = block_v_max; block_max = block_begin; }
+        }
+        if (block_min != -1)
+        {
+            for (idx_min = block_min; values[idx_min * values_step] != v_min; idx_min++) {}
+            for (idx_max = block_max; values[idx_max * values_step] != v_max; idx_max++) {}
+        }
+        i = simd_count;
+    }
+#endif
+    for (; i < values_count; i++)
+    {
+        const float v = *(const float*)(const void*)((const unsigned char*)values + (size_t)i * values_stride);
+        if (v != v) // Ignore NaN values
+            continue;
+        if (idx_min == -1 || v < v_min)
+            { v_min = v; idx_min = i; }
+        if (idx_max == -1 || v > v_max)
+            { v_max = v; idx_max = i; }
+    }
+    if (idx_min == -1)
+        return false;
+    *out_idx_min = idx_min;
+    *out_idx_max = idx_max;
+    return true;
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
 {
     if (points_count < 2 || (col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullPoints(points, points_count, IM_DRAWLIST_CULL_PAD_STROKE(thickness)))
+        return;
+    if (_TransformStack.Size > 0)
+    {
+        points = _TransformPoints(points, points_count);
+        thickness *= _TransformScale;
+    }
 
     const bool closed = (flags & ImDrawFlags_Closed) != 0;
     const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
@@ -753,20 +1448,12 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
 
         // Temporary buffer
         // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
-        ImVec2* temp_normals = _Data->TempBuffer.Data;
+        _TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
+        ImVec2* temp_normals = _TempBuffer.Data;
         ImVec2* temp_points = temp_normals + points_count;
 
         // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
+        PolylineCalcSegmentNormals(points, points_count, count, temp_normals);
         if (!closed)
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
 
@@ -792,29 +1479,16 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
+            // Add temporary vertexes for the outer edges (offset by averaged normals to the outer edge of the AA area)
+            const float edge_offsets[2] = { half_draw_size, half_draw_size };
+            PolylineCalcEdgePoints(points, temp_normals, points_count, count, edge_offsets, 2, temp_points);
+
+            // Generate the indices to form a number of triangles for each line segment
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
-
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertexes for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -888,35 +1562,17 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
             }
 
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
+            // Add temporary vertices for the outer and inner edges
+            const float edge_offsets[2] = { half_inner_thickness, half_inner_thickness + AA_SIZE };
+            PolylineCalcEdgePoints(points, temp_normals, points_count, count, edge_offsets, 4, temp_points);
+
+            // Generate the indices to form a number of triangles for each line segment
             // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
                 // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
@@ -974,12 +1630,84 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
     }
 }
 
+// Min/max decimation: points sharing a pixel column are reduced to the first, lowest, highest and last ones, in their original order.
+// This keeps the visible envelope of the line (including single-sample spikes) while tessellating at most 4 points per column.
+// - Points are expected to be sorted by increasing x. Unsorted points are still drawn, only less decimated.
+// - Uses _Path, so don't call while building a path.
+void ImDrawList::AddPolylineDecimated(const ImVec2* points, const int points_count, ImU32 col, float thickness)
+{
+    // Culling is left to AddPolyline(): the decimated path has the same bounding box as 'points', and is much cheaper to scan.
+    if (points_count < 2 || (col & IM_COL32_A_MASK) == 0)
+        return;
+
+    // Columns are pixel columns after transform, which requires x to only depend on x
+    float column_scale = 1.0f, column_offset = 0.0f;
+    if (_TransformStack.Size > 0)
+    {
+        if (_Transform.AxisX.x <= 0.0f || _Transform.AxisX.y != 0.0f || _Transform.AxisY.x != 0.0f)
+        {
+            AddPolyline(points, points_count, col, ImDrawFlags_None, thickness);
+            return;
+        }
+        column_scale = _Transform.AxisX.x;
+        column_offset = _Transform.Offset.x;
+    }
+
+    _Path.resize(0);
+    int i0 = 0;
+    while (i0 < points_count)
+    {
+        const float column_end_x = (ImFloor(points[i0].x * column_scale + column_offset) + 1.0f - column_offset) / column_scale;
+        // Find the end of the column with an exponential search: points are sorted by x, and dense columns are the point of this function.
+        int i_lo = i0, i1 = i0 + 1, step = 1;
+        while (i1 < points_count && points[i1].x < column_end_x)
+        {
+            i_lo = i1;
+            i1 += step;
+            step *= 2;
+        }
+        i1 = ImMin(i1, points_count);
+        while (i1 - i_lo > 1)
+        {
+            const int i_mid = i_lo + (i1 - i_lo) / 2;
+            if (points[i_mid].x < column_end_x)
+                i_lo = i_mid;
+            else
+                i1 = i_mid;
+        }
+        if (i1 - i0 <= 4)
+        {
+            for (int i = i0; i < i1; i++)
+                _Path.push_back(points[i]);
+        }
+        else
+        {
+            int idx_min, idx_max;
+            int idx_list[4] = { 0, 0, 0, i1 - i0 - 1 };
+            if (ImFindMinMaxIndices(&points[i0].y, i1 - i0, (int)sizeof(ImVec2), &idx_min, &idx_max))
+            {
+                idx_list[1] = ImMin(idx_min, idx_max);
+                idx_list[2] = ImMax(idx_min, idx_max);
+            }
+            for (int n = 0; n < 4; n++)
+                if (n == 0 || idx_list[n] != idx_list[n - 1])
+                    _Path.push_back(points[i0 + idx_list[n]]);
+        }
+        i0 = i1;
+    }
+    PathStroke(col, ImDrawFlags_None, thickness);
+}
+
 // - We intentionally avoid using ImVec2 and its math operators here to reduce cost to a minimum for debug/non-inlined builds.
 // - Filled shapes must always use clockwise winding order. The anti-aliasing fringe depends on it. Counter-clockwise shapes will have "inward" anti-aliasing.
 void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_count, ImU32 col)
 {
     if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullPoints(points, points_count, IM_DRAWLIST_CULL_PAD_FILL))
+        return;
+    if (_TransformStack.Size > 0)
+        points = _TransformPoints(points, points_count);
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
 
@@ -1002,8 +1730,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         }
 
         // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
-        ImVec2* temp_normals = _Data->TempBuffer.Data;
+        _TempBuffer.reserve_discard(points_count);
+        ImVec2* temp_normals = _TempBuffer.Data;
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
             const ImVec2& p0 = points[i0];
@@ -1150,16 +1878,59 @@ void ImDrawList::_PathArcToFastEx(const ImVec2& center, float radius, int a_min_
     IM_ASSERT_PARANOID(_Path.Data + _Path.Size == out_ptr);
 }
 
-void ImDrawList::_PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments)
+// Return cached unit circle samples if angles 'a_min + i * a_step' all land on them (e.g. AddCircle(), AddNgon(), AddEllipse()), NULL otherwise.
+static const ImVec2* GetCircleVtxForArcStep(ImDrawListSharedData* data, float a_step, int* out_table_size)
 {
-    if (radius < 0.5f)
-    {
-        _Path.push_back(center);
-        return;
+    const float circle_div_f = (IM_PI * 2.0f) / ImAbs(a_step);
+    if (!(circle_div_f >= 3.0f && circle_div_f < IM_DRAWLIST_CIRCLE_VTX_CACHE_MAX + 0.5f)) // Also reject a_step == 0.0f and NaN
+        return NULL;
+    const int circle_div = (int)(circle_div_f + 0.5f);
+    if (ImAbs((float)circle_div * ImAbs(a_step) - IM_PI * 2.0f) > (IM_PI * 2.0f) * 1e-6f) // Don't let small step errors accumulate
+        return NULL;
+    *out_table_size = circle_div;
+    return data->GetCircleVtx(circle_div);
+}
+
+// Append 'count' points 'center + m * table[n]' where 'm' is a 2x2 matrix ({ m00, m01 }, { m10, m11 }),
+// for 'n' going from 'table_start' forward or backward (wrapping around the circle).
+static void PathAddCircleVtx(ImVector<ImVec2>& path, const ImVec2& center, const ImVec2* table, int table_size, int table_start, bool backward, int count, float m00, float m01, float m10, float m11)
+{
+    path.resize(path.Size + count);
+    ImVec2* out_ptr = path.Data + path.Size - count;
+    int table_n = table_start;
+    for (int i = 0; i < count; i++)
+    {
+        const ImVec2 t = table[table_n];
+        out_ptr[i].x = center.x + m00 * t.x + m01 * t.y;
+        out_ptr[i].y = center.y + m10 * t.x + m11 * t.y;
+        if (backward)
+            table_n = (table_n == 0) ? table_size - 1 : table_n - 1;
+        else
+            table_n = (table_n == table_size - 1) ? 0 : table_n + 1;
+    }
+}
+
+void ImDrawList::_PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments)
+{
+    if (radius < 0.5f)
+    {
+        _Path.push_back(center);
+        return;
     }
 
     // Note that we are adding a point at both a_min and a_max.
     // If you are trying to draw a full closed circle you don't want the overlapping points!
+    const float a_step = (a_max - a_min) / (float)num_segments;
+    int table_size = 0;
+    if (const ImVec2* table = GetCircleVtxForArcStep(_Data, a_step, &table_size))
+    {
+        // Rotate unit circle samples to start at a_min
+        const float cos_a = (a_min == 0.0f) ? 1.0f : ImCos(a_min);
+        const float sin_a = (a_min == 0.0f) ? 0.0f : ImSin(a_min);
+        PathAddCircleVtx(_Path, center, table, table_size, 0, a_step < 0.0f, num_segments + 1, cos_a * radius, -sin_a * radius, sin_a * radius, cos_a * radius);
+        return;
+    }
+
     _Path.reserve(_Path.Size + (num_segments + 1));
     for (int i = 0; i <= num_segments; i++)
     {
@@ -1194,7 +1965,7 @@ void ImDrawList::PathArcTo(const ImVec2& center, float radius, float a_min, floa
     }
 
     // Automatic segment count
-    if (radius <= _Data->ArcFastRadiusCutoff)
+    if (radius * _TransformScale <= _Data->ArcFastRadiusCutoff)
     {
         const bool a_is_reverse = a_max < a_min;
 
@@ -1222,10 +1993,38 @@ void ImDrawList::PathArcTo(const ImVec2& center, float radius, float a_min, floa
     }
     else
     {
-        const float arc_length = ImAbs(a_max - a_min);
+        // Same as above with cached samples for the automatic segment count of this radius.
         const int circle_segment_count = _CalcCircleAutoSegmentCount(radius);
-        const int arc_segment_count = ImMax((int)ImCeil(circle_segment_count * arc_length / (IM_PI * 2.0f)), (int)(2.0f * IM_PI / arc_length));
-        _PathArcToN(center, radius, a_min, a_max, arc_segment_count);
+        const ImVec2* table = _Data->GetCircleVtx(circle_segment_count);
+        if (table == NULL)
+        {
+            // Table not built yet and shared data is read-only: calculate samples
+            const float arc_length = ImAbs(a_max - a_min);
+            const int arc_segment_count = ImMax((int)ImCeil(circle_segment_count * arc_length / (IM_PI * 2.0f)), (int)(2.0f * IM_PI / arc_length));
+            _PathArcToN(center, radius, a_min, a_max, arc_segment_count);
+            return;
+        }
+        const bool a_is_reverse = a_max < a_min;
+        const float a_min_sample_f = circle_segment_count * a_min / (IM_PI * 2.0f);
+        const float a_max_sample_f = circle_segment_count * a_max / (IM_PI * 2.0f);
+        const int a_min_sample = a_is_reverse ? (int)ImFloor(a_min_sample_f) : (int)ImCeil(a_min_sample_f);
+        const int a_max_sample = a_is_reverse ? (int)ImCeil(a_max_sample_f) : (int)ImFloor(a_max_sample_f);
+        const int a_mid_samples = a_is_reverse ? ImMax(a_min_sample - a_max_sample + 1, 0) : ImMax(a_max_sample - a_min_sample + 1, 0);
+        const bool a_emit_start = a_mid_samples == 0 || ImAbs(a_min_sample - a_min_sample_f) * (IM_PI * 2.0f) >= 1e-5f * circle_segment_count;
+        const bool a_emit_end = a_mid_samples == 0 || ImAbs(a_max_sample_f - a_max_sample) * (IM_PI * 2.0f) >= 1e-5f * circle_segment_count;
+
+        _Path.reserve(_Path.Size + (a_mid_samples + (a_emit_start ? 1 : 0) + (a_emit_end ? 1 : 0)));
+        if (a_emit_start)
+            _Path.push_back(ImVec2(center.x + ImCos(a_min) * radius, center.y + ImSin(a_min) * radius));
+        if (a_mid_samples > 0)
+        {
+            int first_sample = a_min_sample % circle_segment_count;
+            if (first_sample < 0)
+                first_sample += circle_segment_count;
+            PathAddCircleVtx(_Path, center, table, circle_segment_count, first_sample, a_is_reverse, a_mid_samples, radius, 0.0f, 0.0f, radius);
+        }
+        if (a_emit_end)
+            _Path.push_back(ImVec2(center.x + ImCos(a_max) * radius, center.y + ImSin(a_max) * radius));
     }
 }
 
@@ -1234,10 +2033,22 @@ void ImDrawList::PathEllipticalArcTo(const ImVec2& center, const ImVec2& radius,
     if (num_segments <= 0)
         num_segments = _CalcCircleAutoSegmentCount(ImMax(radius.x, radius.y)); // A bit pessimistic, maybe there's a better computation to do here.
 
-    _Path.reserve(_Path.Size + (num_segments + 1));
-
     const float cos_rot = ImCos(rot);
     const float sin_rot = ImSin(rot);
+    const float a_step = (a_max - a_min) / (float)num_segments;
+    int table_size = 0;
+    if (const ImVec2* table = GetCircleVtxForArcStep(_Data, a_step, &table_size))
+    {
+        // Transform unit circle samples by rotation(rot) * scale(radius) * rotation(a_min)
+        const float cos_a = (a_min == 0.0f) ? 1.0f : ImCos(a_min);
+        const float sin_a = (a_min == 0.0f) ? 0.0f : ImSin(a_min);
+        const float e00 = cos_rot * radius.x, e01 = -sin_rot * radius.y;
+        const float e10 = sin_rot * radius.x, e11 = cos_rot * radius.y;
+        PathAddCircleVtx(_Path, center, table, table_size, 0, a_step < 0.0f, num_segments + 1, e00 * cos_a + e01 * sin_a, e01 * cos_a - e00 * sin_a, e10 * cos_a + e11 * sin_a, e11 * cos_a - e10 * sin_a);
+        return;
+    }
+
+    _Path.reserve(_Path.Size + (num_segments + 1));
     for (int i = 0; i <= num_segments; i++)
     {
         const float a = a_min + ((float)i / (float)num_segments) * (a_max - a_min);
@@ -1318,7 +2129,8 @@ void ImDrawList::PathBezierCubicCurveTo(const ImVec2& p2, const ImVec2& p3, cons
     if (num_segments == 0)
     {
         IM_ASSERT(_Data->CurveTessellationTol > 0.0f);
-        PathBezierCubicCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, p4.x, p4.y, _Data->CurveTessellationTol, 0); // Auto-tessellated
+        const float tess_tol = (_TransformStack.Size > 0) ? _Data->CurveTessellationTol / ImMax(_TransformScale * _TransformScale, 1e-6f) : _Data->CurveTessellationTol; // Tolerance is a squared distance
+        PathBezierCubicCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, p4.x, p4.y, tess_tol, 0); // Auto-tessellated
     }
     else
     {
@@ -1334,7 +2146,8 @@ void ImDrawList::PathBezierQuadraticCurveTo(const ImVec2& p2, const ImVec2& p3,
     if (num_segments == 0)
     {
         IM_ASSERT(_Data->CurveTessellationTol > 0.0f);
-        PathBezierQuadraticCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, _Data->CurveTessellationTol, 0);// Auto-tessellated
+        const float tess_tol = (_TransformStack.Size > 0) ? _Data->CurveTessellationTol / ImMax(_TransformScale * _TransformScale, 1e-6f) : _Data->CurveTessellationTol; // Tolerance is a squared distance
+        PathBezierQuadraticCurveToCasteljau(&_Path, p1.x, p1.y, p2.x, p2.y, p3.x, p3.y, tess_tol, 0);// Auto-tessellated
     }
     else
     {
@@ -1368,13 +2181,19 @@ static inline ImDrawFlags FixRectCornerFlags(ImDrawFlags flags)
     return flags;
 }
 
+static inline float ClampRectRounding(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
+{
+    rounding = ImMin(rounding, ImFabs(b.x - a.x) * (((flags & ImDrawFlags_RoundCornersTop) == ImDrawFlags_RoundCornersTop) || ((flags & ImDrawFlags_RoundCornersBottom) == ImDrawFlags_RoundCornersBottom) ? 0.5f : 1.0f) - 1.0f);
+    rounding = ImMin(rounding, ImFabs(b.y - a.y) * (((flags & ImDrawFlags_RoundCornersLeft) == ImDrawFlags_RoundCornersLeft) || ((flags & ImDrawFlags_RoundCornersRight) == ImDrawFlags_RoundCornersRight) ? 0.5f : 1.0f) - 1.0f);
+    return rounding;
+}
+
 void ImDrawList::PathRect(const ImVec2& a, const ImVec2& b, float rounding, ImDrawFlags flags)
 {
     if (rounding >= 0.5f)
     {
         flags = FixRectCornerFlags(flags);
-        rounding = ImMin(rounding, ImFabs(b.x - a.x) * (((flags & ImDrawFlags_RoundCornersTop) == ImDrawFlags_RoundCornersTop) || ((flags & ImDrawFlags_RoundCornersBottom) == ImDrawFlags_RoundCornersBottom) ? 0.5f : 1.0f) - 1.0f);
-        rounding = ImMin(rounding, ImFabs(b.y - a.y) * (((flags & ImDrawFlags_RoundCornersLeft) == ImDrawFlags_RoundCornersLeft) || ((flags & ImDrawFlags_RoundCornersRight) == ImDrawFlags_RoundCornersRight) ? 0.5f : 1.0f) - 1.0f);
+        rounding = ClampRectRounding(a, b, rounding, flags);
     }
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
@@ -1400,6 +2219,8 @@ void ImDrawList::AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float th
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(ImMin(p1, p2), ImMax(p1, p2), IM_DRAWLIST_CULL_PAD_STROKE(thickness) + 0.5f))
+        return;
     PathLineTo(p1 + ImVec2(0.5f, 0.5f));
     PathLineTo(p2 + ImVec2(0.5f, 0.5f));
     PathStroke(col, 0, thickness);
@@ -1411,10 +2232,20 @@ void ImDrawList::AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, fl
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
-    if (Flags & ImDrawListFlags_AntiAliasedLines)
-        PathRect(p_min + ImVec2(0.50f, 0.50f), p_max - ImVec2(0.50f, 0.50f), rounding, flags);
-    else
-        PathRect(p_min + ImVec2(0.50f, 0.50f), p_max - ImVec2(0.49f, 0.49f), rounding, flags); // Better looking lower-right corner and rounded non-AA shapes.
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(ImMin(p_min, p_max), ImMax(p_min, p_max), IM_DRAWLIST_CULL_PAD_STROKE(thickness)))
+        return;
+    const ImVec2 a = p_min + ImVec2(0.50f, 0.50f);
+    const ImVec2 b = (Flags & ImDrawListFlags_AntiAliasedLines) ? p_max - ImVec2(0.50f, 0.50f) : p_max - ImVec2(0.49f, 0.49f); // Better looking lower-right corner and rounded non-AA shapes.
+    if ((Flags & ImDrawListFlags_AllowRectInstances) && _TryAddRectInstance(a, b, col, rounding, flags, thickness))
+        return;
+    if ((Flags & ImDrawListFlags_RoundCornersUseTex) && rounding >= 0.5f)
+    {
+        flags = FixRectCornerFlags(flags);
+        rounding = ClampRectRounding(a, b, rounding, flags);
+        if ((flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersAll && _TryAddRoundCornersTex(a + ImVec2(rounding, rounding), b - ImVec2(rounding, rounding), rounding, col, thickness))
+            return;
+    }
+    PathRect(a, b, rounding, flags);
     PathStroke(col, ImDrawFlags_Closed, thickness);
 }
 
@@ -1422,6 +2253,10 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(ImMin(p_min, p_max), ImMax(p_min, p_max), IM_DRAWLIST_CULL_PAD_FILL))
+        return;
+    if ((Flags & ImDrawListFlags_AllowRectInstances) && _TryAddRectInstance(p_min, p_max, col, rounding, flags, 0.0f))
+        return;
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
         PrimReserve(6, 4);
@@ -1429,16 +2264,171 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
     }
     else
     {
+        if (Flags & ImDrawListFlags_RoundCornersUseTex)
+        {
+            flags = FixRectCornerFlags(flags);
+            rounding = ClampRectRounding(p_min, p_max, rounding, flags);
+            if ((flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersAll && _TryAddRoundCornersTex(p_min + ImVec2(rounding, rounding), p_max - ImVec2(rounding, rounding), rounding, col, 0.0f))
+                return;
+        }
         PathRect(p_min, p_max, rounding, flags);
         PathFillConvex(col);
     }
 }
 
+// Output a rectangle as a single ImDrawRectInstance, expanded by the renderer (see ImGuiBackendFlags_RendererHasRectInstances).
+// - Parameters are processed the same way PathRect() does. 'thickness == 0.0f' for a filled rectangle.
+// - Return false if the rectangle cannot be output as an instance, in which case the caller should tessellate it.
+bool ImDrawList::_TryAddRectInstance(const ImVec2& a, const ImVec2& b, ImU32 col, float rounding, ImDrawFlags flags, float thickness)
+{
+    IM_ASSERT_PARANOID(Flags & ImDrawListFlags_AllowRectInstances);
+    if (b.x < a.x || b.y < a.y || _TransformStack.Size > 0)
+        return false;
+    if (rounding >= 0.5f)
+    {
+        flags = FixRectCornerFlags(flags);
+        rounding = ClampRectRounding(a, b, rounding, flags);
+    }
+    if (rounding < 0.5f)
+        flags = ImDrawFlags_RoundCornersNone;
+    const bool anti_aliased = (thickness > 0.0f) ? (Flags & ImDrawListFlags_AntiAliasedLines) != 0 : (Flags & ImDrawListFlags_AntiAliasedFill) != 0 && (flags & ImDrawFlags_RoundCornersMask_) != ImDrawFlags_RoundCornersNone;
+
+    // Append to current command if it only holds contiguous instances, otherwise start a new command.
+    // When current command holds triangles, append to the previous command instead if the rectangle doesn't overlap them:
+    // this keeps e.g. frames and labels of consecutive widgets in two draw calls instead of alternating between them.
+    ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    const float extent = thickness * 0.5f + 1.0f; // Same as quads expanded by renderers
+    if (draw_cmd->ElemCount != 0 && _RectInstanceCanSkipCurrentCmd(ImVec2(a.x - extent, a.y - extent), ImVec2(b.x + extent, b.y + extent)))
+    {
+        draw_cmd--;
+    }
+    else if (draw_cmd->ElemCount != 0 || (draw_cmd->RectCount != 0 && draw_cmd->RectOffset + draw_cmd->RectCount != (unsigned int)RectBuffer.Size))
+    {
+        AddDrawCmd();
+        draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    }
+    if (draw_cmd->RectCount == 0)
+        draw_cmd->RectOffset = RectBuffer.Size;
+    draw_cmd->RectCount++;
+
+    RectBuffer.resize(RectBuffer.Size + 1);
+    ImDrawRectInstance& rect = RectBuffer.Data[RectBuffer.Size - 1];
+    rect.Min = a;
+    rect.Max = b;
+    rect.Col = col;
+    rect.Rounding = (flags & ImDrawFlags_RoundCornersMask_) != ImDrawFlags_RoundCornersNone ? rounding : 0.0f;
+    rect.Thickness = thickness;
+    rect.Flags = ((flags & ImDrawFlags_RoundCornersMask_) >> 4) | (anti_aliased ? (1 << 4) : 0);
+    return true;
+}
+
+// Return true if a rectangle instance covering 'bb_min'..'bb_max' can be appended to the command preceding current one, without changing the rendered output.
+// - Previous command must only hold contiguous rectangle instances and have the same header, current command holds triangles.
+// - Bounding boxes of those triangles are accumulated incrementally in _RectMergeBounds[], one per range of indices added between calls.
+//   Pixels covered by the rectangle and by none of those triangles are unaffected by their relative order.
+bool ImDrawList::_RectInstanceCanSkipCurrentCmd(const ImVec2& bb_min, const ImVec2& bb_max)
+{
+    if (CmdBuffer.Size < 2)
+        return false;
+    const ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    const ImDrawCmd* prev_cmd = curr_cmd - 1;
+    if (prev_cmd->RectCount == 0 || prev_cmd->ElemCount != 0 || prev_cmd->RectOffset + prev_cmd->RectCount != (unsigned int)RectBuffer.Size)
+        return false;
+    if (prev_cmd->UserCallback != NULL || curr_cmd->UserCallback != NULL || ImDrawCmd_HeaderCompare(prev_cmd, &_CmdHeader) != 0)
+        return false;
+
+    // Update bounding boxes with indices added since last call
+    const unsigned int idx_end = curr_cmd->IdxOffset + curr_cmd->ElemCount;
+    if (_RectMergeIdxOffset != curr_cmd->IdxOffset || _RectMergeIdxEnd > idx_end)
+    {
+        _RectMergeBounds.resize(0);
+        _RectMergeIdxOffset = _RectMergeIdxEnd = curr_cmd->IdxOffset;
+    }
+    if (_RectMergeIdxEnd < idx_end)
+    {
+        if (_RectMergeBounds.Size < 64)
+            _RectMergeBounds.push_back(ImVec4(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX));
+        ImVec4 bounds = _RectMergeBounds.Data[_RectMergeBounds.Size - 1]; // When full, accumulate into last box
+        const ImDrawVert* vtx_buffer = VtxBuffer.Data + curr_cmd->VtxOffset;
+        for (unsigned int idx_n = _RectMergeIdxEnd; idx_n < idx_end; idx_n++)
+        {
+            const ImVec2 p = vtx_buffer[_GetIdx((int)idx_n)].pos;
+            bounds.x = ImMin(bounds.x, p.x); bounds.y = ImMin(bounds.y, p.y);
+            bounds.z = ImMax(bounds.z, p.x); bounds.w = ImMax(bounds.w, p.y);
+        }
+        _RectMergeBounds.Data[_RectMergeBounds.Size - 1] = bounds;
+        _RectMergeIdxEnd = idx_end;
+    }
+
+    // Touching boxes may share pixels
+    for (int bounds_n = 0; bounds_n < _RectMergeBounds.Size; bounds_n++)
+    {
+        const ImVec4& bounds = _RectMergeBounds.Data[bounds_n];
+        if (bb_min.x <= bounds.z && bb_min.y <= bounds.w && bb_max.x >= bounds.x && bb_max.y >= bounds.y)
+            return false;
+    }
+    return true;
+}
+
+// Output a circle or a rectangle with all corners rounded as a grid of quads, sampling quarter circles baked in the atlas (see ImFontAtlasBuildRenderRoundCornersTexData()).
+// - 'c_min' and 'c_max' are the centers of top-left and bottom-right corners, equal for a circle. 'thickness == 0.0f' for a filled shape.
+// - Other radii use the nearest baked radius, scaled.
+// - Return false if the shape cannot be output with textures, in which case the caller should tessellate it.
+bool ImDrawList::_TryAddRoundCornersTex(const ImVec2& c_min, const ImVec2& c_max, float radius, ImU32 col, float thickness)
+{
+    IM_ASSERT_PARANOID(Flags & ImDrawListFlags_RoundCornersUseTex);
+    if (_TransformStack.Size > 0)
+        return false;
+    const bool stroked = (thickness > 0.0f);
+    if (stroked ? (thickness != 1.0f || !(Flags & ImDrawListFlags_AntiAliasedLines)) : !(Flags & ImDrawListFlags_AntiAliasedFill))
+        return false;
+    const float tex_radius = stroked ? ImTrunc(radius * 2.0f + 0.5f) * 0.5f : ImTrunc(radius + 0.5f);
+    if (radius < 1.0f || tex_radius > IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX)
+        return false;
+
+    // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_RoundCornersUseTex unless ImFontAtlasFlags_NoBakedRoundCorners is off
+    IM_ASSERT_PARANOID(!(_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners));
+    const ImVec4 tex_uvs = stroked ? _Data->TexUvRoundCornersStroked[(int)(tex_radius * 2.0f)] : _Data->TexUvRoundCornersFilled[(int)tex_radius];
+    const float extent = (tex_radius + (stroked ? 1.0f : 0.5f)) * (radius / tex_radius);
+
+    // Vertices: outer edge, corner centers, outer edge on each axis (corner centers are merged for a circle).
+    // Sprites are mirrored: edges between corners sample the column/row going through the sprite center.
+    float xs[4] = { c_min.x - extent, c_min.x, c_max.x, c_max.x + extent };
+    float ys[4] = { c_min.y - extent, c_min.y, c_max.y, c_max.y + extent };
+    float us[4] = { tex_uvs.z, tex_uvs.x, tex_uvs.x, tex_uvs.z };
+    float vs[4] = { tex_uvs.w, tex_uvs.y, tex_uvs.y, tex_uvs.w };
+    int x_count = 4, y_count = 4;
+    if (c_max.x <= c_min.x) { xs[2] = xs[3]; us[2] = us[3]; x_count = 3; }
+    if (c_max.y <= c_min.y) { ys[2] = ys[3]; vs[2] = vs[3]; y_count = 3; }
+
+    // Quads are output as (a, b, c), (a, c, d) with a=top-left, b=top-right, c=bottom-right, d=bottom-left, like PrimRect().
+    // The center quad is transparent for a stroked rectangle.
+    const bool skip_center = stroked && x_count == 4 && y_count == 4;
+    const int quads_count = (x_count - 1) * (y_count - 1) - (skip_center ? 1 : 0);
+    PrimReserve(quads_count * 6, x_count * y_count);
+    const unsigned int idx = _VtxCurrentIdx;
+    for (int y = 0; y < y_count; y++)
+        for (int x = 0; x < x_count; x++)
+            PrimWriteVtx(ImVec2(xs[x], ys[y]), ImVec2(us[x], vs[y]), col);
+    for (int y = 0; y < y_count - 1; y++)
+        for (int x = 0; x < x_count - 1; x++)
+        {
+            if (skip_center && x == 1 && y == 1)
+                continue;
+            const unsigned int i = idx + y * x_count + x;
+            PrimWriteIdx((ImDrawIdx)(i)); PrimWriteIdx((ImDrawIdx)(i + 1)); PrimWriteIdx((ImDrawIdx)(i + x_count + 1));
+            PrimWriteIdx((ImDrawIdx)(i)); PrimWriteIdx((ImDrawIdx)(i + x_count + 1)); PrimWriteIdx((ImDrawIdx)(i + x_count));
+        }
+    return true;
+}
+
 // p_min = upper-left, p_max = lower-right
 void ImDrawList::AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_max, ImU32 col_upr_left, ImU32 col_upr_right, ImU32 col_bot_right, ImU32 col_bot_left)
 {
     if (((col_upr_left | col_upr_right | col_bot_right | col_bot_left) & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(ImMin(p_min, p_max), ImMax(p_min, p_max), 0.0f))
+        return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
     PrimReserve(6, 4);
@@ -1454,6 +2444,8 @@ void ImDrawList::AddQuad(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, c
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), IM_DRAWLIST_CULL_PAD_STROKE(thickness)))
+        return;
 
     PathLineTo(p1);
     PathLineTo(p2);
@@ -1466,6 +2458,8 @@ void ImDrawList::AddQuadFilled(const ImVec2& p1, const ImVec2& p2, const ImVec2&
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), IM_DRAWLIST_CULL_PAD_FILL))
+        return;
 
     PathLineTo(p1);
     PathLineTo(p2);
@@ -1478,6 +2472,8 @@ void ImDrawList::AddTriangle(const ImVec2& p1, const ImVec2& p2, const ImVec2& p
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(ImMin(ImMin(p1, p2), p3), ImMax(ImMax(p1, p2), p3), IM_DRAWLIST_CULL_PAD_STROKE(thickness)))
+        return;
 
     PathLineTo(p1);
     PathLineTo(p2);
@@ -1489,6 +2485,8 @@ void ImDrawList::AddTriangleFilled(const ImVec2& p1, const ImVec2& p2, const ImV
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(ImMin(ImMin(p1, p2), p3), ImMax(ImMax(p1, p2), p3), IM_DRAWLIST_CULL_PAD_FILL))
+        return;
 
     PathLineTo(p1);
     PathLineTo(p2);
@@ -1500,6 +2498,10 @@ void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int nu
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(center - ImVec2(radius, radius), center + ImVec2(radius, radius), IM_DRAWLIST_CULL_PAD_STROKE(thickness)))
+        return;
+    if (num_segments <= 0 && (Flags & ImDrawListFlags_RoundCornersUseTex) && _TryAddRoundCornersTex(center, center, radius - 0.5f, col, thickness))
+        return;
 
     if (num_segments <= 0)
     {
@@ -1524,6 +2526,10 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(center - ImVec2(radius, radius), center + ImVec2(radius, radius), IM_DRAWLIST_CULL_PAD_FILL))
+        return;
+    if (num_segments <= 0 && (Flags & ImDrawListFlags_RoundCornersUseTex) && _TryAddRoundCornersTex(center, center, radius, col, 0.0f))
+        return;
 
     if (num_segments <= 0)
     {
@@ -1549,6 +2555,8 @@ void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_
 {
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(center - ImVec2(radius, radius), center + ImVec2(radius, radius), IM_DRAWLIST_CULL_PAD_STROKE(thickness)))
+        return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
@@ -1561,6 +2569,8 @@ void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, in
 {
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(center - ImVec2(radius, radius), center + ImVec2(radius, radius), IM_DRAWLIST_CULL_PAD_FILL))
+        return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
@@ -1573,6 +2583,8 @@ void ImDrawList::AddEllipse(const ImVec2& center, const ImVec2& radius, ImU32 co
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(center - ImVec2(ImMax(radius.x, radius.y), ImMax(radius.x, radius.y)), center + ImVec2(ImMax(radius.x, radius.y), ImMax(radius.x, radius.y)), IM_DRAWLIST_CULL_PAD_STROKE(thickness)))
+        return;
 
     if (num_segments <= 0)
         num_segments = _CalcCircleAutoSegmentCount(ImMax(radius.x, radius.y)); // A bit pessimistic, maybe there's a better computation to do here.
@@ -1587,6 +2599,8 @@ void ImDrawList::AddEllipseFilled(const ImVec2& center, const ImVec2& radius, Im
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(center - ImVec2(ImMax(radius.x, radius.y), ImMax(radius.x, radius.y)), center + ImVec2(ImMax(radius.x, radius.y), ImMax(radius.x, radius.y)), IM_DRAWLIST_CULL_PAD_FILL))
+        return;
 
     if (num_segments <= 0)
         num_segments = _CalcCircleAutoSegmentCount(ImMax(radius.x, radius.y)); // A bit pessimistic, maybe there's a better computation to do here.
@@ -1602,6 +2616,8 @@ void ImDrawList::AddBezierCubic(const ImVec2& p1, const ImVec2& p2, const ImVec2
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), IM_DRAWLIST_CULL_PAD_STROKE(thickness))) // Curve is within the convex hull of its control points
+        return;
 
     PathLineTo(p1);
     PathBezierCubicCurveTo(p2, p3, p4, num_segments);
@@ -1613,6 +2629,8 @@ void ImDrawList::AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const Im
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(ImMin(ImMin(p1, p2), p3), ImMax(ImMax(p1, p2), p3), IM_DRAWLIST_CULL_PAD_STROKE(thickness)))
+        return;
 
     PathLineTo(p1);
     PathBezierQuadraticCurveTo(p2, p3, num_segments);
@@ -1638,7 +2656,10 @@ void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos,
 
     IM_ASSERT(font->ContainerAtlas->TexID == _CmdHeader.TextureId);  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
 
+    // With a transform, coarse clipping uses the bounding box of the clipping rectangle before transform, and 'cpu_fine_clip_rect' is before transform.
     ImVec4 clip_rect = _CmdHeader.ClipRect;
+    if (_TransformStack.Size > 0)
+        clip_rect = ImDrawTransformRect(_Transform.GetInverse(), clip_rect);
     if (cpu_fine_clip_rect)
     {
         clip_rect.x = ImMax(clip_rect.x, cpu_fine_clip_rect->x);
@@ -1658,6 +2679,8 @@ void ImDrawList::AddImage(ImTextureID user_texture_id, const ImVec2& p_min, cons
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(ImMin(p_min, p_max), ImMax(p_min, p_max), 0.0f))
+        return;
 
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
     if (push_texture_id)
@@ -1674,6 +2697,8 @@ void ImDrawList::AddImageQuad(ImTextureID user_texture_id, const ImVec2& p1, con
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(ImMin(ImMin(p1, p2), ImMin(p3, p4)), ImMax(ImMax(p1, p2), ImMax(p3, p4)), 0.0f))
+        return;
 
     const bool push_texture_id = user_texture_id != _CmdHeader.TextureId;
     if (push_texture_id)
@@ -1690,6 +2715,8 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_mi
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullBoundingBox(ImMin(p_min, p_max), ImMax(p_min, p_max), IM_DRAWLIST_CULL_PAD_FILL))
+        return;
 
     flags = FixRectCornerFlags(flags);
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
@@ -1706,7 +2733,20 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_mi
     PathRect(p_min, p_max, rounding, flags);
     PathFillConvex(col);
     int vert_end_idx = VtxBuffer.Size;
-    ImGui::ShadeVertsLinearUV(this, vert_start_idx, vert_end_idx, p_min, p_max, uv_min, uv_max, true);
+    if (_TransformStack.Size > 0)
+    {
+        // UV are a function of positions before transform
+        const ImDrawTransform inv_transform = _Transform.GetInverse();
+        for (int vtx_n = vert_start_idx; vtx_n < vert_end_idx; vtx_n++)
+            VtxBuffer.Data[vtx_n].pos = inv_transform.Apply(VtxBuffer.Data[vtx_n].pos);
+        ImGui::ShadeVertsLinearUV(this, vert_start_idx, vert_end_idx, p_min, p_max, uv_min, uv_max, true);
+        for (int vtx_n = vert_start_idx; vtx_n < vert_end_idx; vtx_n++)
+            VtxBuffer.Data[vtx_n].pos = _Transform.Apply(VtxBuffer.Data[vtx_n].pos);
+    }
+    else
+    {
+        ImGui::ShadeVertsLinearUV(this, vert_start_idx, vert_end_idx, p_min, p_max, uv_min, uv_max, true);
+    }
 
     if (push_texture_id)
         PopTextureID();
@@ -1717,9 +2757,11 @@ void ImDrawList::AddImageRounded(ImTextureID user_texture_id, const ImVec2& p_mi
 //-----------------------------------------------------------------------------
 // Triangulate concave polygons. Based on "Triangulation by Ear Clipping" paper, O(N^2) complexity.
 // Reference: https://www.geometrictools.com/Documentation/TriangulationByEarClipping.pdf
+// Large polygons use a sweep-line monotone decomposition instead, O(N log N) complexity.
 // Provided as a convenience for user but not used by main library.
 //-----------------------------------------------------------------------------
 // - ImTriangulator [Internal]
+// - ImTriangulatorMonotone [Internal]
 // - AddConcavePolyFilled()
 //-----------------------------------------------------------------------------
 
@@ -1928,137 +2970,541 @@ void ImTriangulator::ReclassifyNode(ImTriangulatorNode* n1)
     n1->Type = type;
 }
 
-// Use ear-clipping algorithm to triangulate a simple polygon (no self-interaction, no holes).
-// (Reminder: we don't perform any coarse clipping/culling in ImDrawList layer!
-// It is up to caller to ensure not making costly calls that will be outside of visible area.
-// As concave fill is noticeably more expensive than other primitives, be mindful of this...
-// Caller can build AABB of points, and avoid filling if 'draw_list->_CmdHeader.ClipRect.Overlays(points_bb) == false')
-void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+// Sweep-line triangulation, O(N log N) complexity: split polygon into y-monotone pieces, then triangulate each piece in linear time.
+// Reference: "Computational Geometry: Algorithms and Applications" (de Berg et al.), chapter 3 "Polygon Triangulation".
+// Used by AddConcavePolyFilled() for large polygons (see IM_DRAWLIST_CONCAVE_MONOTONE_THRESHOLD), ear-clipping being faster on small ones.
+// Triangulate() returns false on inconsistent input (e.g. self-intersecting polygon): caller is expected to fallback to ImTriangulator.
+enum ImTriangulatorMonotoneVtxType
 {
-    if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
-        return;
+    ImTriangulatorMonotoneVtxType_Start,
+    ImTriangulatorMonotoneVtxType_End,
+    ImTriangulatorMonotoneVtxType_Split,
+    ImTriangulatorMonotoneVtxType_Merge,
+    ImTriangulatorMonotoneVtxType_RegularLeft,      // Interior is on the right of vertex
+    ImTriangulatorMonotoneVtxType_RegularRight,     // Interior is on the left of vertex
+};
 
-    const ImVec2 uv = _Data->TexUvWhitePixel;
-    ImTriangulator triangulator;
-    unsigned int triangle[3];
-    if (Flags & ImDrawListFlags_AntiAliasedFill)
+struct ImTriangulatorMonotoneEvent
+{
+    ImVec2  Pos;
+    int     Index;
+};
+
+struct ImTriangulatorMonotone
+{
+    static int EstimateTriangleCount(int points_count)      { return (points_count < 3) ? 0 : points_count - 2; }
+    static int EstimateScratchBufferSize(int points_count)  { return (sizeof(ImVec2) + sizeof(ImTriangulatorMonotoneEvent) + sizeof(int) * 22) * points_count; }
+
+    bool    Triangulate(const ImVec2* points, int points_count, void* scratch_buffer); // Output EstimateTriangleCount() triangles into _Triangles[]
+
+    // Internal functions
+    static bool     IsAbove(const ImVec2& a, int a_idx, const ImVec2& b, int b_idx) { return a.y > b.y || (a.y == b.y && (a.x < b.x || (a.x == b.x && a_idx < b_idx))); }
+    static float    Cross(const ImVec2& a, const ImVec2& b)                         { return a.x * b.y - a.y * b.x; }
+    bool    IsAbove(int a, int b) const { return IsAbove(_Pos[a], a, _Pos[b], b); }
+    float   GetEdgeX(int edge, const ImVec2& p) const;
+    int     FindEdgeLeftOf(const ImVec2& p) const;
+    int     FindEdgeInStatus(int edge, const ImVec2& p) const;
+    void    InsertEdgeInStatus(int pos, int edge);
+    void    RemoveEdgeFromStatus(int pos);
+    int     FindFaceEdge(int vtx, const ImVec2& dir) const;
+    bool    AddDiagonal(int a, int b);
+    bool    TriangulateMonotoneFace(int face_size);
+
+    // Internal members
+    int                             _PointsCount = 0;
+    int                             _DiagonalsCount = 0;
+    int                             _StatusCount = 0;
+    int                             _TrianglesCount = 0;
+    bool                            _Reversed = false;  // Input points are clockwise (in y-up space), _Pos[] is reversed
+    ImVec2*                         _Pos = NULL;        // points_count x ImVec2, counter-clockwise order
+    ImTriangulatorMonotoneEvent*    _Events = NULL;     // points_count x Event, sorted top to bottom
+    int*                            _Types = NULL;      // points_count x ImTriangulatorMonotoneVtxType
+    int*                            _Helpers = NULL;    // points_count x int, helper vertex of each edge (edge N goes from vertex N to N+1)
+    int*                            _Status = NULL;     // points_count x int, edges crossing the sweep line with interior on their right, sorted left to right
+    int*                            _EdgeOrigin = NULL; // points_count x 3 x int, half-edges: polygon edges followed by diagonals pairs
+    int*                            _EdgeNext = NULL;   // points_count x 3 x int
+    int*                            _EdgePrev = NULL;   // points_count x 3 x int
+    int*                            _EdgeVisited = NULL;// points_count x 3 x int
+    int*                            _Face = NULL;       // points_count x int, vertices of current face
+    int*                            _FaceSorted = NULL; // points_count x int, vertices of current face sorted top to bottom
+    int*                            _FaceChain = NULL;  // points_count x int, chain of sorted vertices (0: left, 1: right)
+    int*                            _Stack = NULL;      // points_count x int
+    unsigned int*                   _Triangles = NULL;  // points_count x 3 x unsigned int, relative indexes
+};
+
+static int IMGUI_CDECL TriangulatorMonotoneEventCompare(const void* lhs, const void* rhs)
+{
+    const ImTriangulatorMonotoneEvent* a = (const ImTriangulatorMonotoneEvent*)lhs;
+    const ImTriangulatorMonotoneEvent* b = (const ImTriangulatorMonotoneEvent*)rhs;
+    return ImTriangulatorMonotone::IsAbove(a->Pos, a->Index, b->Pos, b->Index) ? -1 : (a->Index == b->Index) ? 0 : +1;
+}
+
+// Distribute storage, sort vertices, then sweep from top to bottom adding diagonals to remove split and merge vertices.
+bool ImTriangulatorMonotone::Triangulate(const ImVec2* points, int points_count, void* scratch_buffer)
+{
+    IM_ASSERT(scratch_buffer != NULL && points_count >= 3);
+    const int n = points_count;
+    _PointsCount = n;
+    _DiagonalsCount = _StatusCount = _TrianglesCount = 0;
+    _Pos         = (ImVec2*)scratch_buffer;
+    _Events      = (ImTriangulatorMonotoneEvent*)(_Pos + n);
+    _Types       = (int*)(_Events + n);
+    _Helpers     = _Types + n;
+    _Status      = _Helpers + n;
+    _EdgeOrigin  = _Status + n;
+    _EdgeNext    = _EdgeOrigin + n * 3;
+    _EdgePrev    = _EdgeNext + n * 3;
+    _EdgeVisited = _EdgePrev + n * 3;
+    _Face        = _EdgeVisited + n * 3;
+    _FaceSorted  = _Face + n;
+    _FaceChain   = _FaceSorted + n;
+    _Stack       = _FaceChain + n;
+    _Triangles   = (unsigned int*)(_Stack + n);
+
+    // Work on counter-clockwise points
+    float area = 0.0f;
+    for (int i = 1; i + 1 < n; i++)
+        area += Cross(points[i] - points[0], points[i + 1] - points[0]);
+    if (area == 0.0f)
+        return false;
+    _Reversed = (area < 0.0f);
+    for (int i = 0; i < n; i++)
     {
-        // Anti-aliased Fill
-        const float AA_SIZE = _FringeScale;
-        const ImU32 col_trans = col & ~IM_COL32_A_MASK;
-        const int idx_count = (points_count - 2) * 3 + points_count * 6;
-        const int vtx_count = (points_count * 2);
-        PrimReserve(idx_count, vtx_count);
+        _Pos[i] = points[_Reversed ? n - 1 - i : i];
+        _Events[i].Pos = _Pos[i];
+        _Events[i].Index = i;
+        _EdgeOrigin[i] = i;
+        _EdgeNext[i] = (i + 1 == n) ? 0 : i + 1;
+        _EdgePrev[i] = (i == 0) ? n - 1 : i - 1;
+    }
+    ImQsort(_Events, (size_t)n, sizeof(ImTriangulatorMonotoneEvent), TriangulatorMonotoneEventCompare);
 
-        // Add indexes for fill
-        unsigned int vtx_inner_idx = _VtxCurrentIdx;
-        unsigned int vtx_outer_idx = _VtxCurrentIdx + 1;
+    // Classify vertices
+    for (int i0 = n - 1, i1 = 0; i1 < n; i0 = i1++)
+    {
+        const int i2 = (i1 + 1 == n) ? 0 : i1 + 1;
+        const bool prev_below = IsAbove(i1, i0);
+        const bool next_below = IsAbove(i1, i2);
+        const bool convex = Cross(_Pos[i1] - _Pos[i0], _Pos[i2] - _Pos[i1]) > 0.0f;
+        if (prev_below && next_below)
+            _Types[i1] = convex ? ImTriangulatorMonotoneVtxType_Start : ImTriangulatorMonotoneVtxType_Split;
+        else if (!prev_below && !next_below)
+            _Types[i1] = convex ? ImTriangulatorMonotoneVtxType_End : ImTriangulatorMonotoneVtxType_Merge;
+        else
+            _Types[i1] = prev_below ? ImTriangulatorMonotoneVtxType_RegularRight : ImTriangulatorMonotoneVtxType_RegularLeft;
+    }
 
-        _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
-        while (triangulator._TrianglesLeft > 0)
+    // Sweep
+    for (int event_n = 0; event_n < n; event_n++)
+    {
+        const int vtx = _Events[event_n].Index;
+        const int edge_prev = (vtx == 0) ? n - 1 : vtx - 1;
+        const ImVec2 p = _Pos[vtx];
+        const int type = _Types[vtx];
+        if (type == ImTriangulatorMonotoneVtxType_End || type == ImTriangulatorMonotoneVtxType_Merge || type == ImTriangulatorMonotoneVtxType_RegularLeft)
         {
-            triangulator.GetNextTriangle(triangle);
-            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (triangle[0] << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (triangle[1] << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_inner_idx + (triangle[2] << 1));
-            _IdxWritePtr += 3;
+            // Previous edge ends here
+            const int status_pos = FindEdgeInStatus(edge_prev, p);
+            if (status_pos < 0)
+                return false;
+            if (_Types[_Helpers[edge_prev]] == ImTriangulatorMonotoneVtxType_Merge && !AddDiagonal(vtx, _Helpers[edge_prev]))
+                return false;
+            if (type == ImTriangulatorMonotoneVtxType_RegularLeft)
+            {
+                _Status[status_pos] = vtx; // Next edge takes its place
+                _Helpers[vtx] = vtx;
+                continue;
+            }
+            RemoveEdgeFromStatus(status_pos);
         }
+        if (type == ImTriangulatorMonotoneVtxType_End)
+            continue;
 
-        // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
-        ImVec2* temp_normals = _Data->TempBuffer.Data;
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        const int left_pos = FindEdgeLeftOf(p);
+        if (type == ImTriangulatorMonotoneVtxType_Start)
         {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
+            InsertEdgeInStatus(left_pos + 1, vtx);
+            _Helpers[vtx] = vtx;
+            continue;
         }
 
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        // Split, Merge, RegularRight: connect to helper of edge on the left
+        if (left_pos < 0)
+            return false;
+        const int left_edge = _Status[left_pos];
+        if ((type == ImTriangulatorMonotoneVtxType_Split || _Types[_Helpers[left_edge]] == ImTriangulatorMonotoneVtxType_Merge) && !AddDiagonal(vtx, _Helpers[left_edge]))
+            return false;
+        _Helpers[left_edge] = vtx;
+        if (type == ImTriangulatorMonotoneVtxType_Split)
         {
-            // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
-
-            // Add vertices
-            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
-            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
-            _VtxWritePtr += 2;
-
-            // Add indexes for fringes
-            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
-            _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
-            _IdxWritePtr += 6;
+            InsertEdgeInStatus(left_pos + 1, vtx);
+            _Helpers[vtx] = vtx;
         }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
-    else
+
+    // Walk faces and triangulate them
+    const int edges_count = n + _DiagonalsCount * 2;
+    memset(_EdgeVisited, 0, sizeof(int) * edges_count);
+    for (int edge_start = 0; edge_start < edges_count; edge_start++)
     {
-        // Non Anti-aliased Fill
-        const int idx_count = (points_count - 2) * 3;
-        const int vtx_count = points_count;
-        PrimReserve(idx_count, vtx_count);
-        for (int i = 0; i < vtx_count; i++)
-        {
-            _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
-            _VtxWritePtr++;
-        }
-        _Data->TempBuffer.reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
-        triangulator.Init(points, points_count, _Data->TempBuffer.Data);
-        while (triangulator._TrianglesLeft > 0)
+        if (_EdgeVisited[edge_start])
+            continue;
+        int face_size = 0;
+        int edge = edge_start;
+        do
         {
-            triangulator.GetNextTriangle(triangle);
-            _IdxWritePtr[0] = (ImDrawIdx)(_VtxCurrentIdx + triangle[0]); _IdxWritePtr[1] = (ImDrawIdx)(_VtxCurrentIdx + triangle[1]); _IdxWritePtr[2] = (ImDrawIdx)(_VtxCurrentIdx + triangle[2]);
-            _IdxWritePtr += 3;
+            if (_EdgeVisited[edge] || face_size == n)
+                return false;
+            _EdgeVisited[edge] = 1;
+            _Face[face_size++] = _EdgeOrigin[edge];
+            edge = _EdgeNext[edge];
         }
-        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+        while (edge != edge_start);
+        if (face_size < 3 || !TriangulateMonotoneFace(face_size))
+            return false;
     }
+    if (_TrianglesCount != EstimateTriangleCount(n))
+        return false;
+
+    if (_Reversed)
+        for (int i = 0; i < _TrianglesCount * 3; i++)
+            _Triangles[i] = (unsigned int)(n - 1) - _Triangles[i];
+    return true;
 }
 
-//-----------------------------------------------------------------------------
-// [SECTION] ImDrawListSplitter
-//-----------------------------------------------------------------------------
-// FIXME: This may be a little confusing, trying to be a little too low-level/optimal instead of just doing vector swap..
-//-----------------------------------------------------------------------------
+// X coordinate where an edge crosses the sweep line passing through 'p'.
+float ImTriangulatorMonotone::GetEdgeX(int edge, const ImVec2& p) const
+{
+    const ImVec2& a = _Pos[edge];
+    const ImVec2& b = _Pos[(edge + 1 == _PointsCount) ? 0 : edge + 1];
+    if (a.y == b.y)
+        return ImClamp(p.x, ImMin(a.x, b.x), ImMax(a.x, b.x));
+    return a.x + (b.x - a.x) * ImSaturate((p.y - a.y) / (b.y - a.y));
+}
 
-void ImDrawListSplitter::ClearFreeMemory()
+// Return position in status of the nearest edge on the left of 'p', or -1.
+int ImTriangulatorMonotone::FindEdgeLeftOf(const ImVec2& p) const
 {
-    for (int i = 0; i < _Channels.Size; i++)
+    int lo = 0, hi = _StatusCount;
+    while (lo < hi)
     {
-        if (i == _Current)
-            memset(&_Channels[i], 0, sizeof(_Channels[i]));  // Current channel is a copy of CmdBuffer/IdxBuffer, don't destruct again
-        _Channels[i]._CmdBuffer.clear();
-        _Channels[i]._IdxBuffer.clear();
+        const int mid = (lo + hi) >> 1;
+        if (GetEdgeX(_Status[mid], p) <= p.x)
+            lo = mid + 1;
+        else
+            hi = mid;
     }
-    _Current = 0;
-    _Count = 1;
-    _Channels.clear();
+    return lo - 1;
 }
 
-void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
+// Return position in status of an edge ending at 'p', or -1.
+int ImTriangulatorMonotone::FindEdgeInStatus(int edge, const ImVec2& p) const
 {
-    IM_UNUSED(draw_list);
-    IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
-    int old_channels_count = _Channels.Size;
-    if (old_channels_count < channels_count)
-    {
-        _Channels.reserve(channels_count); // Avoid over reserving since this is likely to stay stable
-        _Channels.resize(channels_count);
-    }
-    _Count = channels_count;
+    for (int n = FindEdgeLeftOf(p); n >= 0 && GetEdgeX(_Status[n], p) == p.x; n--)
+        if (_Status[n] == edge)
+            return n;
+    for (int n = 0; n < _StatusCount; n++) // Slow path for degenerate input
+        if (_Status[n] == edge)
+            return n;
+    return -1;
+}
 
-    // Channels[] (24/32 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer
-    // The content of Channels[0] at this point doesn't matter. We clear it to make state tidy in a debugger but we don't strictly need to.
-    // When we switch to the next channel, we'll copy draw_list->_CmdBuffer/_IdxBuffer into Channels[0] and then Channels[1] into draw_list->CmdBuffer/_IdxBuffer
-    memset(&_Channels[0], 0, sizeof(ImDrawChannel));
+void ImTriangulatorMonotone::InsertEdgeInStatus(int pos, int edge)
+{
+    if (pos < _StatusCount)
+        memmove(_Status + pos + 1, _Status + pos, (size_t)(_StatusCount - pos) * sizeof(int));
+    _Status[pos] = edge;
+    _StatusCount++;
+}
+
+void ImTriangulatorMonotone::RemoveEdgeFromStatus(int pos)
+{
+    _StatusCount--;
+    if (pos < _StatusCount)
+        memmove(_Status + pos, _Status + pos + 1, (size_t)(_StatusCount - pos) * sizeof(int));
+}
+
+// Find half-edge leaving 'vtx' in the face containing direction 'dir'.
+// Faces are counter-clockwise: at 'vtx', face of outgoing half-edge covers the angle from it counter-clockwise to its incoming half-edge.
+int ImTriangulatorMonotone::FindFaceEdge(int vtx, const ImVec2& dir) const
+{
+    const ImVec2 p = _Pos[vtx];
+    int edge_out = vtx;
+    for (int guard = 0; guard <= _DiagonalsCount; guard++)
+    {
+        const int edge_in = _EdgePrev[edge_out];
+        const ImVec2 u = _Pos[_EdgeOrigin[_EdgeNext[edge_out]]] - p;
+        const ImVec2 w = _Pos[_EdgeOrigin[edge_in]] - p;
+        const float uw = Cross(u, w), ud = Cross(u, dir), dw = Cross(dir, w);
+        if ((uw > 0.0f) ? (ud > 0.0f && dw > 0.0f) : (ud > 0.0f || dw > 0.0f))
+            return edge_out;
+        if (edge_in < _PointsCount)
+            return -1;
+        edge_out = _PointsCount + ((edge_in - _PointsCount) ^ 1); // Twin of incoming diagonal
+    }
+    return -1;
+}
+
+// Split the face shared by both vertices with a pair of half-edges.
+bool ImTriangulatorMonotone::AddDiagonal(int a, int b)
+{
+    if (a == b || _DiagonalsCount + 3 > _PointsCount)
+        return false;
+    const int edge_a = FindFaceEdge(a, _Pos[b] - _Pos[a]);
+    const int edge_b = FindFaceEdge(b, _Pos[a] - _Pos[b]);
+    if (edge_a < 0 || edge_b < 0)
+        return false;
+    const int edge_ab = _PointsCount + _DiagonalsCount * 2;
+    const int edge_ba = edge_ab + 1;
+    const int edge_prev_a = _EdgePrev[edge_a];
+    const int edge_prev_b = _EdgePrev[edge_b];
+    _EdgeOrigin[edge_ab] = a;
+    _EdgeOrigin[edge_ba] = b;
+    _EdgeNext[edge_prev_a] = edge_ab; _EdgePrev[edge_ab] = edge_prev_a; _EdgeNext[edge_ab] = edge_b; _EdgePrev[edge_b] = edge_ab;
+    _EdgeNext[edge_prev_b] = edge_ba; _EdgePrev[edge_ba] = edge_prev_b; _EdgeNext[edge_ba] = edge_a; _EdgePrev[edge_a] = edge_ba;
+    _DiagonalsCount++;
+    return true;
+}
+
+// Triangulate a y-monotone counter-clockwise face stored in _Face[], in linear time.
+bool ImTriangulatorMonotone::TriangulateMonotoneFace(int face_size)
+{
+    if (_TrianglesCount + face_size - 2 > EstimateTriangleCount(_PointsCount))
+        return false;
+
+    // Left chain goes from top to bottom vertex, right chain goes from bottom to top vertex.
+    int top = 0, bottom = 0;
+    for (int n = 1; n < face_size; n++)
+    {
+        if (IsAbove(_Face[n], _Face[top]))
+            top = n;
+        if (IsAbove(_Face[bottom], _Face[n]))
+            bottom = n;
+    }
+
+    // Merge chains into a list sorted top to bottom. Fail if a chain is not monotone.
+    int left_count = bottom - top - 1;
+    if (left_count < 0)
+        left_count += face_size;
+    int right_count = face_size - 2 - left_count;
+    int l = (top + 1 == face_size) ? 0 : top + 1;
+    int r = (top == 0) ? face_size - 1 : top - 1;
+    _FaceSorted[0] = _Face[top];
+    _FaceChain[0] = 0;
+    for (int n = 1; n < face_size - 1; n++)
+    {
+        const bool use_left = left_count > 0 && (right_count == 0 || IsAbove(_Face[l], _Face[r]));
+        _FaceSorted[n] = use_left ? _Face[l] : _Face[r];
+        _FaceChain[n] = use_left ? 0 : 1;
+        if (use_left) { l = (l + 1 == face_size) ? 0 : l + 1; left_count--; }
+        else          { r = (r == 0) ? face_size - 1 : r - 1; right_count--; }
+        if (!IsAbove(_FaceSorted[n - 1], _FaceSorted[n]))
+            return false;
+    }
+    _FaceSorted[face_size - 1] = _Face[bottom];
+    _FaceChain[face_size - 1] = 0;
+
+    // Stack holds positions in _FaceSorted[] of vertices which still need to be triangulated
+    unsigned int* out = _Triangles + _TrianglesCount * 3;
+    int stack_size = 0;
+    _Stack[stack_size++] = 0;
+    _Stack[stack_size++] = 1;
+    for (int j = 2; j < face_size - 1; j++)
+    {
+        const int vtx = _FaceSorted[j];
+        if (_FaceChain[j] != _FaceChain[_Stack[stack_size - 1]])
+        {
+            // Opposite chain: connect to all stacked vertices
+            for (int n = 0; n + 1 < stack_size; n++)
+            {
+                out[0] = (unsigned int)vtx; out[1] = (unsigned int)_FaceSorted[_Stack[n]]; out[2] = (unsigned int)_FaceSorted[_Stack[n + 1]];
+                out += 3;
+            }
+            stack_size = 0;
+            _Stack[stack_size++] = j - 1;
+            _Stack[stack_size++] = j;
+        }
+        else
+        {
+            // Same chain: connect to stacked vertices as long as diagonals are inside
+            int last = _Stack[--stack_size];
+            while (stack_size > 0)
+            {
+                const int prev = _Stack[stack_size - 1];
+                const float cross = Cross(_Pos[_FaceSorted[last]] - _Pos[vtx], _Pos[_FaceSorted[prev]] - _Pos[vtx]);
+                if (_FaceChain[j] == 0 ? (cross >= 0.0f) : (cross <= 0.0f))
+                    break;
+                out[0] = (unsigned int)vtx; out[1] = (unsigned int)_FaceSorted[last]; out[2] = (unsigned int)_FaceSorted[prev];
+                out += 3;
+                last = _Stack[--stack_size];
+            }
+            _Stack[stack_size++] = last;
+            _Stack[stack_size++] = j;
+        }
+    }
+
+    // Bottom vertex: connect to all stacked vertices
+    const int vtx = _FaceSorted[face_size - 1];
+    for (int n = 0; n + 1 < stack_size; n++)
+    {
+        out[0] = (unsigned int)vtx; out[1] = (unsigned int)_FaceSorted[_Stack[n]]; out[2] = (unsigned int)_FaceSorted[_Stack[n + 1]];
+        out += 3;
+    }
+    _TrianglesCount = (int)(out - _Triangles) / 3;
+    return true;
+}
+
+// Output 'points_count - 2' triangles as indexes 'idx_base + (relative_index << idx_shift)'.
+static void TriangulateConcavePoly(ImVector<ImVec2>* temp_buffer, const ImVec2* points, int points_count, ImDrawIdx* out_idx, unsigned int idx_base, unsigned int idx_shift)
+{
+    if (points_count >= IM_DRAWLIST_CONCAVE_MONOTONE_THRESHOLD)
+    {
+        ImTriangulatorMonotone triangulator;
+        temp_buffer->reserve_discard((ImTriangulatorMonotone::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
+        if (triangulator.Triangulate(points, points_count, temp_buffer->Data))
+        {
+            const unsigned int* triangle = triangulator._Triangles;
+            for (int n = triangulator._TrianglesCount; n > 0; n--, triangle += 3, out_idx += 3)
+            {
+                out_idx[0] = (ImDrawIdx)(idx_base + (triangle[0] << idx_shift)); out_idx[1] = (ImDrawIdx)(idx_base + (triangle[1] << idx_shift)); out_idx[2] = (ImDrawIdx)(idx_base + (triangle[2] << idx_shift));
+            }
+            return;
+        }
+    }
+
+    // Small or degenerate polygon: ear-clipping
+    ImTriangulator triangulator;
+    unsigned int triangle[3];
+    temp_buffer->reserve_discard((ImTriangulator::EstimateScratchBufferSize(points_count) + sizeof(ImVec2)) / sizeof(ImVec2));
+    triangulator.Init(points, points_count, temp_buffer->Data);
+    while (triangulator._TrianglesLeft > 0)
+    {
+        triangulator.GetNextTriangle(triangle);
+        out_idx[0] = (ImDrawIdx)(idx_base + (triangle[0] << idx_shift)); out_idx[1] = (ImDrawIdx)(idx_base + (triangle[1] << idx_shift)); out_idx[2] = (ImDrawIdx)(idx_base + (triangle[2] << idx_shift));
+        out_idx += 3;
+    }
+}
+
+// Triangulate a simple polygon (no self-interaction, no holes), using ear-clipping or sweep-line algorithm depending on points count.
+// (Reminder: we don't perform any coarse clipping/culling in ImDrawList layer!
+// It is up to caller to ensure not making costly calls that will be outside of visible area.
+// As concave fill is noticeably more expensive than other primitives, be mindful of this...
+// Caller can build AABB of points, and avoid filling if 'draw_list->_CmdHeader.ClipRect.Overlays(points_bb) == false')
+void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_count, ImU32 col)
+{
+    if (points_count < 3 || (col & IM_COL32_A_MASK) == 0)
+        return;
+    if ((Flags & ImDrawListFlags_CullPrimitives) && _CullPoints(points, points_count, IM_DRAWLIST_CULL_PAD_FILL))
+        return;
+    if (_TransformStack.Size > 0)
+        points = _TransformPoints(points, points_count);
+
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    if (Flags & ImDrawListFlags_AntiAliasedFill)
+    {
+        // Anti-aliased Fill
+        const float AA_SIZE = _FringeScale;
+        const ImU32 col_trans = col & ~IM_COL32_A_MASK;
+        const int idx_count = (points_count - 2) * 3 + points_count * 6;
+        const int vtx_count = (points_count * 2);
+        PrimReserve(idx_count, vtx_count);
+
+        // Add indexes for fill
+        unsigned int vtx_inner_idx = _VtxCurrentIdx;
+        unsigned int vtx_outer_idx = _VtxCurrentIdx + 1;
+
+        TriangulateConcavePoly(&_TempBuffer, points, points_count, _IdxWritePtr, vtx_inner_idx, 1);
+        _IdxWritePtr += (points_count - 2) * 3;
+
+        // Compute normals
+        _TempBuffer.reserve_discard(points_count);
+        ImVec2* temp_normals = _TempBuffer.Data;
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            const ImVec2& p0 = points[i0];
+            const ImVec2& p1 = points[i1];
+            float dx = p1.x - p0.x;
+            float dy = p1.y - p0.y;
+            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+            temp_normals[i0].x = dy;
+            temp_normals[i0].y = -dx;
+        }
+
+        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
+        {
+            // Average normals
+            const ImVec2& n0 = temp_normals[i0];
+            const ImVec2& n1 = temp_normals[i1];
+            float dm_x = (n0.x + n1.x) * 0.5f;
+            float dm_y = (n0.y + n1.y) * 0.5f;
+            IM_FIXNORMAL2F(dm_x, dm_y);
+            dm_x *= AA_SIZE * 0.5f;
+            dm_y *= AA_SIZE * 0.5f;
+
+            // Add vertices
+            _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
+            _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
+            _VtxWritePtr += 2;
+
+            // Add indexes for fringes
+            _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
+            _IdxWritePtr[3] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1)); _IdxWritePtr[4] = (ImDrawIdx)(vtx_outer_idx + (i1 << 1)); _IdxWritePtr[5] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1));
+            _IdxWritePtr += 6;
+        }
+        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+    }
+    else
+    {
+        // Non Anti-aliased Fill
+        const int idx_count = (points_count - 2) * 3;
+        const int vtx_count = points_count;
+        PrimReserve(idx_count, vtx_count);
+        for (int i = 0; i < vtx_count; i++)
+        {
+            _VtxWritePtr[0].pos = points[i]; _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;
+            _VtxWritePtr++;
+        }
+        TriangulateConcavePoly(&_TempBuffer, points, points_count, _IdxWritePtr, _VtxCurrentIdx, 0);
+        _IdxWritePtr += idx_count;
+        _VtxCurrentIdx += (ImDrawIdx)vtx_count;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawListSplitter
+//-----------------------------------------------------------------------------
+// FIXME: This may be a little confusing, trying to be a little too low-level/optimal instead of just doing vector swap..
+//-----------------------------------------------------------------------------
+
+void ImDrawListSplitter::ClearFreeMemory()
+{
+    for (int i = 0; i < _Channels.Size; i++)
+    {
+        if (i == _Current)
+            memset(&_Channels[i], 0, sizeof(_Channels[i]));  // Current channel is a copy of CmdBuffer/IdxBuffer, don't destruct again
+        _Channels[i]._CmdBuffer.clear();
+        _Channels[i]._IdxBuffer.clear();
+    }
+    _Current = 0;
+    _Count = 1;
+    _Channels.clear();
+}
+
+void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
+{
+    IM_ASSERT(_Current == 0 && _Count <= 1 && "Nested channel splitting is not supported. Please use separate instances of ImDrawListSplitter.");
+    int old_channels_count = _Channels.Size;
+    if (old_channels_count < channels_count)
+    {
+        _Channels.reserve(channels_count); // Avoid over reserving since this is likely to stay stable
+        _Channels.resize(channels_count);
+    }
+    _Count = channels_count;
+
+    // Channels[] (24/32 bytes each) hold storage that we'll swap with draw_list->_CmdBuffer/_IdxBuffer
+    // The content of Channels[0] at this point doesn't matter. We clear it to make state tidy in a debugger but we don't strictly need to.
+    // When we switch to the next channel, we'll copy draw_list->_CmdBuffer/_IdxBuffer into Channels[0] and then Channels[1] into draw_list->CmdBuffer/_IdxBuffer
+    memset(&_Channels[0], 0, sizeof(ImDrawChannel));
     for (int i = 1; i < channels_count; i++)
     {
         if (i >= old_channels_count)
@@ -2067,6 +3513,12 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
         }
         else
         {
+            // Buffers allocated from the frame arena by a previous frame can't be reused (see ImDrawListFrameArena)
+            if (ImDrawListFrameArena* arena = draw_list->_FrameArena)
+            {
+                ImDrawListResetFromArena(arena, _Channels[i]._CmdBuffer);
+                ImDrawListResetFromArena(arena, _Channels[i]._IdxBuffer);
+            }
             _Channels[i]._CmdBuffer.resize(0);
             _Channels[i]._IdxBuffer.resize(0);
         }
@@ -2090,18 +3542,20 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
+        if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().RectCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
             ch._CmdBuffer.pop_back();
 
         if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
         {
             // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
             // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
+            // Rectangle instances are shared by all channels, so commands using them can only be merged when instances are contiguous.
             ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
+            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL && ((last_cmd->RectCount == 0 && next_cmd->RectCount == 0) || ImDrawCmd_AreSequentialRects(last_cmd, next_cmd)))
             {
                 // Merge previous channel last draw command with current channel first draw command if matching.
                 last_cmd->ElemCount += next_cmd->ElemCount;
+                last_cmd->RectCount += next_cmd->RectCount;
                 idx_offset += next_cmd->ElemCount;
                 ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
             }
@@ -2116,17 +3570,38 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
             idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
         }
     }
+    ImDrawListGrowFromArena(draw_list->_FrameArena, draw_list->CmdBuffer, draw_list->CmdBuffer.Size + new_cmd_buffer_count);
+    ImDrawListGrowFromArena(draw_list->_FrameArena, draw_list->IdxBuffer, draw_list->IdxBuffer.Size + new_idx_buffer_count);
     draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
     draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
 
     // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
+    // With ImDrawListFlags_AllowIdxSegments, large index buffers are not copied: they are swapped with an unused draw_list->IdxSegments[] entry,
+    // leaving their range of draw_list->IdxBuffer[] undefined. The channel gets the segment allocation from a previous frame, to reuse next time.
+    // Segments are only created when merging into the channel 0 buffer of every enclosing splitter (e.g. not for a table nested in a column of another table):
+    // IdxSegments[] is shared by all channels, and IdxOffset values are relative to that buffer.
+    IM_ASSERT(draw_list->_SplitterChannelDepth >= 0);
+    const bool allow_idx_segments = (draw_list->Flags & ImDrawListFlags_AllowIdxSegments) != 0 && draw_list->_SplitterChannelDepth == 0;
     ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
     ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
         if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
-        if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
+        if (int sz = ch._IdxBuffer.Size)
+        {
+            if (allow_idx_segments && sz >= IM_DRAWLIST_IDX_SEGMENT_MIN)
+            {
+                ImDrawIdxSegment* segment = draw_list->_AddIdxSegment();
+                segment->IdxOffset = (unsigned int)(idx_write - draw_list->IdxBuffer.Data);
+                segment->IdxBuffer.swap(ch._IdxBuffer);
+            }
+            else
+            {
+                memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx));
+            }
+            idx_write += sz;
+        }
     }
     draw_list->_IdxWritePtr = idx_write;
 
@@ -2136,7 +3611,7 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount == 0)
+    if (curr_cmd->ElemCount == 0 && curr_cmd->RectCount == 0)
         ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
@@ -2153,21 +3628,334 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
     // Overwrite ImVector (12/16 bytes), four times. This is merely a silly optimization instead of doing .swap()
     memcpy(&_Channels.Data[_Current]._CmdBuffer, &draw_list->CmdBuffer, sizeof(draw_list->CmdBuffer));
     memcpy(&_Channels.Data[_Current]._IdxBuffer, &draw_list->IdxBuffer, sizeof(draw_list->IdxBuffer));
+    if (_Current == 0 || idx == 0)
+        draw_list->_SplitterChannelDepth += (idx == 0) ? -1 : +1;
     _Current = idx;
     memcpy(&draw_list->CmdBuffer, &_Channels.Data[idx]._CmdBuffer, sizeof(draw_list->CmdBuffer));
     memcpy(&draw_list->IdxBuffer, &_Channels.Data[idx]._IdxBuffer, sizeof(draw_list->IdxBuffer));
     draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
+    draw_list->_RectMergeIdxEnd = (unsigned int)-1;
 
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = (draw_list->CmdBuffer.Size == 0) ? NULL : &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
     if (curr_cmd == NULL)
         draw_list->AddDrawCmd();
-    else if (curr_cmd->ElemCount == 0)
+    else if (curr_cmd->ElemCount == 0 && curr_cmd->RectCount == 0)
         ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImDrawList recording
+//-----------------------------------------------------------------------------
+
+void ImDrawList::RecordBegin(ImDrawListRecording* recording)
+{
+    IM_ASSERT(recording->_CmdStart == -1 && "Called RecordBegin() twice on a same recording!");
+    IM_ASSERT(IdxSize == sizeof(ImDrawIdx));
+    recording->_CmdStart = CmdBuffer.Size - 1;
+    recording->_IdxStart = IdxBuffer.Size;
+    recording->_VtxStart = VtxBuffer.Size;
+    recording->_RectStart = RectBuffer.Size;
+    recording->ClipRect = _CmdHeader.ClipRect;
+}
+
+// Copy vertices/indices/commands emitted since RecordBegin().
+// Indices are rebased to be relative to the first recorded vertex, so the recording doesn't depend on VtxOffset.
+void ImDrawList::RecordEnd(ImDrawListRecording* recording)
+{
+    IM_ASSERT(recording->_CmdStart != -1 && "Called RecordEnd() without RecordBegin()!");
+    IM_ASSERT(recording->_IdxStart <= IdxBuffer.Size && recording->_VtxStart <= VtxBuffer.Size && recording->_RectStart <= RectBuffer.Size && "Draw list was cleared or channel was changed while recording?");
+    if (IdxSegments.Size > 0)
+        _FlattenIdxSegments(); // A splitter was merged while recording
+    recording->Clear();
+
+    const int vtx_count = VtxBuffer.Size - recording->_VtxStart;
+    IM_ASSERT((sizeof(ImDrawIdx) == 4 || vtx_count < (1 << 16)) && "Too many vertices in recording to be addressed with 16-bit indices!");
+    recording->VtxBuffer.resize(vtx_count);
+    memcpy(recording->VtxBuffer.Data, VtxBuffer.Data + recording->_VtxStart, (size_t)vtx_count * sizeof(ImDrawVert));
+    recording->IdxBuffer.resize(IdxBuffer.Size - recording->_IdxStart);
+    ImDrawIdx* idx_write = recording->IdxBuffer.Data;
+
+    // Start from the command preceding the one which was current at the time of RecordBegin():
+    // the later may have been merged back into the former by _OnChangedClipRect()/_OnChangedTextureID().
+    for (int cmd_n = ImMax(recording->_CmdStart - 1, 0); cmd_n < CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd* src_cmd = &CmdBuffer.Data[cmd_n];
+        if (src_cmd->UserCallback != NULL)
+        {
+            if (cmd_n < recording->_CmdStart)
+                continue;
+            ImDrawCmd dst_cmd = *src_cmd;
+            dst_cmd.IdxOffset = (unsigned int)(idx_write - recording->IdxBuffer.Data);
+            dst_cmd.VtxOffset = 0;
+            recording->CmdBuffer.push_back(dst_cmd);
+            continue;
+        }
+
+        // Rectangle instances are copied as-is, they don't reference vertices
+        ImDrawCmd* prev_cmd = recording->CmdBuffer.Size > 0 ? &recording->CmdBuffer.back() : NULL;
+        if (src_cmd->RectCount != 0)
+        {
+            const int rect_begin = ImMax((int)src_cmd->RectOffset, recording->_RectStart);
+            const int rect_end = (int)(src_cmd->RectOffset + src_cmd->RectCount);
+            if (rect_begin >= rect_end)
+                continue;
+            const int rect_offset = recording->RectBuffer.Size;
+            recording->RectBuffer.resize(rect_offset + rect_end - rect_begin);
+            memcpy(recording->RectBuffer.Data + rect_offset, RectBuffer.Data + rect_begin, (size_t)(rect_end - rect_begin) * sizeof(ImDrawRectInstance));
+            if (prev_cmd && prev_cmd->UserCallback == NULL && prev_cmd->RectCount != 0 && memcmp(&prev_cmd->ClipRect, &src_cmd->ClipRect, sizeof(ImVec4)) == 0 && prev_cmd->TextureId == src_cmd->TextureId)
+            {
+                prev_cmd->RectCount += rect_end - rect_begin;
+                continue;
+            }
+            ImDrawCmd dst_cmd = *src_cmd;
+            dst_cmd.IdxOffset = (unsigned int)(idx_write - recording->IdxBuffer.Data);
+            dst_cmd.ElemCount = 0;
+            dst_cmd.VtxOffset = 0;
+            dst_cmd.RectOffset = rect_offset;
+            dst_cmd.RectCount = rect_end - rect_begin;
+            recording->CmdBuffer.push_back(dst_cmd);
+            continue;
+        }
+
+        const int idx_begin = ImMax((int)src_cmd->IdxOffset, recording->_IdxStart);
+        const int idx_end = (int)(src_cmd->IdxOffset + src_cmd->ElemCount);
+        if (idx_begin >= idx_end)
+            continue;
+        const unsigned int idx_rebase = src_cmd->VtxOffset - (unsigned int)recording->_VtxStart; // Wrapping arithmetic: rebased values always fit in ImDrawIdx
+        for (int idx_n = idx_begin; idx_n < idx_end; idx_n++)
+            *idx_write++ = (ImDrawIdx)(IdxBuffer.Data[idx_n] + idx_rebase);
+
+        // Merge with previous recorded command when only VtxOffset differed
+        if (prev_cmd && prev_cmd->UserCallback == NULL && prev_cmd->RectCount == 0 && memcmp(&prev_cmd->ClipRect, &src_cmd->ClipRect, sizeof(ImVec4)) == 0 && prev_cmd->TextureId == src_cmd->TextureId)
+        {
+            prev_cmd->ElemCount += idx_end - idx_begin;
+            continue;
+        }
+        ImDrawCmd dst_cmd = *src_cmd;
+        dst_cmd.IdxOffset = (unsigned int)(idx_write - recording->IdxBuffer.Data) - (idx_end - idx_begin);
+        dst_cmd.ElemCount = idx_end - idx_begin;
+        dst_cmd.VtxOffset = 0;
+        recording->CmdBuffer.push_back(dst_cmd);
+    }
+    IM_ASSERT(idx_write == recording->IdxBuffer.Data + recording->IdxBuffer.Size);
+    recording->_CmdStart = recording->_IdxStart = recording->_VtxStart = recording->_RectStart = -1;
+}
+
+// Multiply two colors channel by channel (255 * x == x)
+static inline ImU32 ImMulColorsU32(ImU32 col_a, ImU32 col_b)
+{
+    ImU32 out = 0;
+    for (int shift = 0; shift < 32; shift += 8)
+        out |= ((((col_a >> shift) & 0xFF) * ((col_b >> shift) & 0xFF) + 127) / 255) << shift;
+    return out;
+}
+
+void ImDrawList::AddRecording(const ImDrawListRecording* recording, const ImVec2& offset, ImU32 col_mul)
+{
+    IM_ASSERT(recording->_CmdStart == -1 && "Cannot replay a recording before calling RecordEnd()!");
+    if (recording->CmdBuffer.Size == 0)
+        return;
+
+    // Copy all vertices upfront, this lets PrimReserve() change VtxOffset before we write any index
+    const int vtx_count = recording->VtxBuffer.Size;
+    if (vtx_count > 0)
+        PrimReserve(0, vtx_count);
+    const unsigned int vtx_base = _VtxCurrentIdx;
+    const ImDrawVert* vtx_read = recording->VtxBuffer.Data;
+    if (offset.x == 0.0f && offset.y == 0.0f && col_mul == IM_COL32_WHITE && _TransformStack.Size == 0)
+    {
+        memcpy(_VtxWritePtr, vtx_read, (size_t)vtx_count * sizeof(ImDrawVert));
+    }
+    else
+    {
+        for (int vtx_n = 0; vtx_n < vtx_count; vtx_n++)
+        {
+            _VtxWritePtr[vtx_n] = vtx_read[vtx_n];
+            _VtxWritePtr[vtx_n].pos.x += offset.x;
+            _VtxWritePtr[vtx_n].pos.y += offset.y;
+        }
+        if (_TransformStack.Size > 0)
+            for (int vtx_n = 0; vtx_n < vtx_count; vtx_n++)
+                _VtxWritePtr[vtx_n].pos = _Transform.Apply(_VtxWritePtr[vtx_n].pos);
+        if (col_mul != IM_COL32_WHITE)
+            for (int vtx_n = 0; vtx_n < vtx_count; vtx_n++)
+                _VtxWritePtr[vtx_n].col = ImMulColorsU32(_VtxWritePtr[vtx_n].col, col_mul);
+    }
+    _VtxWritePtr += vtx_count;
+    _VtxCurrentIdx += vtx_count;
+
+    // Replay commands. Changing _CmdHeader then calling _OnChangedXXX() merges consecutive commands with identical settings.
+    const ImVec4 base_clip_rect = _CmdHeader.ClipRect;
+    const ImTextureID base_texture_id = _CmdHeader.TextureId;
+    for (const ImDrawCmd& src_cmd : recording->CmdBuffer)
+    {
+        if (src_cmd.UserCallback != NULL)
+        {
+            AddCallback(src_cmd.UserCallback, src_cmd.UserCallbackData);
+            continue;
+        }
+
+        ImVec4 clip_rect = base_clip_rect;
+        if (memcmp(&src_cmd.ClipRect, &recording->ClipRect, sizeof(ImVec4)) != 0)
+        {
+            ImVec4 src_clip_rect(src_cmd.ClipRect.x + offset.x, src_cmd.ClipRect.y + offset.y, src_cmd.ClipRect.z + offset.x, src_cmd.ClipRect.w + offset.y);
+            if (_TransformStack.Size > 0)
+                src_clip_rect = ImDrawTransformRect(_Transform, src_clip_rect);
+            clip_rect.x = ImMax(src_clip_rect.x, base_clip_rect.x);
+            clip_rect.y = ImMax(src_clip_rect.y, base_clip_rect.y);
+            clip_rect.z = ImMax(ImMin(src_clip_rect.z, base_clip_rect.z), clip_rect.x);
+            clip_rect.w = ImMax(ImMin(src_clip_rect.w, base_clip_rect.w), clip_rect.y);
+        }
+        if (memcmp(&clip_rect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
+        {
+            _CmdHeader.ClipRect = clip_rect;
+            _OnChangedClipRect();
+        }
+        if (src_cmd.TextureId != _CmdHeader.TextureId)
+        {
+            _CmdHeader.TextureId = src_cmd.TextureId;
+            _OnChangedTextureID();
+        }
+
+        // Rectangle instances are re-submitted one by one, falling back to tessellation if this draw list cannot use them.
+        for (unsigned int rect_n = 0; rect_n < src_cmd.RectCount; rect_n++)
+        {
+            const ImDrawRectInstance& rect = recording->RectBuffer.Data[src_cmd.RectOffset + rect_n];
+            const ImVec2 rect_min = rect.Min + offset;
+            const ImVec2 rect_max = rect.Max + offset;
+            const ImU32 rect_col = (col_mul != IM_COL32_WHITE) ? ImMulColorsU32(rect.Col, col_mul) : rect.Col;
+            const ImDrawFlags rect_flags = (rect.Flags & 0x0F) ? (ImDrawFlags)((rect.Flags & 0x0F) << 4) : ImDrawFlags_RoundCornersNone;
+            if ((Flags & ImDrawListFlags_AllowRectInstances) && _TryAddRectInstance(rect_min, rect_max, rect_col, rect.Rounding, rect_flags, rect.Thickness))
+                continue;
+            if (rect.Thickness > 0.0f)
+            {
+                PathRect(rect_min, rect_max, rect.Rounding, rect_flags);
+                PathStroke(rect_col, ImDrawFlags_Closed, rect.Thickness);
+            }
+            else
+            {
+                AddRectFilled(rect_min, rect_max, rect_col, rect.Rounding, rect_flags);
+            }
+        }
+        if (src_cmd.ElemCount == 0)
+            continue;
+
+        PrimReserve((int)src_cmd.ElemCount, 0);
+        const ImDrawIdx* idx_read = recording->IdxBuffer.Data + src_cmd.IdxOffset;
+        for (unsigned int idx_n = 0; idx_n < src_cmd.ElemCount; idx_n++)
+            _IdxWritePtr[idx_n] = (ImDrawIdx)(idx_read[idx_n] + vtx_base);
+        _IdxWritePtr += src_cmd.ElemCount;
+    }
+
+    // Restore settings
+    if (memcmp(&base_clip_rect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
+    {
+        _CmdHeader.ClipRect = base_clip_rect;
+        _OnChangedClipRect();
+    }
+    if (base_texture_id != _CmdHeader.TextureId)
+    {
+        _CmdHeader.TextureId = base_texture_id;
+        _OnChangedTextureID();
+    }
+}
+
+// Append output of 'src' (typically filled on another thread, see BeginDrawListThreads()), then reset 'src'.
+// - Vertices are copied once. With ImDrawListFlags_AllowVtxOffset, commands get a new VtxOffset so indices don't need rebasing:
+//   they are copied as is, or moved into IdxSegments[] when large enough and ImDrawListFlags_AllowIdxSegments is set (same as ImDrawListSplitter::Merge()).
+// - Clipping rectangles of 'src' commands are intersected with the current clipping rectangle.
+void ImDrawList::AddDrawList(ImDrawList* src)
+{
+    IM_ASSERT(src != this);
+    IM_ASSERT(src->_Splitter._Count <= 1 && "Call ChannelsMerge() on source draw list first!");
+    IM_ASSERT(src->IdxSize == sizeof(ImDrawIdx));
+    IM_ASSERT((src->RectBuffer.Size == 0 || (Flags & ImDrawListFlags_AllowRectInstances)) && "Source draw list uses rectangle instances, which this draw list cannot use!");
+    src->_PopUnusedDrawCmd();
+    if (src->CmdBuffer.Size == 0)
+    {
+        src->_ResetForNewFrame();
+        return;
+    }
+    src->_FlattenIdxSegments();
+
+    // Remove our current command, which will be added back after commands of 'src'
+    _PopUnusedDrawCmd();
+    const bool use_vtx_offset = (Flags & ImDrawListFlags_AllowVtxOffset) != 0;
+    const unsigned int vtx_base = (unsigned int)VtxBuffer.Size;
+    const unsigned int idx_base = (unsigned int)IdxBuffer.Size;
+    const unsigned int rect_base = (unsigned int)RectBuffer.Size;
+    const int vtx_count = src->VtxBuffer.Size;
+    const int idx_count = src->IdxBuffer.Size;
+    ImDrawListGrowFromArena(_FrameArena, VtxBuffer, VtxBuffer.Size + vtx_count);
+    ImDrawListGrowFromArena(_FrameArena, IdxBuffer, IdxBuffer.Size + idx_count);
+    VtxBuffer.resize(VtxBuffer.Size + vtx_count);
+    memcpy(VtxBuffer.Data + vtx_base, src->VtxBuffer.Data, (size_t)vtx_count * sizeof(ImDrawVert));
+    if (src->RectBuffer.Size > 0)
+    {
+        RectBuffer.resize(RectBuffer.Size + src->RectBuffer.Size);
+        memcpy(RectBuffer.Data + rect_base, src->RectBuffer.Data, (size_t)src->RectBuffer.Size * sizeof(ImDrawRectInstance));
+    }
+    IdxBuffer.resize(IdxBuffer.Size + idx_count);
+    if (use_vtx_offset && (Flags & ImDrawListFlags_AllowIdxSegments) && _Splitter._Count <= 1 && idx_count >= IM_DRAWLIST_IDX_SEGMENT_MIN)
+    {
+        // Leave our range of IdxBuffer[] undefined. 'src' gets the segment allocation from a previous frame, to reuse next time.
+        ImDrawIdxSegment* segment = _AddIdxSegment();
+        segment->IdxOffset = idx_base;
+        segment->IdxBuffer.swap(src->IdxBuffer);
+    }
+    else if (use_vtx_offset)
+    {
+        memcpy(IdxBuffer.Data + idx_base, src->IdxBuffer.Data, (size_t)idx_count * sizeof(ImDrawIdx));
+    }
+    else
+    {
+        // Without ImDrawListFlags_AllowVtxOffset, indices of 'src' are rebased to address all our vertices, as PrimReserve() does.
+        IM_ASSERT((sizeof(ImDrawIdx) == 4 || _VtxCurrentIdx + (unsigned int)vtx_count <= (1 << 16)) && "Too many vertices in ImDrawList using 16-bit indices. Enable ImGuiBackendFlags_RendererHasVtxOffset or use 32-bit indices.");
+        for (const ImDrawCmd& src_cmd : src->CmdBuffer)
+        {
+            const ImDrawIdx* idx_read = src->IdxBuffer.Data + src_cmd.IdxOffset;
+            ImDrawIdx* idx_write = IdxBuffer.Data + idx_base + src_cmd.IdxOffset;
+            const unsigned int idx_add = vtx_base + src_cmd.VtxOffset;
+            for (unsigned int idx_n = 0; idx_n < src_cmd.ElemCount; idx_n++)
+                idx_write[idx_n] = (ImDrawIdx)(idx_read[idx_n] + idx_add);
+        }
+    }
+
+    const ImVec4 base_clip_rect = _CmdHeader.ClipRect;
+    ImDrawListGrowFromArena(_FrameArena, CmdBuffer, CmdBuffer.Size + src->CmdBuffer.Size + 1);
+    CmdBuffer.reserve(CmdBuffer.Size + src->CmdBuffer.Size + 1);
+    for (const ImDrawCmd& src_cmd : src->CmdBuffer)
+    {
+        ImDrawCmd cmd = src_cmd;
+        cmd.ClipRect.x = ImMax(src_cmd.ClipRect.x, base_clip_rect.x);
+        cmd.ClipRect.y = ImMax(src_cmd.ClipRect.y, base_clip_rect.y);
+        cmd.ClipRect.z = ImMax(ImMin(src_cmd.ClipRect.z, base_clip_rect.z), cmd.ClipRect.x);
+        cmd.ClipRect.w = ImMax(ImMin(src_cmd.ClipRect.w, base_clip_rect.w), cmd.ClipRect.y);
+        cmd.VtxOffset = use_vtx_offset ? vtx_base + src_cmd.VtxOffset : 0;
+        cmd.IdxOffset = idx_base + src_cmd.IdxOffset;
+        cmd.RectOffset = rect_base + src_cmd.RectOffset;
+        CmdBuffer.push_back(cmd);
+    }
+
+    // Following primitives use a new command
+    if (use_vtx_offset)
+    {
+        _CmdHeader.VtxOffset = VtxBuffer.Size;
+        _VtxCurrentIdx = 0;
+    }
+    else
+    {
+        _VtxCurrentIdx += vtx_count;
+    }
+    _VtxWritePtr = VtxBuffer.Data + VtxBuffer.Size;
+    _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+    AddDrawCmd();
+    src->_ResetForNewFrame();
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawData
 //-----------------------------------------------------------------------------
@@ -2179,6 +3967,7 @@ void ImDrawData::Clear()
     CmdLists.resize(0); // The ImDrawList are NOT owned by ImDrawData but e.g. by ImGuiContext, so we don't clear them.
     DisplayPos = DisplaySize = FramebufferScale = ImVec2(0.0f, 0.0f);
     OwnerViewport = NULL;
+    DamageRects.resize(0);
 }
 
 // Important: 'out_list' is generally going to be draw_data->CmdLists, but may be another temporary list
@@ -2187,7 +3976,7 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
 {
     if (draw_list->CmdBuffer.Size == 0)
         return;
-    if (draw_list->CmdBuffer.Size == 1 && draw_list->CmdBuffer[0].ElemCount == 0 && draw_list->CmdBuffer[0].UserCallback == NULL)
+    if (draw_list->CmdBuffer.Size == 1 && draw_list->CmdBuffer[0].ElemCount == 0 && draw_list->CmdBuffer[0].RectCount == 0 && draw_list->CmdBuffer[0].UserCallback == NULL)
         return;
 
     // Draw list sanity check. Detect mismatch between PrimReserve() calls and incrementing _VtxCurrentIdx, _VtxWritePtr etc.
@@ -2212,8 +4001,13 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
     //       2 and 4 bytes indices are generally supported by most graphics API.
     // - If for some reason neither of those solutions works for you, a workaround is to call BeginChild()/EndChild() before reaching
     //   the 64K limit to split your draw commands in multiple draw lists.
+    // - If you want large meshes but small index buffers for regular draw lists, you can handle 32-bit indices (B) as well as 16-bit indices
+    //   in your renderer backend, based on the ImDrawList::IdxSize value, and set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasPackedIdx'.
+    //   Draw lists with <= 64K vertices will then have their indices packed to 16-bit here.
     if (sizeof(ImDrawIdx) == 2)
         IM_ASSERT(draw_list->_VtxCurrentIdx < (1 << 16) && "Too many vertices in ImDrawList using 16-bit indices. Read comment above");
+    if (draw_list->Flags & ImDrawListFlags_AllowPackedIdx)
+        draw_list->_PackIdxBuffer();
 
     // Add to output list + records state in ImDrawData
     out_list->push_back(draw_list);
@@ -2229,6 +4023,392 @@ void ImDrawData::AddDrawList(ImDrawList* draw_list)
     ImGui::AddDrawListToDrawDataEx(this, &CmdLists, draw_list);
 }
 
+int ImGui::CalcDrawDataCmdCount(const ImDrawData* draw_data)
+{
+    int cmd_count = 0;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+        cmd_count += draw_list->CmdBuffer.Size;
+    return cmd_count;
+}
+
+// User callbacks receive their parent draw list, and VtxOffset != 0 means indices can't be rebased: leave those draw lists untouched.
+static bool IsDrawListMergeable(const ImDrawList* draw_list)
+{
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        if (cmd.UserCallback != NULL || cmd.VtxOffset != 0)
+            return false;
+    return true;
+}
+
+// Return true if the clip rectangle of 'cmd' has no effect on its output (all its triangles are within it). Commands drawing rectangle instances are never considered unclipped.
+static bool IsDrawCmdUnclipped(const ImDrawList* draw_list, const ImDrawCmd* cmd)
+{
+    if (cmd->RectCount != 0)
+        return false;
+    const ImVec4 clip_rect = cmd->ClipRect;
+    const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data;
+    const ImDrawIdx* idx_p = draw_list->IdxBuffer.Data + cmd->IdxOffset;
+    ImVec2 bb_min(FLT_MAX, FLT_MAX), bb_max(-FLT_MAX, -FLT_MAX);
+    for (const ImDrawIdx* idx_end = idx_p + cmd->ElemCount; idx_p < idx_end; idx_p++)
+    {
+        const ImVec2 pos = vtx_buffer[*idx_p].pos;
+        bb_min = ImMin(bb_min, pos);
+        bb_max = ImMax(bb_max, pos);
+    }
+    return bb_min.x >= clip_rect.x && bb_min.y >= clip_rect.y && bb_max.x <= clip_rect.z && bb_max.y <= clip_rect.w;
+}
+
+// Concatenate consecutive draw lists of 'draw_data' into draw lists taken from 'pool' (owned by caller), merging compatible
+// draw commands across the former list boundaries: same texture and same clip rectangle, or different clip rectangles which don't
+// clip anything (e.g. contents of non-overlapping windows), in which case the merged command uses the union of the clip rectangles.
+// - Indices are rebased, so a merged draw list never holds more vertices than ImDrawIdx can address.
+// - Runs are split by draw lists which cannot be merged. A run of a single draw list is left untouched.
+void ImGui::MergeDrawDataLists(ImDrawData* draw_data, ImVector<ImDrawList*>* pool)
+{
+    ImVector<ImDrawList*>& lists = draw_data->CmdLists;
+    const int vtx_limit = (sizeof(ImDrawIdx) == 2) ? (1 << 16) : INT_MAX;
+    int pool_used = 0;
+    int out_n = 0;
+    for (int run_begin = 0; run_begin < lists.Size; )
+    {
+        int run_end = run_begin;
+        int run_vtx_count = 0, run_idx_count = 0, run_rect_count = 0, run_cmd_count = 0;
+        while (run_end < lists.Size && IsDrawListMergeable(lists[run_end]) && run_vtx_count + lists[run_end]->VtxBuffer.Size <= vtx_limit)
+        {
+            const ImDrawList* src = lists[run_end++];
+            run_vtx_count += src->VtxBuffer.Size;
+            run_idx_count += src->IdxBuffer.Size;
+            run_rect_count += src->RectBuffer.Size;
+            run_cmd_count += src->CmdBuffer.Size;
+        }
+        if (run_end - run_begin < 2)
+        {
+            lists[out_n++] = lists[run_begin++];
+            continue;
+        }
+
+        // Output lists are recycled from one frame to another
+        if (pool_used == pool->Size)
+            pool->push_back(IM_NEW(ImDrawList)(lists[run_begin]->_Data));
+        ImDrawList* dst = (*pool)[pool_used++];
+        dst->CmdBuffer.resize(0);
+        dst->CmdBuffer.reserve(run_cmd_count);
+        dst->VtxBuffer.resize(run_vtx_count);
+        dst->IdxBuffer.resize(run_idx_count);
+        dst->RectBuffer.resize(run_rect_count);
+        dst->IdxSegments.resize(0);
+        dst->Flags = lists[run_begin]->Flags;
+        dst->IdxSize = sizeof(ImDrawIdx);
+        dst->_OwnerName = "##MergedDrawList";
+
+        unsigned int vtx_base = 0, idx_base = 0, rect_base = 0;
+        bool prev_cmd_unclipped = false;
+        for (int list_n = run_begin; list_n < run_end; list_n++)
+        {
+            const ImDrawList* src = lists[list_n];
+            memcpy(dst->VtxBuffer.Data + vtx_base, src->VtxBuffer.Data, (size_t)src->VtxBuffer.Size * sizeof(ImDrawVert));
+            if (src->RectBuffer.Size > 0)
+                memcpy(dst->RectBuffer.Data + rect_base, src->RectBuffer.Data, (size_t)src->RectBuffer.Size * sizeof(ImDrawRectInstance));
+            ImDrawIdx* dst_idx = dst->IdxBuffer.Data + idx_base;
+            if (src->IdxSize == sizeof(ImDrawIdx) && src->IdxSegments.Size == 0)
+            {
+                const ImDrawIdx* src_idx = src->IdxBuffer.Data;
+                for (int idx_n = 0; idx_n < src->IdxBuffer.Size; idx_n++)
+                    dst_idx[idx_n] = (ImDrawIdx)(src_idx[idx_n] + vtx_base);
+            }
+            else
+            {
+                for (int idx_n = 0; idx_n < src->IdxBuffer.Size; idx_n++)
+                    dst_idx[idx_n] = (ImDrawIdx)(src->_GetIdx(idx_n) + vtx_base);
+            }
+
+            for (const ImDrawCmd& src_cmd : src->CmdBuffer)
+            {
+                if (src_cmd.ElemCount == 0 && src_cmd.RectCount == 0)
+                    continue;
+                ImDrawCmd cmd = src_cmd;
+                cmd.IdxOffset += idx_base;
+                cmd.RectOffset += rect_base;
+                const bool cmd_unclipped = IsDrawCmdUnclipped(dst, &cmd);
+                ImDrawCmd* prev_cmd = dst->CmdBuffer.Size > 0 ? &dst->CmdBuffer.back() : NULL;
+                if (prev_cmd && prev_cmd->TextureId == cmd.TextureId && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, (&cmd)))
+                {
+                    // Commands whose geometry is entirely within their clip rectangle can share the union of their clip rectangles
+                    const bool same_clip_rect = memcmp(&prev_cmd->ClipRect, &cmd.ClipRect, sizeof(ImVec4)) == 0;
+                    if (same_clip_rect && ((prev_cmd->RectCount == 0 && cmd.RectCount == 0) || ImDrawCmd_AreSequentialRects(prev_cmd, (&cmd))))
+                    {
+                        prev_cmd->ElemCount += cmd.ElemCount;
+                        prev_cmd->RectCount += cmd.RectCount;
+                        prev_cmd_unclipped &= cmd_unclipped;
+                        continue;
+                    }
+                    if (!same_clip_rect && prev_cmd_unclipped && cmd_unclipped)
+                    {
+                        prev_cmd->ClipRect = ImVec4(ImMin(prev_cmd->ClipRect.x, cmd.ClipRect.x), ImMin(prev_cmd->ClipRect.y, cmd.ClipRect.y), ImMax(prev_cmd->ClipRect.z, cmd.ClipRect.z), ImMax(prev_cmd->ClipRect.w, cmd.ClipRect.w));
+                        prev_cmd->ElemCount += cmd.ElemCount;
+                        continue;
+                    }
+                }
+                dst->CmdBuffer.push_back(cmd);
+                prev_cmd_unclipped = cmd_unclipped;
+            }
+            vtx_base += (unsigned int)src->VtxBuffer.Size;
+            idx_base += (unsigned int)src->IdxBuffer.Size;
+            rect_base += (unsigned int)src->RectBuffer.Size;
+        }
+        dst->_VtxCurrentIdx = (unsigned int)dst->VtxBuffer.Size;
+        dst->_VtxWritePtr = dst->VtxBuffer.Data + dst->VtxBuffer.Size;
+        dst->_IdxWritePtr = dst->IdxBuffer.Data + dst->IdxBuffer.Size;
+        if (dst->Flags & ImDrawListFlags_AllowPackedIdx)
+            dst->_PackIdxBuffer();
+
+        lists[out_n++] = dst;
+        run_begin = run_end;
+    }
+    lists.resize(out_n);
+    draw_data->CmdListsCount = out_n;
+}
+
+// Content-defined chunking: a chunk ends after a triangle or rectangle instance whose hash has these bits cleared, so boundaries
+// only depend on contents and chunks following an insertion or a removal still match previous frame. Average chunk size is 32 elements.
+#define IM_DRAWDATA_DAMAGE_CHUNK_MASK   0x1F
+#define IM_DRAWDATA_DAMAGE_RECTS_MAX    16
+
+static inline ImU32 ImDamageHashU32(ImU32 h, ImU32 k)
+{
+    k *= 0xCC9E2D51; k = (k << 15) | (k >> 17); k *= 0x1B873593;
+    h ^= k; h = (h << 13) | (h >> 19);
+    return h * 5 + 0xE6546B64;
+}
+static inline ImU32 ImDamageHashF32(ImU32 h, float f)   { ImU32 k; memcpy(&k, &f, sizeof(k)); return ImDamageHashU32(h, k); }
+static inline ImU32 ImDamageHashFinalize(ImU32 h)       { h ^= h >> 16; h *= 0x85EBCA6B; h ^= h >> 13; return h; }
+static inline ImU32 ImDamageBitsF32(float f)            { ImU32 k; memcpy(&k, &f, sizeof(k)); return k; }
+
+// Hash the fields of a vertex explicitly: custom layouts (IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) may have uninitialized fields.
+// Fields are mixed independently then folded, to keep the dependency chain short.
+static inline ImU32 ImDamageHashVert(ImU32 h, const ImDrawVert& v)
+{
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const ImU32 k0 = ((ImU32)(ImU16)v.pos.x.Value | ((ImU32)(ImU16)v.pos.y.Value << 16)) * 0xCC9E2D51;
+    const ImU32 k1 = ((ImU32)v.uv.x.Value | ((ImU32)v.uv.y.Value << 16)) * 0x1B873593;
+    const ImU32 k2 = v.col * 0x85EBCA6B;
+    return ImDamageHashU32(h, k0 ^ ((k1 << 11) | (k1 >> 21)) ^ ((k2 << 22) | (k2 >> 10)));
+#else
+    const ImU32 k0 = ImDamageBitsF32(v.pos.x) * 0xCC9E2D51, k1 = ImDamageBitsF32(v.pos.y) * 0x1B873593;
+    const ImU32 k2 = ImDamageBitsF32(v.uv.x) * 0x85EBCA6B, k3 = ImDamageBitsF32(v.uv.y) * 0xC2B2AE35, k4 = v.col * 0x27D4EB2F;
+    return ImDamageHashU32(h, k0 ^ ((k1 << 7) | (k1 >> 25)) ^ ((k2 << 13) | (k2 >> 19)) ^ ((k3 << 19) | (k3 >> 13)) ^ ((k4 << 26) | (k4 >> 6)));
+#endif
+}
+
+// 'clip_rect' is already rounded to whole pixels and within display
+static void AddDrawDataDamageChunk(ImVector<ImDrawDataDamageChunk>* chunks, ImRect bb, const ImRect& clip_rect, ImU32 hash)
+{
+    bb.ClipWithFull(clip_rect);
+    bb.Min = ImFloor(bb.Min);
+    bb.Max = ImVec2(ImCeil(bb.Max.x), ImCeil(bb.Max.y));
+    if (bb.Min.x >= bb.Max.x || bb.Min.y >= bb.Max.y)
+        return;
+    chunks->resize(chunks->Size + 1);
+    chunks->back().Bounds = bb;
+    chunks->back().Hash = hash;
+}
+
+// Build the chunks of all commands of a draw list, in rendering order
+static void AddDrawListDamageChunks(ImVector<ImDrawDataDamageChunk>* chunks, const ImDrawList* draw_list, const ImRect& display_rect)
+{
+    const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data;
+    const bool idx_direct = (draw_list->IdxSegments.Size == 0);
+    const bool idx_16 = (draw_list->IdxSize == 2);
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        if (cmd.UserCallback == ImDrawCallback_ResetRenderState)
+            continue;
+        ImRect clip_rect(cmd.ClipRect);
+        clip_rect.ClipWithFull(display_rect);
+        clip_rect.Min = ImFloor(clip_rect.Min);
+        clip_rect.Max = ImVec2(ImCeil(clip_rect.Max.x), ImCeil(clip_rect.Max.y));
+        if (clip_rect.Min.x >= clip_rect.Max.x || clip_rect.Min.y >= clip_rect.Max.y)
+            continue;
+        if (cmd.UserCallback != NULL)
+        {
+            AddDrawDataDamageChunk(chunks, clip_rect, clip_rect, 0);
+            continue;
+        }
+        const ImU32 seed = ImHashData(&cmd.TextureId, sizeof(cmd.TextureId), ImHashData(&cmd.ClipRect, sizeof(cmd.ClipRect)));
+
+        // Triangles
+        ImU32 hash = seed;
+        ImRect bb(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+        const ImDrawVert* vtx_base = vtx_buffer + cmd.VtxOffset;
+        for (unsigned int idx_n = cmd.IdxOffset, idx_end = cmd.IdxOffset + cmd.ElemCount; idx_n < idx_end; idx_n += 3)
+        {
+            ImU32 tri_hash = 0;
+            for (unsigned int n = 0; n < 3; n++)
+            {
+                const unsigned int idx = !idx_direct ? draw_list->_GetIdx((int)(idx_n + n)) : idx_16 ? ((const ImU16*)(const void*)draw_list->IdxBuffer.Data)[idx_n + n] : (unsigned int)draw_list->IdxBuffer.Data[idx_n + n];
+                const ImDrawVert& v = vtx_base[idx];
+                const ImVec2 pos = v.pos;
+                bb.Add(pos);
+                tri_hash = ImDamageHashVert(tri_hash, v);
+            }
+            tri_hash = ImDamageHashFinalize(tri_hash);
+            hash = ImDamageHashU32(hash, tri_hash);
+            if ((tri_hash & IM_DRAWDATA_DAMAGE_CHUNK_MASK) == 0 || idx_n + 3 >= idx_end)
+            {
+                AddDrawDataDamageChunk(chunks, bb, clip_rect, hash ? hash : 1);
+                hash = seed;
+                bb = ImRect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+            }
+        }
+
+        // Rectangle instances, expanded by renderers by half their thickness + 1.0f for anti-aliasing
+        for (unsigned int rect_n = cmd.RectOffset, rect_end = cmd.RectOffset + cmd.RectCount; rect_n < rect_end; rect_n++)
+        {
+            const ImDrawRectInstance& rect = draw_list->RectBuffer.Data[rect_n];
+            const float expand = rect.Thickness * 0.5f + 1.0f;
+            bb.Add(ImRect(rect.Min.x - expand, rect.Min.y - expand, rect.Max.x + expand, rect.Max.y + expand));
+            ImU32 rect_hash = ImDamageHashF32(ImDamageHashF32(ImDamageHashF32(ImDamageHashF32(0, rect.Min.x), rect.Min.y), rect.Max.x), rect.Max.y);
+            rect_hash = ImDamageHashU32(ImDamageHashF32(ImDamageHashF32(ImDamageHashU32(rect_hash, rect.Col), rect.Rounding), rect.Thickness), rect.Flags);
+            rect_hash = ImDamageHashFinalize(rect_hash);
+            hash = ImDamageHashU32(hash, rect_hash);
+            if ((rect_hash & IM_DRAWDATA_DAMAGE_CHUNK_MASK) == 0 || rect_n + 1 >= rect_end)
+            {
+                AddDrawDataDamageChunk(chunks, bb, clip_rect, hash ? hash : 1);
+                hash = seed;
+                bb = ImRect(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+            }
+        }
+    }
+}
+
+// Merge 'r' into the damage rectangle whose area grows the least, if that doesn't add area (overlap/adjacency) or if we have too many rectangles.
+static void AddDrawDataDamageRect(ImVector<ImVec4>* out, const ImRect& r)
+{
+    int best_n = -1;
+    float best_cost = FLT_MAX;
+    for (int n = 0; n < out->Size; n++)
+    {
+        ImRect merged((*out)[n]);
+        const float area = merged.GetArea();
+        merged.Add(r);
+        const float cost = merged.GetArea() - area - r.GetArea();
+        if (cost < best_cost)
+        {
+            best_n = n;
+            best_cost = cost;
+        }
+    }
+    if (best_n != -1 && (best_cost <= 0.0f || out->Size >= IM_DRAWDATA_DAMAGE_RECTS_MAX))
+    {
+        ImRect merged((*out)[best_n]);
+        merged.Add(r);
+        (*out)[best_n] = merged.ToVec4();
+    }
+    else
+    {
+        out->push_back(r.ToVec4());
+    }
+}
+
+static int IMGUI_CDECL DrawDataDamageChunkKeyComparer(const void* lhs, const void* rhs)
+{
+    const ImU64 a = *(const ImU64*)lhs, b = *(const ImU64*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+// Compare output of 'draw_data' with the output of previous frame recorded in 'state', and store regions which changed in draw_data->DamageRects[].
+// - The output of each draw command is split into chunks of triangles/rectangle instances, with a hash of their contents and the bounding box of pixels they may touch.
+// - Chunks are matched in order with chunks of previous frame. Unmatched chunks of both frames damage their bounding box.
+//   Outside of those, pixels are touched by the same chunks in the same order, so they are unchanged.
+// - Commands with a user callback are assumed to draw within their clip rectangle, and always damage it.
+void ImGui::ComputeDrawDataDamageRects(ImDrawData* draw_data, ImDrawDataDamageState* state)
+{
+    const ImRect display_rect(draw_data->DisplayPos, draw_data->DisplayPos + draw_data->DisplaySize);
+    state->Chunks.swap(state->ChunksPrev);
+    state->Chunks.resize(0);
+    state->ChunksPrevSorted.resize(0);
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+        AddDrawListDamageChunks(&state->Chunks, draw_list, display_rect);
+
+    ImVector<ImVec4>* out = &draw_data->DamageRects;
+    out->resize(0);
+    if (!state->Valid || memcmp(&state->DisplayRect, &display_rect, sizeof(ImRect)) != 0 || memcmp(&state->FramebufferScale, &draw_data->FramebufferScale, sizeof(ImVec2)) != 0)
+    {
+        state->Valid = true;
+        state->DisplayRect = display_rect;
+        state->FramebufferScale = draw_data->FramebufferScale;
+        out->push_back(display_rect.ToVec4());
+        return;
+    }
+
+    const ImVector<ImDrawDataDamageChunk>& chunks = state->Chunks;
+    const ImVector<ImDrawDataDamageChunk>& chunks_prev = state->ChunksPrev;
+    int prev_n = 0; // Next unmatched chunk of previous frame
+    for (const ImDrawDataDamageChunk& chunk : chunks)
+    {
+        // Find the next chunk of previous frame with same hash. Generally the next one, otherwise look it up.
+        int match_n = -1;
+        if (chunk.Hash != 0 && prev_n < chunks_prev.Size && chunks_prev[prev_n].Hash == chunk.Hash)
+        {
+            match_n = prev_n;
+        }
+        else if (chunk.Hash != 0)
+        {
+            ImVector<ImU64>& sorted = state->ChunksPrevSorted;
+            if (sorted.Size == 0 && chunks_prev.Size > 0)
+            {
+                sorted.resize(chunks_prev.Size);
+                for (int n = 0; n < chunks_prev.Size; n++)
+                    sorted[n] = ((ImU64)chunks_prev[n].Hash << 32) | (ImU64)n;
+                ImQsort(sorted.Data, (size_t)sorted.Size, sizeof(ImU64), DrawDataDamageChunkKeyComparer);
+            }
+            const ImU64 key = ((ImU64)chunk.Hash << 32) | (ImU64)prev_n;
+            int lo = 0, hi = sorted.Size;
+            while (lo < hi)
+            {
+                const int mid = (lo + hi) >> 1;
+                if (sorted[mid] < key)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            if (lo < sorted.Size && (ImU32)(sorted[lo] >> 32) == chunk.Hash)
+                match_n = (int)(sorted[lo] & 0xFFFFFFFF);
+        }
+        if (match_n != -1 && memcmp(&chunks_prev[match_n].Bounds, &chunk.Bounds, sizeof(ImRect)) != 0)
+            match_n = -1;
+        if (match_n == -1)
+        {
+            AddDrawDataDamageRect(out, chunk.Bounds);
+            continue;
+        }
+        for (; prev_n < match_n; prev_n++)
+            AddDrawDataDamageRect(out, chunks_prev[prev_n].Bounds);
+        prev_n = match_n + 1;
+    }
+    for (; prev_n < chunks_prev.Size; prev_n++)
+        AddDrawDataDamageRect(out, chunks_prev[prev_n].Bounds);
+
+    // Merged rectangles may now overlap others
+    for (bool merged_any = true; merged_any; )
+    {
+        merged_any = false;
+        for (int n = 0; n < out->Size && !merged_any; n++)
+            for (int m = n + 1; m < out->Size && !merged_any; m++)
+            {
+                ImRect merged((*out)[n]);
+                const float area = merged.GetArea() + ImRect((*out)[m]).GetArea();
+                merged.Add(ImRect((*out)[m]));
+                if (merged.GetArea() <= area)
+                {
+                    (*out)[n] = merged.ToVec4();
+                    out->erase(out->Data + m);
+                    merged_any = true;
+                }
+            }
+    }
+}
+
 // For backward compatibility: convert all buffers from indexed to de-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
 void ImDrawData::DeIndexAllBuffers()
 {
@@ -2241,9 +4421,11 @@ void ImDrawData::DeIndexAllBuffers()
             continue;
         new_vtx_buffer.resize(cmd_list->IdxBuffer.Size);
         for (int j = 0; j < cmd_list->IdxBuffer.Size; j++)
-            new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->IdxBuffer[j]];
+            new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->_GetIdx(j)];
         cmd_list->VtxBuffer.swap(new_vtx_buffer);
         cmd_list->IdxBuffer.resize(0);
+        cmd_list->IdxSegments.resize(0);
+        cmd_list->IdxSize = sizeof(ImDrawIdx);
         TotalVtxCount += cmd_list->VtxBuffer.Size;
     }
 }
@@ -2256,6 +4438,8 @@ void ImDrawData::ScaleClipRects(const ImVec2& fb_scale)
     for (ImDrawList* draw_list : CmdLists)
         for (ImDrawCmd& cmd : draw_list->CmdBuffer)
             cmd.ClipRect = ImVec4(cmd.ClipRect.x * fb_scale.x, cmd.ClipRect.y * fb_scale.y, cmd.ClipRect.z * fb_scale.x, cmd.ClipRect.w * fb_scale.y);
+    for (ImVec4& rect : DamageRects)
+        rect = ImVec4(rect.x * fb_scale.x, rect.y * fb_scale.y, rect.z * fb_scale.x, rect.w * fb_scale.y);
 }
 
 //-----------------------------------------------------------------------------
@@ -2389,11 +4573,14 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
     { ImVec2(109,0),ImVec2(13,15), ImVec2( 6, 7) }, // ImGuiMouseCursor_NotAllowed
 };
 
+static void ImFontAtlasBuildDestroyDynamicGlyphs(ImFontAtlas* atlas);
+
 ImFontAtlas::ImFontAtlas()
 {
     memset(this, 0, sizeof(*this));
     TexGlyphPadding = 1;
-    PackIdMouseCursors = PackIdLines = -1;
+    BuildWorkersCount = 1;
+    PackIdMouseCursors = PackIdLines = PackIdRoundCorners = -1;
 }
 
 ImFontAtlas::~ImFontAtlas()
@@ -2421,7 +4608,8 @@ void    ImFontAtlas::ClearInputData()
         }
     ConfigData.clear();
     CustomRects.clear();
-    PackIdMouseCursors = PackIdLines = -1;
+    PackIdMouseCursors = PackIdLines = PackIdRoundCorners = -1;
+    ImFontAtlasBuildDestroyDynamicGlyphs(this);
     // Important: we leave TexReady untouched
 }
 
@@ -2435,14 +4623,18 @@ void    ImFontAtlas::ClearTexData()
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
     TexPixelsUseColors = false;
+    TexUpdates.clear();
+    ImFontAtlasBuildDestroyDynamicGlyphs(this);
     // Important: we leave TexReady untouched
 }
 
 void    ImFontAtlas::ClearFonts()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasBuildDestroyDynamicGlyphs(this);
     Fonts.clear_delete();
     TexReady = false;
+    FontsGeneration++;
 }
 
 void    ImFontAtlas::Clear()
@@ -2677,51 +4869,315 @@ bool ImFontAtlas::GetMouseCursorTexData(ImGuiMouseCursor cursor_type, ImVec2* ou
     return true;
 }
 
-bool    ImFontAtlas::Build()
+bool    ImFontAtlas::Build()
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+
+    // Default font is none are specified
+    if (ConfigData.Size == 0)
+        AddFontDefault();
+
+    // Select builder
+    // - Note that we do not reassign to atlas->FontBuilderIO, since it is likely to point to static data which
+    //   may mess with some hot-reloading schemes. If you need to assign to this (for dynamic selection) AND are
+    //   using a hot-reloading scheme that messes up static data, store your own instance of ImFontBuilderIO somewhere
+    //   and point to it instead of pointing directly to return value of the GetBuilderXXX functions.
+    const ImFontBuilderIO* builder_io = FontBuilderIO;
+    if (builder_io == NULL)
+    {
+#ifdef IMGUI_ENABLE_FREETYPE
+        builder_io = ImGuiFreeType::GetBuilderForFreeType();
+#elif defined(IMGUI_ENABLE_STB_TRUETYPE)
+        builder_io = ImFontAtlasGetBuilderForStbTruetype();
+#else
+        IM_ASSERT(0); // Invalid Build function
+#endif
+    }
+
+    // Build
+    return builder_io->FontBuilder_Build(this);
+}
+
+void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
+{
+    for (unsigned int i = 0; i < 256; i++)
+    {
+        unsigned int value = (unsigned int)(i * in_brighten_factor);
+        out_table[i] = value > 255 ? 255 : (value & 0xFF);
+    }
+}
+
+void    ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride)
+{
+    IM_ASSERT_PARANOID(w <= stride);
+    unsigned char* data = pixels + x + y * stride;
+    for (int j = h; j > 0; j--, data += stride - w)
+        for (int i = w; i > 0; i--, data++)
+            *data = table[*data];
+}
+
+// Atomic operations for glyphs missed by other threads (see ImGui::BeginDrawListThreads())
+#if defined(_MSC_VER) && !defined(__clang__)
+static inline int ImAtomicExchange(int* p, int v)   { return (int)_InterlockedExchange((volatile long*)p, (long)v); }
+static inline int ImAtomicFetchAdd(int* p, int v)   { return (int)_InterlockedExchangeAdd((volatile long*)p, (long)v); }
+#else
+static inline int ImAtomicExchange(int* p, int v)   { return __atomic_exchange_n(p, v, __ATOMIC_ACQ_REL); }
+static inline int ImAtomicFetchAdd(int* p, int v)   { return __atomic_fetch_add(p, v, __ATOMIC_RELAXED); }
+#endif
+
+// Glyphs rasterized on demand (see ImFontAtlasFlags_DynamicGlyphs and comments of ImFontAtlasDynamicGlyphs)
+// Called by font builder once it packed other glyphs, 'free_y' is the top of texture area left free.
+void ImFontAtlasBuildInitDynamicGlyphs(ImFontAtlas* atlas, const ImFontBuilderIO* builder_io, int free_y)
+{
+    IM_ASSERT(atlas->DynamicGlyphs == NULL && builder_io->FontBuilder_RenderGlyph != NULL);
+    atlas->DynamicGlyphs = IM_NEW(ImFontAtlasDynamicGlyphs)();
+    atlas->DynamicGlyphs->BuilderIO = builder_io;
+    atlas->DynamicGlyphs->ShelvesY = free_y;
+}
+
+// Called by font builder for each glyph not rasterized by Build(). 'w' and 'h' include padding.
+void ImFontAtlasBuildAddDynamicGlyph(ImFontAtlas* atlas, ImFont* font, int glyph_index, int src_index, int w, int h)
+{
+    ImFontAtlasDynamicGlyphs* dg = atlas->DynamicGlyphs;
+    ImFontAtlasDynamicGlyph entry;
+    entry.Font = font;
+    entry.GlyphIndex = glyph_index;
+    entry.SrcIndex = src_index;
+    entry.Width = (unsigned short)w;
+    entry.Height = (unsigned short)h;
+    entry.SlotIndex = -1;
+    entry.LastUsedFrame = -1;
+    entry.MissedByThreads = 0;
+    font->Glyphs[glyph_index].Dynamic = true;
+    font->DynamicGlyphsIndex.resize(font->Glyphs.Size, -1);
+    font->DynamicGlyphsIndex[glyph_index] = dg->Glyphs.Size;
+    dg->Glyphs.push_back(entry);
+}
+
+static void ImFontAtlasBuildDestroyDynamicGlyphs(ImFontAtlas* atlas)
+{
+    if (atlas->DynamicGlyphs)
+        IM_DELETE(atlas->DynamicGlyphs);
+    atlas->DynamicGlyphs = NULL;
+}
+
+static void ImFontAtlasBuildEvictDynamicGlyph(ImFontAtlasDynamicGlyphs* dg, int slot_n)
+{
+    ImFontAtlasDynamicSlot& slot = dg->Slots[slot_n];
+    if (slot.GlyphIndex == -1)
+        return;
+    ImFontAtlasDynamicGlyph& entry = dg->Glyphs[slot.GlyphIndex];
+    ImFontGlyph& glyph = entry.Font->Glyphs[entry.GlyphIndex];
+    glyph.U0 = glyph.V0 = glyph.U1 = glyph.V1 = 0.0f;
+    entry.SlotIndex = -1;
+    slot.GlyphIndex = -1;
+    dg->StatsEvicted++;
+}
+
+static int ImFontAtlasBuildAddDynamicSlot(ImFontAtlasDynamicGlyphs* dg, int shelf_n, int w)
+{
+    ImFontAtlasDynamicShelf& shelf = dg->Shelves[shelf_n];
+    ImFontAtlasDynamicSlot new_slot = { shelf_n, shelf.UsedWidth, w, -1 };
+    shelf.UsedWidth += w;
+    for (int slot_n = 0; slot_n < dg->Slots.Size; slot_n++)
+        if (dg->Slots[slot_n].ShelfIndex == -1)
+        {
+            dg->Slots[slot_n] = new_slot;
+            return slot_n;
+        }
+    dg->Slots.push_back(new_slot);
+    return dg->Slots.Size - 1;
+}
+
+// Find free texture space for a glyph, evicting least recently used glyphs if needed. Return index in Slots[], -1 if none.
+static int ImFontAtlasBuildFindDynamicSlot(ImFontAtlas* atlas, int w, int h)
+{
+    // Glyphs have padding on their top-left side: keep as much on right and bottom edges of texture
+    ImFontAtlasDynamicGlyphs* dg = atlas->DynamicGlyphs;
+    const int tex_w = atlas->TexWidth - atlas->TexGlyphPadding;
+    const int tex_h = atlas->TexHeight - atlas->TexGlyphPadding;
+    if (w > tex_w)
+        return -1;
+    const int shelf_max_height = h + h / 4;
+    const int evict_before_frame = (dg->NoEvictFrame == dg->FrameCount) ? 0 : ImMin(dg->FrameCount, dg->RetainedFrame);
+
+    // Smallest free slot in a shelf of similar height, while looking for least recently used one
+    int best_slot_n = -1, lru_slot_n = -1, lru_frame = evict_before_frame;
+    for (int slot_n = 0; slot_n < dg->Slots.Size; slot_n++)
+    {
+        const ImFontAtlasDynamicSlot& slot = dg->Slots[slot_n];
+        if (slot.ShelfIndex == -1 || slot.Width < w)
+            continue;
+        const ImFontAtlasDynamicShelf& shelf = dg->Shelves[slot.ShelfIndex];
+        if (shelf.Height < h || shelf.Height > shelf_max_height)
+            continue;
+        if (slot.GlyphIndex == -1)
+        {
+            if (best_slot_n == -1 || slot.Width < dg->Slots[best_slot_n].Width)
+                best_slot_n = slot_n;
+        }
+        else if (dg->Glyphs[slot.GlyphIndex].LastUsedFrame < lru_frame)
+        {
+            lru_frame = dg->Glyphs[slot.GlyphIndex].LastUsedFrame;
+            lru_slot_n = slot_n;
+        }
+    }
+    if (best_slot_n != -1)
+        return best_slot_n;
+
+    // New slot at the end of a shelf of similar height
+    for (int shelf_n = 0; shelf_n < dg->Shelves.Size; shelf_n++)
+    {
+        const ImFontAtlasDynamicShelf& shelf = dg->Shelves[shelf_n];
+        if (shelf.Height >= h && shelf.Height <= shelf_max_height && shelf.UsedWidth + w <= tex_w)
+            return ImFontAtlasBuildAddDynamicSlot(dg, shelf_n, w);
+    }
+
+    // New shelf in free texture area
+    if (dg->ShelvesY + h <= tex_h)
+    {
+        ImFontAtlasDynamicShelf shelf;
+        shelf.Y = dg->ShelvesY;
+        shelf.Height = ImMin((h + 3) & ~3, tex_h - dg->ShelvesY);
+        shelf.UsedWidth = 0;
+        dg->ShelvesY += shelf.Height;
+        dg->Shelves.push_back(shelf);
+        return ImFontAtlasBuildAddDynamicSlot(dg, dg->Shelves.Size - 1, w);
+    }
+
+    // Evict least recently used glyph which leaves enough space
+    if (lru_slot_n != -1)
+    {
+        ImFontAtlasBuildEvictDynamicGlyph(dg, lru_slot_n);
+        return lru_slot_n;
+    }
+
+    // Repurpose least recently used shelf which is tall enough
+    int lru_shelf_n = -1;
+    lru_frame = evict_before_frame;
+    for (int shelf_n = 0; shelf_n < dg->Shelves.Size; shelf_n++)
+        if (dg->Shelves[shelf_n].Height >= h)
+        {
+            int shelf_frame = -1;
+            for (const ImFontAtlasDynamicSlot& slot : dg->Slots)
+                if (slot.ShelfIndex == shelf_n && slot.GlyphIndex != -1)
+                    shelf_frame = ImMax(shelf_frame, dg->Glyphs[slot.GlyphIndex].LastUsedFrame);
+            if (shelf_frame < lru_frame)
+            {
+                lru_frame = shelf_frame;
+                lru_shelf_n = shelf_n;
+            }
+        }
+    if (lru_shelf_n == -1)
+        return -1;
+    for (int slot_n = 0; slot_n < dg->Slots.Size; slot_n++)
+        if (dg->Slots[slot_n].ShelfIndex == lru_shelf_n)
+        {
+            ImFontAtlasBuildEvictDynamicGlyph(dg, slot_n);
+            dg->Slots[slot_n].ShelfIndex = -1;
+        }
+    // Clear whole shelf: space right of its new slots must not hold evicted glyphs, which would bleed into their padding
+    ImFontAtlasDynamicShelf& shelf = dg->Shelves[lru_shelf_n];
+    for (int row = 0; row < shelf.Height; row++)
+    {
+        memset(atlas->TexPixelsAlpha8 + (shelf.Y + row) * atlas->TexWidth, 0, (size_t)atlas->TexWidth);
+        if (atlas->TexPixelsRGBA32 != NULL)
+            for (unsigned int* dst = atlas->TexPixelsRGBA32 + (shelf.Y + row) * atlas->TexWidth, *dst_end = dst + atlas->TexWidth; dst < dst_end; dst++)
+                *dst = IM_COL32(255, 255, 255, 0);
+    }
+    ImFontAtlasTexUpdate update = { 0, (unsigned short)shelf.Y, (unsigned short)atlas->TexWidth, (unsigned short)shelf.Height };
+    atlas->TexUpdates.push_back(update);
+    shelf.UsedWidth = 0;
+    return ImFontAtlasBuildAddDynamicSlot(dg, lru_shelf_n, w);
+}
+
+static bool ImFontAtlasBuildLoadDynamicGlyph(ImFontAtlas* atlas, int glyph_n)
 {
-    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
-
-    // Default font is none are specified
-    if (ConfigData.Size == 0)
-        AddFontDefault();
-
-    // Select builder
-    // - Note that we do not reassign to atlas->FontBuilderIO, since it is likely to point to static data which
-    //   may mess with some hot-reloading schemes. If you need to assign to this (for dynamic selection) AND are
-    //   using a hot-reloading scheme that messes up static data, store your own instance of ImFontBuilderIO somewhere
-    //   and point to it instead of pointing directly to return value of the GetBuilderXXX functions.
-    const ImFontBuilderIO* builder_io = FontBuilderIO;
-    if (builder_io == NULL)
+    ImFontAtlasDynamicGlyphs* dg = atlas->DynamicGlyphs;
+    ImFontAtlasDynamicGlyph* entry = &dg->Glyphs[glyph_n];
+    const int slot_n = ImFontAtlasBuildFindDynamicSlot(atlas, entry->Width, entry->Height);
+    if (slot_n == -1)
     {
-#ifdef IMGUI_ENABLE_FREETYPE
-        builder_io = ImGuiFreeType::GetBuilderForFreeType();
-#elif defined(IMGUI_ENABLE_STB_TRUETYPE)
-        builder_io = ImFontAtlasGetBuilderForStbTruetype();
-#else
-        IM_ASSERT(0); // Invalid Build function
-#endif
+        dg->StatsFailed++;
+        return false;
     }
+    ImFontAtlasDynamicSlot& slot = dg->Slots[slot_n];
+    const int x = slot.X;
+    const int y = dg->Shelves[slot.ShelfIndex].Y;
+    const int w = slot.Width;
+    const int h = dg->Shelves[slot.ShelfIndex].Height;
+
+    // Clear slot (it may hold an evicted glyph) and rasterize glyph, which sets its UV
+    for (int row = 0; row < h; row++)
+        memset(atlas->TexPixelsAlpha8 + (y + row) * atlas->TexWidth + x, 0, (size_t)w);
+    if (!dg->BuilderIO->FontBuilder_RenderGlyph(atlas, entry, x, y))
+    {
+        dg->StatsFailed++;
+        return false;
+    }
+    if (atlas->TexPixelsRGBA32 != NULL)
+        for (int row = 0; row < h; row++)
+        {
+            const unsigned char* src = atlas->TexPixelsAlpha8 + (y + row) * atlas->TexWidth + x;
+            unsigned int* dst = atlas->TexPixelsRGBA32 + (y + row) * atlas->TexWidth + x;
+            for (int n = w; n > 0; n--)
+                *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
+        }
+    slot.GlyphIndex = glyph_n;
+    entry->SlotIndex = slot_n;
+    dg->StatsLoaded++;
 
-    // Build
-    return builder_io->FontBuilder_Build(this);
+    // Request texture update, merged with previous one when contiguous (slots of a new shelf are filled from left to right)
+    ImFontAtlasTexUpdate* last_update = atlas->TexUpdates.Size > 0 ? &atlas->TexUpdates.back() : NULL;
+    if (last_update && last_update->Y == y && last_update->Height == h && last_update->X + last_update->Width == x)
+    {
+        last_update->Width = (unsigned short)(last_update->Width + w);
+    }
+    else
+    {
+        ImFontAtlasTexUpdate update = { (unsigned short)x, (unsigned short)y, (unsigned short)w, (unsigned short)h };
+        atlas->TexUpdates.push_back(update);
+    }
+    return true;
 }
 
-void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
+bool ImFontAtlasBuildUseDynamicGlyph(ImFontAtlas* atlas, const ImFont* font, const ImFontGlyph* glyph)
 {
-    for (unsigned int i = 0; i < 256; i++)
+    ImFontAtlasDynamicGlyphs* dg = atlas->DynamicGlyphs;
+    const int glyph_index = (int)(glyph - font->Glyphs.Data);
+    if (dg == NULL || glyph_index >= font->DynamicGlyphsIndex.Size || font->DynamicGlyphsIndex.Data[glyph_index] == -1)
+        return false;
+    const int glyph_n = font->DynamicGlyphsIndex.Data[glyph_index];
+    ImFontAtlasDynamicGlyph* entry = &dg->Glyphs[glyph_n];
+
+    // Draw lists filled by other threads can only use glyphs which are already resident (see ImGui::BeginDrawListThreads())
+    // Missing ones are queued once each, to be rasterized by ImGui::EndDrawListThreads().
+    ImGuiContext* ctx = GImGui;
+    if (ctx != NULL && ctx->DrawListThreadsActive)
     {
-        unsigned int value = (unsigned int)(i * in_brighten_factor);
-        out_table[i] = value > 255 ? 255 : (value & 0xFF);
+        if (entry->SlotIndex != -1)
+            return true;
+        if (ImAtomicExchange(&entry->MissedByThreads, 1) == 0)
+            dg->ThreadsMissed.Data[ImAtomicFetchAdd(&dg->ThreadsMissedCount, 1)] = glyph_n;
+        return false;
     }
+    entry->LastUsedFrame = dg->FrameCount;
+    return entry->SlotIndex != -1 || ImFontAtlasBuildLoadDynamicGlyph(atlas, glyph_n);
 }
 
-void    ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride)
+void ImFontAtlasBuildLoadDynamicGlyphsMissedByThreads(ImFontAtlas* atlas)
 {
-    IM_ASSERT_PARANOID(w <= stride);
-    unsigned char* data = pixels + x + y * stride;
-    for (int j = h; j > 0; j--, data += stride - w)
-        for (int i = w; i > 0; i--, data++)
-            *data = table[*data];
+    ImFontAtlasDynamicGlyphs* dg = atlas->DynamicGlyphs;
+    IM_ASSERT(dg->ThreadsMissedCount <= dg->ThreadsMissed.Size);
+    for (int n = 0; n < dg->ThreadsMissedCount; n++)
+    {
+        ImFontAtlasDynamicGlyph* entry = &dg->Glyphs[dg->ThreadsMissed[n]];
+        entry->MissedByThreads = 0;
+        entry->LastUsedFrame = dg->FrameCount;
+        if (entry->SlotIndex == -1)
+            ImFontAtlasBuildLoadDynamicGlyph(atlas, dg->ThreadsMissed[n]);
+    }
+    dg->ThreadsMissedCount = 0;
 }
 
 #ifdef IMGUI_ENABLE_STB_TRUETYPE
@@ -2762,6 +5218,129 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+// Glyphs rasterization job: a range of glyphs of a source font (see ImFontAtlas::BuildWorkersCount)
+struct ImFontBuildRenderJob
+{
+    int                 SrcIndex;
+    int                 GlyphStart;
+    int                 GlyphCount;
+};
+
+// Data shared by glyphs rasterization workers (read-only, except for the texture and output glyphs written by each job)
+struct ImFontBuildRenderData
+{
+    ImFontAtlas*                    Atlas;
+    ImFontBuildSrcData*             SrcTmpArray;
+    const stbtt_pack_context*       PackContext;
+    ImVector<ImFontBuildRenderJob>  Jobs;       // Worker N processes jobs N, N + WorkersCount, N + WorkersCount * 2...
+    int                             WorkersCount;
+    ImFontBuildAllocator            Allocator;
+};
+
+static void ImFontAtlasBuildRenderGlyphsWorker(void* worker_data, int worker_n)
+{
+    ImFontBuildRenderData* data = (ImFontBuildRenderData*)worker_data;
+    ImFontAtlas* atlas = data->Atlas;
+    for (int job_i = worker_n; job_i < data->Jobs.Size; job_i += data->WorkersCount)
+    {
+        const ImFontBuildRenderJob& job = data->Jobs[job_i];
+        ImFontConfig& cfg = atlas->ConfigData[job.SrcIndex];
+        ImFontBuildSrcData& src_tmp = data->SrcTmpArray[job.SrcIndex];
+
+        // stb_truetype writes to the pack context and allocates with stbtt_fontinfo::userdata: use our own copies.
+        stbtt_pack_context spc = *data->PackContext;
+        stbtt_fontinfo font_info = src_tmp.FontInfo;
+        font_info.userdata = (data->WorkersCount > 1) ? &data->Allocator : NULL;
+        stbtt_pack_range pack_range = src_tmp.PackRange;
+        pack_range.array_of_unicode_codepoints += job.GlyphStart;
+        pack_range.chardata_for_range += job.GlyphStart;
+        pack_range.num_chars = job.GlyphCount;
+        stbrp_rect* rects = src_tmp.Rects + job.GlyphStart;
+        stbtt_PackFontRangesRenderIntoRects(&spc, &font_info, &pack_range, 1, rects);
+
+        // Apply multiply operator
+        if (cfg.RasterizerMultiply != 1.0f)
+        {
+            unsigned char multiply_table[256];
+            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+            stbrp_rect* r = rects;
+            for (int glyph_i = 0; glyph_i < job.GlyphCount; glyph_i++, r++)
+                if (r->was_packed)
+                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+        }
+    }
+}
+
+// Calculate packed data of a glyph as stbtt_PackFontRangesRenderIntoRects() would, without rasterizing it. Output size of rectangle including padding.
+static void ImFontAtlasBuildCalcPackedCharWithStbTruetype(ImFontAtlas* atlas, const ImFontConfig* cfg, const stbtt_fontinfo* font_info, int codepoint, stbtt_packedchar* out_pc, int* out_rect_w, int* out_rect_h)
+{
+    const float scale = stbtt_ScaleForPixelHeight(font_info, cfg->SizePixels * cfg->RasterizerDensity);
+    const int glyph_index_in_font = stbtt_FindGlyphIndex(font_info, codepoint);
+    int advance, lsb, x0, y0, x1, y1;
+    stbtt_GetGlyphHMetrics(font_info, glyph_index_in_font, &advance, &lsb);
+    stbtt_GetGlyphBitmapBox(font_info, glyph_index_in_font, scale * cfg->OversampleH, scale * cfg->OversampleV, &x0, &y0, &x1, &y1);
+    const int w = x1 - x0 + cfg->OversampleH - 1;
+    const int h = y1 - y0 + cfg->OversampleV - 1;
+    memset(out_pc, 0, sizeof(*out_pc));
+    *out_rect_w = w + atlas->TexGlyphPadding;
+    *out_rect_h = h + atlas->TexGlyphPadding;
+    if (*out_rect_w == 0 || *out_rect_h == 0)
+        return;
+    const float sub_x = (float)-(cfg->OversampleH - 1) / (2.0f * (float)cfg->OversampleH); // Same as stbtt__oversample_shift()
+    const float sub_y = (float)-(cfg->OversampleV - 1) / (2.0f * (float)cfg->OversampleV);
+    const float recip_h = 1.0f / cfg->OversampleH;
+    const float recip_v = 1.0f / cfg->OversampleV;
+    out_pc->xadvance = scale * advance;
+    out_pc->xoff = (float)x0 * recip_h + sub_x;
+    out_pc->yoff = (float)y0 * recip_v + sub_y;
+    out_pc->xoff2 = (x0 + w) * recip_h + sub_x;
+    out_pc->yoff2 = (y0 + h) * recip_v + sub_y;
+}
+
+// Rasterize a glyph added with ImFontAtlasBuildAddDynamicGlyph(), as ImFontAtlasBuildWithStbTruetype() does for packed glyphs.
+static bool ImFontAtlasBuildRenderGlyphWithStbTruetype(ImFontAtlas* atlas, ImFontAtlasDynamicGlyph* entry, int x, int y)
+{
+    const ImFontConfig& cfg = atlas->ConfigData[entry->SrcIndex];
+    ImFontGlyph& glyph = entry->Font->Glyphs[entry->GlyphIndex];
+    stbtt_fontinfo font_info = {};
+    if (!stbtt_InitFont(&font_info, (unsigned char*)cfg.FontData, stbtt_GetFontOffsetForIndex((unsigned char*)cfg.FontData, cfg.FontNo)))
+        return false;
+
+    int codepoint = (int)glyph.Codepoint;
+    stbtt_packedchar pc = {};
+    stbtt_pack_range pack_range = {};
+    pack_range.font_size = cfg.SizePixels * cfg.RasterizerDensity;
+    pack_range.array_of_unicode_codepoints = &codepoint;
+    pack_range.num_chars = 1;
+    pack_range.chardata_for_range = &pc;
+    pack_range.h_oversample = (unsigned char)cfg.OversampleH;
+    pack_range.v_oversample = (unsigned char)cfg.OversampleV;
+    stbrp_rect rect = {};
+    rect.x = (stbrp_coord)x;
+    rect.y = (stbrp_coord)y;
+    rect.w = (stbrp_coord)entry->Width;
+    rect.h = (stbrp_coord)entry->Height;
+    rect.was_packed = 1;
+    stbtt_pack_context spc = {};
+    spc.width = atlas->TexWidth;
+    spc.height = atlas->TexHeight;
+    spc.stride_in_bytes = atlas->TexWidth;
+    spc.padding = atlas->TexGlyphPadding;
+    spc.pixels = atlas->TexPixelsAlpha8;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &font_info, &pack_range, 1, &rect);
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, rect.x, rect.y, rect.w, rect.h, atlas->TexWidth * 1);
+    }
+    glyph.U0 = pc.x0 * atlas->TexUvScale.x;
+    glyph.V0 = pc.y0 * atlas->TexUvScale.y;
+    glyph.U1 = pc.x1 * atlas->TexUvScale.x;
+    glyph.V1 = pc.y1 * atlas->TexUvScale.y;
+    return true;
+}
+
 static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
@@ -2863,6 +5442,23 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         dst_tmp_array[dst_i].GlyphsSet.Clear();
     dst_tmp_array.clear();
 
+    // Glyphs rasterized on demand are not packed: keep them at the end of the (sorted) GlyphsList[], past GlyphsCount (see ImFontAtlasFlags_DynamicGlyphs)
+    const bool dynamic_glyphs = (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs) != 0;
+    const int DYNAMIC_GLYPHS_FIRST_CODEPOINT = 0x100;
+    if (dynamic_glyphs)
+    {
+        total_glyphs_count = 0;
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        {
+            ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
+            int static_glyphs_count = 0;
+            while (static_glyphs_count < src_tmp.GlyphsList.Size && src_tmp.GlyphsList[static_glyphs_count] < DYNAMIC_GLYPHS_FIRST_CODEPOINT)
+                static_glyphs_count++;
+            src_tmp.GlyphsCount = static_glyphs_count;
+            total_glyphs_count += static_glyphs_count;
+        }
+    }
+
     // Allocate packing character data and flag packed characters buffer as non-packed (x0=y0=x1=y1=0)
     // (We technically don't need to zero-clear buf_rects, but let's do it for the sake of sanity)
     ImVector<stbrp_rect> buf_rects;
@@ -2892,7 +5488,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.PackRange.font_size = cfg.SizePixels * cfg.RasterizerDensity;
         src_tmp.PackRange.first_unicode_codepoint_in_range = 0;
         src_tmp.PackRange.array_of_unicode_codepoints = src_tmp.GlyphsList.Data;
-        src_tmp.PackRange.num_chars = src_tmp.GlyphsList.Size;
+        src_tmp.PackRange.num_chars = src_tmp.GlyphsCount;
         src_tmp.PackRange.chardata_for_range = src_tmp.PackedChars;
         src_tmp.PackRange.h_oversample = (unsigned char)cfg.OversampleH;
         src_tmp.PackRange.v_oversample = (unsigned char)cfg.OversampleV;
@@ -2900,7 +5496,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
         const float scale = (cfg.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels * cfg.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels * cfg.RasterizerDensity);
         const int padding = atlas->TexGlyphPadding;
-        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
+        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
         {
             int x0, y0, x1, y1;
             const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
@@ -2920,7 +5516,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     if (atlas->TexDesiredWidth > 0)
         atlas->TexWidth = atlas->TexDesiredWidth;
     else
-        atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f) ? 1024 : 512;
+        atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f || dynamic_glyphs) ? 1024 : 512;
 
     // 5. Start packing
     // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
@@ -2946,6 +5542,10 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     }
 
     // 7. Allocate texture
+    // With dynamic glyphs, reserve free space below packed data: at least half as much as texture width (so 1024x512 pixels by default).
+    const int packed_height = atlas->TexHeight;
+    if (dynamic_glyphs)
+        atlas->TexHeight = ImMax(atlas->TexHeight + atlas->TexWidth / 2, atlas->TexWidth);
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
@@ -2954,33 +5554,34 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
+    // Glyphs are cut into jobs, distributed to workers: each job writes to its own set of packed rectangles.
+    const int GLYPHS_PER_JOB = 64;
+    ImFontBuildRenderData render_data;
+    render_data.Atlas = atlas;
+    render_data.SrcTmpArray = src_tmp_array.Data;
+    render_data.PackContext = &spc;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
+        for (int glyph_i = 0; glyph_i < src_tmp_array[src_i].GlyphsCount; glyph_i += GLYPHS_PER_JOB)
         {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+            ImFontBuildRenderJob job = { src_i, glyph_i, ImMin(GLYPHS_PER_JOB, src_tmp_array[src_i].GlyphsCount - glyph_i) };
+            render_data.Jobs.push_back(job);
         }
-        src_tmp.Rects = NULL;
-    }
+    render_data.WorkersCount = (atlas->BuildRunWorkersFunc != NULL) ? ImClamp(atlas->BuildWorkersCount, 1, ImMax(render_data.Jobs.Size, 1)) : 1;
+    ImGui::GetAllocatorFunctions(&render_data.Allocator.AllocFunc, &render_data.Allocator.FreeFunc, &render_data.Allocator.UserData);
+    if (render_data.WorkersCount > 1)
+        atlas->BuildRunWorkersFunc(atlas, ImFontAtlasBuildRenderGlyphsWorker, &render_data, render_data.WorkersCount);
+    else
+        ImFontAtlasBuildRenderGlyphsWorker(&render_data, 0);
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        src_tmp_array[src_i].Rects = NULL;
 
     // End packing
     stbtt_PackEnd(&spc);
     buf_rects.clear();
 
     // 9. Setup ImFont and glyphs for runtime
+    if (dynamic_glyphs)
+        ImFontAtlasBuildInitDynamicGlyphs(atlas, ImFontAtlasGetBuilderForStbTruetype(), packed_height);
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         // When merging fonts with MergeMode=true:
@@ -3002,19 +5603,29 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
         const float inv_rasterization_scale = 1.0f / cfg.RasterizerDensity;
 
-        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
+        const int glyphs_count = dynamic_glyphs ? src_tmp.GlyphsList.Size : src_tmp.GlyphsCount;
+        for (int glyph_i = 0; glyph_i < glyphs_count; glyph_i++)
         {
             // Register glyph
+            // Glyphs rasterized on demand get the same metrics as packed ones, without UV (see ImFontAtlasFlags_DynamicGlyphs)
             const int codepoint = src_tmp.GlyphsList[glyph_i];
-            const stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
+            const bool is_dynamic = (glyph_i >= src_tmp.GlyphsCount);
+            stbtt_packedchar pc;
+            int rect_w = 0, rect_h = 0;
+            if (is_dynamic)
+                ImFontAtlasBuildCalcPackedCharWithStbTruetype(atlas, &cfg, &src_tmp.FontInfo, codepoint, &pc, &rect_w, &rect_h);
+            else
+                pc = src_tmp.PackedChars[glyph_i];
             stbtt_aligned_quad q;
             float unused_x = 0.0f, unused_y = 0.0f;
-            stbtt_GetPackedQuad(src_tmp.PackedChars, atlas->TexWidth, atlas->TexHeight, glyph_i, &unused_x, &unused_y, &q, 0);
+            stbtt_GetPackedQuad(&pc, atlas->TexWidth, atlas->TexHeight, 0, &unused_x, &unused_y, &q, 0);
             float x0 = q.x0 * inv_rasterization_scale + font_off_x;
             float y0 = q.y0 * inv_rasterization_scale + font_off_y;
             float x1 = q.x1 * inv_rasterization_scale + font_off_x;
             float y1 = q.y1 * inv_rasterization_scale + font_off_y;
             dst_font->AddGlyph(&cfg, (ImWchar)codepoint, x0, y0, x1, y1, q.s0, q.t0, q.s1, q.t1, pc.xadvance * inv_rasterization_scale);
+            if (is_dynamic && dst_font->Glyphs.back().Visible)
+                ImFontAtlasBuildAddDynamicGlyph(atlas, dst_font, dst_font->Glyphs.Size - 1, src_i, rect_w, rect_h);
         }
     }
 
@@ -3029,6 +5640,7 @@ const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
 {
     static ImFontBuilderIO io;
     io.FontBuilder_Build = ImFontAtlasBuildWithStbTruetype;
+    io.FontBuilder_RenderGlyph = ImFontAtlasBuildRenderGlyphWithStbTruetype;
     return &io;
 }
 
@@ -3202,6 +5814,59 @@ static void ImFontAtlasBuildRenderLinesTexData(ImFontAtlas* atlas)
     }
 }
 
+// Quarter circles are mirrored around their center to render a whole circle or the 4 corners of a rectangle (see ImDrawList::_TryAddRoundCornersTex()).
+// - Filled: coverage ramps from 1 to 0 between radius-0.5 and radius+0.5, as polygons filled with anti-aliasing. One per pixel of radius.
+// - Stroked: 1 pixel thick ring. One per half pixel of radius, as stroked circles are often centered on pixel centers (e.g. RadioButton()).
+// Coverage is linear between texel centers, so bilinear filtering is exact: filled sprites have their center on a texel corner, stroked sprites
+// have it on a texel center for integer radii or on a texel corner for half pixel radii. Texels before the center are copies for bilinear
+// filtering, and texels on the row/column going through the center hold the profile of straight edges between corners.
+// Sprites end with a transparent texel, 'radius + 0.5' (filled) or 'radius + 1' (stroked) texels away from center.
+static const int FONT_ATLAS_ROUND_CORNERS_TEX_COUNT = IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX * 3 - 1;
+
+static float ImFontAtlasGetRoundCornersTexRadius(int n, bool* out_stroked)
+{
+    *out_stroked = (n >= IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX);
+    return *out_stroked ? (float)(n - IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX + 2) * 0.5f : (float)(n + 1);
+}
+
+static void ImFontAtlasBuildRenderRoundCornersTexData(ImFontAtlas* atlas)
+{
+    if (atlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners)
+        return;
+
+    for (int n = 0; n < FONT_ATLAS_ROUND_CORNERS_TEX_COUNT; n++)
+    {
+        bool stroked;
+        const float radius = ImFontAtlasGetRoundCornersTexRadius(n, &stroked);
+        ImFontAtlasCustomRect* r = atlas->GetCustomRectByIndex(atlas->PackIdRoundCorners + n);
+        IM_ASSERT(r->IsPacked() && r->Width == (int)ImCeil(radius) + 3);
+        const float edge_radius = stroked ? radius : radius + 0.5f;
+        const float center = 1.0f + ImCeil(edge_radius) - edge_radius; // From center of first texel
+        for (unsigned int y = 0; y < r->Height; y++)
+            for (unsigned int x = 0; x < r->Width; x++)
+            {
+                const float dx = (ImFabs((float)x - center) <= 0.5f) ? 0.0f : (float)x - center;
+                const float dy = (ImFabs((float)y - center) <= 0.5f) ? 0.0f : (float)y - center;
+                const float dist = ImSqrt(dx * dx + dy * dy);
+                const float coverage = stroked ? ImSaturate(1.0f - ImFabs(dist - radius)) : ImSaturate(radius + 0.5f - dist);
+                const unsigned int alpha = (unsigned int)(coverage * 255.0f + 0.5f);
+                const int offset = (int)(r->X + x) + (int)(r->Y + y) * atlas->TexWidth;
+                if (atlas->TexPixelsAlpha8 != NULL)
+                    atlas->TexPixelsAlpha8[offset] = (unsigned char)alpha;
+                else
+                    atlas->TexPixelsRGBA32[offset] = IM_COL32(255, 255, 255, alpha);
+            }
+
+        // UV of center, and of center of last texel (transparent) along each axis
+        const ImVec2 uv_center = ImVec2((float)r->X + center + 0.5f, (float)r->Y + center + 0.5f) * atlas->TexUvScale;
+        const ImVec2 uv_outer = ImVec2((float)(r->X + r->Width) - 0.5f, (float)(r->Y + r->Height) - 0.5f) * atlas->TexUvScale;
+        if (stroked)
+            atlas->TexUvRoundCornersStroked[(int)(radius * 2.0f)] = ImVec4(uv_center.x, uv_center.y, uv_outer.x, uv_outer.y);
+        else
+            atlas->TexUvRoundCornersFilled[(int)radius] = ImVec4(uv_center.x, uv_center.y, uv_outer.x, uv_outer.y);
+    }
+}
+
 // Note: this is called / shared by both the stb_truetype and the FreeType builder
 void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 {
@@ -3228,6 +5893,20 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
         if (!(atlas->Flags & ImFontAtlasFlags_NoBakedLines))
             atlas->PackIdLines = atlas->AddCustomRectRegular(IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 2, IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1);
     }
+
+    // Register texture regions for quarter circles (+3 for padding, center and transparent edge texels)
+    if (atlas->PackIdRoundCorners < 0)
+    {
+        if (!(atlas->Flags & ImFontAtlasFlags_NoBakedRoundCorners))
+            for (int n = 0; n < FONT_ATLAS_ROUND_CORNERS_TEX_COUNT; n++)
+            {
+                bool stroked;
+                const int size = (int)ImCeil(ImFontAtlasGetRoundCornersTexRadius(n, &stroked)) + 3;
+                const int id = atlas->AddCustomRectRegular(size, size);
+                if (n == 0)
+                    atlas->PackIdRoundCorners = id;
+            }
+    }
 }
 
 // This is called/shared by both the stb_truetype and the FreeType builder.
@@ -3237,6 +5916,7 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
     IM_ASSERT(atlas->TexPixelsAlpha8 != NULL || atlas->TexPixelsRGBA32 != NULL);
     ImFontAtlasBuildRenderDefaultTexData(atlas);
     ImFontAtlasBuildRenderLinesTexData(atlas);
+    ImFontAtlasBuildRenderRoundCornersTexData(atlas);
 
     // Register custom rectangle glyphs
     for (int i = 0; i < atlas->CustomRects.Size; i++)
@@ -3321,6 +6001,285 @@ static void UnpackAccumulativeOffsetsIntoRanges(int base_codepoint, const short*
     out_ranges[0] = 0;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] ImFontAtlas cache
+//-------------------------------------------------------------------------
+// Cache data layout (all values in native byte order, structures stored as-is):
+// - ImFontAtlasCacheHeader
+// - Packed position (X, Y as 2 unsigned short) of each ImFontAtlas::CustomRects[]
+// - For each font: ImFontAtlasCacheFont, followed by ImFontGlyph[GlyphsCount]
+// - Texture pixels: TexWidth * TexHeight * BytesPerPixel
+//-------------------------------------------------------------------------
+
+#define IMGUI_FONT_ATLAS_CACHE_VERSION  1
+
+struct ImFontAtlasCacheHeader
+{
+    char    Magic[4];           // "IMFA"
+    ImU32   Version;            // IMGUI_FONT_ATLAS_CACHE_VERSION
+    ImU64   Key;                // Hash of build inputs, see ImFontAtlasCalcCacheKey()
+    ImU64   Checksum;           // Hash of data following header
+    ImU64   DataSize;           // Size of data following header
+    ImU32   FontsCount;
+    ImU32   CustomRectsCount;
+    ImU32   TexWidth, TexHeight;
+    ImU32   BytesPerPixel;      // 1: Alpha8, 4: RGBA32
+    ImU32   TexPixelsUseColors;
+};
+
+struct ImFontAtlasCacheFont
+{
+    float   Ascent, Descent;
+    int     MetricsTotalSurface;
+    int     GlyphsCount;
+};
+
+// 64-bit FNV-1a, processing 8 bytes at a time
+static ImU64 ImFontAtlasCacheHash(const void* data, size_t data_size, ImU64 seed = 0)
+{
+    const ImU64 prime = 0x100000001B3ULL;
+    ImU64 hash = seed ^ 0xCBF29CE484222325ULL;
+    const unsigned char* p = (const unsigned char*)data;
+    for (; data_size >= 8; data_size -= 8, p += 8)
+    {
+        ImU64 word;
+        memcpy(&word, p, 8);
+        hash = (hash ^ word) * prime;
+    }
+    for (; data_size > 0; data_size--, p++)
+        hash = (hash ^ *p) * prime;
+    return hash;
+}
+
+static void ImFontAtlasCacheWriteData(ImVector<char>* buf, const void* data, size_t data_size)
+{
+    buf->resize(buf->Size + (int)data_size);
+    memcpy(buf->Data + buf->Size - data_size, data, data_size);
+}
+
+template<typename T>
+static void ImFontAtlasCacheWrite(ImVector<char>* buf, const T& value)
+{
+    ImFontAtlasCacheWriteData(buf, &value, sizeof(T));
+}
+
+// Hash all inputs of Build(). Call after ImFontAtlasBuildInit(), which rounds font sizes and registers our own custom rectangles.
+static ImU64 ImFontAtlasCalcCacheKey(ImFontAtlas* atlas)
+{
+    // Builder: we can't identify custom builders, only their flags are hashed
+    int builder_id = 3;
+    if (atlas->FontBuilderIO == NULL)
+        builder_id = 0;
+#ifdef IMGUI_ENABLE_STB_TRUETYPE
+    else if (atlas->FontBuilderIO == ImFontAtlasGetBuilderForStbTruetype())
+        builder_id = 1;
+#endif
+#ifdef IMGUI_ENABLE_FREETYPE
+    if (builder_id == 0 || atlas->FontBuilderIO == ImGuiFreeType::GetBuilderForFreeType())
+        builder_id = 2;
+#endif
+
+    ImVector<char> buf;
+    ImFontAtlasCacheWrite(&buf, (int)IMGUI_VERSION_NUM);
+    ImFontAtlasCacheWrite(&buf, (int)IMGUI_FONT_ATLAS_CACHE_VERSION);
+    ImFontAtlasCacheWrite(&buf, (int)sizeof(ImFontGlyph));
+    ImFontAtlasCacheWrite(&buf, (int)sizeof(ImWchar));
+    ImFontAtlasCacheWrite(&buf, (int)IM_DRAWLIST_TEX_LINES_WIDTH_MAX);
+    ImFontAtlasCacheWrite(&buf, (int)IM_DRAWLIST_TEX_ROUND_CORNERS_RADIUS_MAX);
+    ImFontAtlasCacheWrite(&buf, builder_id);
+    ImFontAtlasCacheWrite(&buf, atlas->FontBuilderFlags);
+    ImFontAtlasCacheWrite(&buf, atlas->Flags);
+    ImFontAtlasCacheWrite(&buf, atlas->TexDesiredWidth);
+    ImFontAtlasCacheWrite(&buf, atlas->TexGlyphPadding);
+    ImFontAtlasCacheWrite(&buf, atlas->Fonts.Size);
+    for (const ImFontConfig& cfg : atlas->ConfigData)
+    {
+        ImFontAtlasCacheWrite(&buf, ImFontAtlasCacheHash(cfg.FontData, (size_t)cfg.FontDataSize));
+        ImFontAtlasCacheWrite(&buf, cfg.FontDataSize);
+        ImFontAtlasCacheWrite(&buf, cfg.FontNo);
+        ImFontAtlasCacheWrite(&buf, cfg.SizePixels);
+        ImFontAtlasCacheWrite(&buf, cfg.OversampleH);
+        ImFontAtlasCacheWrite(&buf, cfg.OversampleV);
+        ImFontAtlasCacheWrite(&buf, cfg.PixelSnapH);
+        ImFontAtlasCacheWrite(&buf, cfg.GlyphExtraSpacing);
+        ImFontAtlasCacheWrite(&buf, cfg.GlyphOffset);
+        ImFontAtlasCacheWrite(&buf, cfg.GlyphMinAdvanceX);
+        ImFontAtlasCacheWrite(&buf, cfg.GlyphMaxAdvanceX);
+        ImFontAtlasCacheWrite(&buf, cfg.MergeMode);
+        ImFontAtlasCacheWrite(&buf, cfg.FontBuilderFlags);
+        ImFontAtlasCacheWrite(&buf, cfg.RasterizerMultiply);
+        ImFontAtlasCacheWrite(&buf, cfg.RasterizerDensity);
+        ImFontAtlasCacheWrite(&buf, cfg.EllipsisChar);
+        ImFontAtlasCacheWrite(&buf, atlas->Fonts.find_index(cfg.DstFont));
+        const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+        for (; ranges[0]; ranges += 2)
+        {
+            ImFontAtlasCacheWrite(&buf, ranges[0]);
+            ImFontAtlasCacheWrite(&buf, ranges[1]);
+        }
+        ImFontAtlasCacheWrite(&buf, (ImWchar)0);
+    }
+    for (const ImFontAtlasCustomRect& r : atlas->CustomRects)
+    {
+        ImFontAtlasCacheWrite(&buf, r.Width);
+        ImFontAtlasCacheWrite(&buf, r.Height);
+        ImFontAtlasCacheWrite(&buf, r.GlyphID);
+        ImFontAtlasCacheWrite(&buf, r.GlyphAdvanceX);
+        ImFontAtlasCacheWrite(&buf, r.GlyphOffset);
+        ImFontAtlasCacheWrite(&buf, r.Font ? atlas->Fonts.find_index(r.Font) : -1);
+    }
+    return ImFontAtlasCacheHash(buf.Data, (size_t)buf.Size);
+}
+
+bool    ImFontAtlas::SaveCacheData(ImVector<char>* out_data)
+{
+    out_data->resize(0);
+    if (!IsBuilt() || (Flags & ImFontAtlasFlags_DynamicGlyphs) || (TexPixelsAlpha8 == NULL && TexPixelsRGBA32 == NULL))
+        return false;
+
+    ImFontAtlasCacheHeader header = {};
+    memcpy(header.Magic, "IMFA", 4);
+    header.Version = IMGUI_FONT_ATLAS_CACHE_VERSION;
+    header.Key = ImFontAtlasCalcCacheKey(this);
+    header.FontsCount = (ImU32)Fonts.Size;
+    header.CustomRectsCount = (ImU32)CustomRects.Size;
+    header.TexWidth = (ImU32)TexWidth;
+    header.TexHeight = (ImU32)TexHeight;
+    header.BytesPerPixel = TexPixelsAlpha8 ? 1 : 4;
+    header.TexPixelsUseColors = TexPixelsUseColors ? 1 : 0;
+    ImFontAtlasCacheWrite(out_data, header);
+    for (const ImFontAtlasCustomRect& r : CustomRects)
+    {
+        ImFontAtlasCacheWrite(out_data, r.X);
+        ImFontAtlasCacheWrite(out_data, r.Y);
+    }
+    for (const ImFont* font : Fonts)
+    {
+        ImFontAtlasCacheFont font_header = { font->Ascent, font->Descent, font->MetricsTotalSurface, font->Glyphs.Size };
+        ImFontAtlasCacheWrite(out_data, font_header);
+        ImFontAtlasCacheWriteData(out_data, font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes());
+    }
+    if (TexPixelsAlpha8)
+        ImFontAtlasCacheWriteData(out_data, TexPixelsAlpha8, (size_t)TexWidth * TexHeight);
+    else
+        ImFontAtlasCacheWriteData(out_data, TexPixelsRGBA32, (size_t)TexWidth * TexHeight * 4);
+
+    // Seal
+    header.DataSize = (ImU64)(out_data->Size - sizeof(header));
+    header.Checksum = ImFontAtlasCacheHash(out_data->Data + sizeof(header), (size_t)header.DataSize);
+    memcpy(out_data->Data, &header, sizeof(header));
+    return true;
+}
+
+bool    ImFontAtlas::LoadCacheData(const void* data, size_t data_size)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    if (Flags & ImFontAtlasFlags_DynamicGlyphs)
+        return false;
+
+    // Same inputs as Build()
+    if (ConfigData.Size == 0)
+        AddFontDefault();
+    ImFontAtlasBuildInit(this);
+
+    // Validate everything before modifying atlas
+    ImFontAtlasCacheHeader header;
+    if (data_size < sizeof(header))
+        return false;
+    memcpy(&header, data, sizeof(header));
+    const char* data_begin = (const char*)data + sizeof(header);
+    const size_t pixels_size = (size_t)header.TexWidth * header.TexHeight * header.BytesPerPixel;
+    if (memcmp(header.Magic, "IMFA", 4) != 0 || header.Version != IMGUI_FONT_ATLAS_CACHE_VERSION || header.DataSize != data_size - sizeof(header))
+        return false;
+    if (header.FontsCount != (ImU32)Fonts.Size || header.CustomRectsCount != (ImU32)CustomRects.Size || (header.BytesPerPixel != 1 && header.BytesPerPixel != 4))
+        return false;
+    if (header.TexWidth == 0 || header.TexHeight == 0 || header.TexWidth > 0x8000 || header.TexHeight > 0x8000)
+        return false;
+    if (header.Key != ImFontAtlasCalcCacheKey(this) || header.Checksum != ImFontAtlasCacheHash(data_begin, (size_t)header.DataSize))
+        return false;
+    const char* p = data_begin;
+    const char* p_end = data_begin + header.DataSize;
+    const char* rects_data = p;
+    p += CustomRects.Size * sizeof(unsigned short) * 2;
+    ImVector<const char*> fonts_data;
+    for (int font_n = 0; font_n < Fonts.Size && p + sizeof(ImFontAtlasCacheFont) <= p_end; font_n++)
+    {
+        ImFontAtlasCacheFont font_header;
+        memcpy(&font_header, p, sizeof(font_header));
+        if (font_header.GlyphsCount <= 0 || font_header.GlyphsCount >= 0xFFFF)
+            return false;
+        fonts_data.push_back(p);
+        p += sizeof(font_header) + font_header.GlyphsCount * sizeof(ImFontGlyph);
+    }
+    if (fonts_data.Size != Fonts.Size || p > p_end || (size_t)(p_end - p) != pixels_size)
+        return false;
+
+    // Texture
+    TexID = (ImTextureID)NULL;
+    ClearTexData();
+    TexWidth = (int)header.TexWidth;
+    TexHeight = (int)header.TexHeight;
+    TexUvScale = ImVec2(1.0f / TexWidth, 1.0f / TexHeight);
+    TexPixelsUseColors = header.TexPixelsUseColors != 0;
+    if (header.BytesPerPixel == 1)
+        TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(pixels_size);
+    else
+        TexPixelsRGBA32 = (unsigned int*)IM_ALLOC(pixels_size);
+    memcpy(TexPixelsAlpha8 ? (void*)TexPixelsAlpha8 : (void*)TexPixelsRGBA32, p, pixels_size);
+    for (int rect_n = 0; rect_n < CustomRects.Size; rect_n++)
+    {
+        memcpy(&CustomRects[rect_n].X, rects_data + rect_n * 4, sizeof(unsigned short));
+        memcpy(&CustomRects[rect_n].Y, rects_data + rect_n * 4 + 2, sizeof(unsigned short));
+    }
+
+    // Fonts
+    for (ImFontConfig& cfg : ConfigData)
+    {
+        if (cfg.MergeMode)
+            continue;
+        ImFont* font = cfg.DstFont;
+        ImFontAtlasCacheFont font_header;
+        memcpy(&font_header, fonts_data[Fonts.find_index(font)], sizeof(font_header));
+        ImFontAtlasBuildSetupFont(this, font, &cfg, font_header.Ascent, font_header.Descent);
+        font->MetricsTotalSurface = font_header.MetricsTotalSurface;
+        font->Glyphs.resize(font_header.GlyphsCount);
+        memcpy(font->Glyphs.Data, fonts_data[Fonts.find_index(font)] + sizeof(font_header), (size_t)font->Glyphs.size_in_bytes());
+    }
+
+    // Same as ImFontAtlasBuildFinish(), with glyphs of custom rectangles already registered
+    // (rendering our custom data again is cheap, and computes their UVs)
+    ImFontAtlasBuildRenderDefaultTexData(this);
+    ImFontAtlasBuildRenderLinesTexData(this);
+    ImFontAtlasBuildRenderRoundCornersTexData(this);
+    for (ImFont* font : Fonts)
+        font->BuildLookupTable();
+    TexReady = true;
+    return true;
+}
+
+bool    ImFontAtlas::BuildWithCacheFile(const char* filename)
+{
+    size_t data_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size);
+    const bool loaded = data != NULL && LoadCacheData(data, data_size);
+    IM_FREE(data);
+    if (loaded)
+        return true;
+
+    if (!Build())
+        return false;
+    ImVector<char> cache_data;
+    if (!SaveCacheData(&cache_data))
+        return true;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (f != NULL)
+    {
+        ImFileWrite(cache_data.Data, 1, (ImU64)cache_data.Size, f);
+        ImFileClose(f);
+    }
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] ImFontAtlas glyph ranges helpers
 //-------------------------------------------------------------------------
@@ -3580,6 +6539,7 @@ ImFont::ImFont()
     ConfigData = NULL;
     ConfigDataCount = 0;
     DirtyLookupTables = false;
+    AdvanceXAsciiIsInteger = false;
     Scale = 1.0f;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
@@ -3598,6 +6558,7 @@ void    ImFont::ClearOutputData()
     Glyphs.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    DynamicGlyphsIndex.clear();
     FallbackGlyph = NULL;
     ContainerAtlas = NULL;
     DirtyLookupTables = true;
@@ -3605,6 +6566,20 @@ void    ImFont::ClearOutputData()
     MetricsTotalSurface = 0;
 }
 
+// Sums of non-negative integers below 2^24 are exact in any order: CalcTextSizeA() uses this to sum runs of ASCII characters in parallel.
+static bool ImFontCalcAdvanceXAsciiIsInteger(const ImFont* font)
+{
+    if (font->IndexAdvanceX.Size < 0x80)
+        return false;
+    for (int c = 0x20; c < 0x80; c++)
+    {
+        const float advance_x = font->IndexAdvanceX.Data[c];
+        if (!(advance_x >= 0.0f && advance_x < 65536.0f && advance_x == (float)(int)advance_x))
+            return false;
+    }
+    return true;
+}
+
 static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_chars, int candidate_chars_count)
 {
     for (int n = 0; n < candidate_chars_count; n++)
@@ -3673,6 +6648,9 @@ void ImFont::BuildLookupTable()
     for (int i = 0; i < max_codepoint + 1; i++)
         if (IndexAdvanceX[i] < 0.0f)
             IndexAdvanceX[i] = FallbackAdvanceX;
+    AdvanceXAsciiIsInteger = ImFontCalcAdvanceXAsciiIsInteger(this);
+    if (ContainerAtlas)
+        ContainerAtlas->FontsGeneration++;
 
     // Setup Ellipsis character. It is required for rendering elided text. We prefer using U+2026 (horizontal ellipsis).
     // However some old fonts may contain ellipsis at U+0085. Here we auto-detect most suitable ellipsis character.
@@ -3755,6 +6733,7 @@ void ImFont::AddGlyph(const ImFontConfig* cfg, ImWchar codepoint, float x0, floa
     glyph.Codepoint = (unsigned int)codepoint;
     glyph.Visible = (x0 != x1) && (y0 != y1);
     glyph.Colored = false;
+    glyph.Dynamic = false;
     glyph.X0 = x0;
     glyph.Y0 = y0;
     glyph.X1 = x1;
@@ -3785,6 +6764,9 @@ void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
     GrowIndex(dst + 1);
     IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
     IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    AdvanceXAsciiIsInteger = ImFontCalcAdvanceXAsciiIsInteger(this);
+    if (ContainerAtlas)
+        ContainerAtlas->FontsGeneration++;
 }
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
@@ -3918,6 +6900,33 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     return s;
 }
 
+// Return end of run of printable ASCII characters [0x20..0x7F] starting at 'text', scanning 16 bytes at a time when SIMD is available (the scalar loop finishes the last block).
+// (those characters need no UTF-8 decoding nor newline handling, and are all covered by IndexAdvanceX[] when its size is >= 0x80)
+static const char* ImTextFindPrintableAsciiRunEnd(const char* text, const char* text_end)
+{
+    const char* p = text;
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    const __m128i min_minus_one = _mm_set1_epi8(0x1F);
+    while (text_end - p >= 16)
+    {
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128((const __m128i*)(const void*)p), min_minus_one)) != 0xFFFF) // Signed compare: bytes >= 0x80 are negative
+            break;
+        p += 16;
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const int8x16_t min_minus_one = vdupq_n_s8(0x1F);
+    while (text_end - p >= 16)
+    {
+        if (vminvq_u8(vcgtq_s8(vld1q_s8((const int8_t*)(const void*)p), min_minus_one)) == 0)
+            break;
+        p += 16;
+    }
+#endif
+    while (p < text_end && (signed char)*p > 0x1F)
+        p++;
+    return p;
+}
+
 ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining) const
 {
     if (!text_end)
@@ -3953,6 +6962,50 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
             }
         }
 
+        // Fast path for runs of printable ASCII characters [0x20..0x7F], which need no decoding and are all in IndexAdvanceX[].
+        // Output is identical to the per-character loop below, as we add the same advances in the same order, except:
+        // when all advances are small non-negative integers (e.g. most fonts at their native size), partial sums are exact and
+        // increasing, so long runs are summed in blocks with independent accumulators and only the total is compared to max_width.
+        if (!word_wrap_enabled && (signed char)*s > 0x1F && IndexAdvanceX.Size >= 0x80)
+        {
+            const float* advances = IndexAdvanceX.Data;
+            if (text_end - s >= 16 && AdvanceXAsciiIsInteger && scale == 1.0f && line_width < 16777216.0f && line_width == (float)(int)line_width)
+            {
+                const char* run_end = ImTextFindPrintableAsciiRunEnd(s, text_end);
+                while (run_end - s >= 4)
+                {
+                    const char* block_end = s + (ImMin((int)(run_end - s), 64) & ~3);
+                    float w0 = 0.0f, w1 = 0.0f, w2 = 0.0f, w3 = 0.0f;
+                    for (const char* p = s; p < block_end; p += 4)
+                    {
+                        w0 += advances[(unsigned char)p[0]];
+                        w1 += advances[(unsigned char)p[1]];
+                        w2 += advances[(unsigned char)p[2]];
+                        w3 += advances[(unsigned char)p[3]];
+                    }
+                    const float new_line_width = line_width + ((w0 + w1) + (w2 + w3));
+                    if (new_line_width >= max_width || new_line_width >= 16777216.0f)
+                        break; // Let the loop below find where we stop
+                    line_width = new_line_width;
+                    s = block_end;
+                }
+            }
+            bool reached_max_width = false;
+            for (; s < text_end && (signed char)*s > 0x1F; s++)
+            {
+                const float char_width = advances[(unsigned char)*s] * scale;
+                if (line_width + char_width >= max_width)
+                {
+                    reached_max_width = true;
+                    break;
+                }
+                line_width += char_width;
+            }
+            if (reached_max_width)
+                break;
+            continue;
+        }
+
         // Decode and advance source
         const char* prev_s = s;
         unsigned int c = (unsigned int)*s;
@@ -4002,6 +7055,8 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     const ImFontGlyph* glyph = FindGlyph(c);
     if (!glyph || !glyph->Visible)
         return;
+    if (glyph->Dynamic && !ImFontAtlasBuildUseDynamicGlyph(ContainerAtlas, this, glyph))
+        return;
     if (glyph->Colored)
         col |= ~IM_COL32_A_MASK;
     float scale = (size >= 0.0f) ? (size / FontSize) : 1.0f;
@@ -4077,6 +7132,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
+    const ImDrawTransform* transform = (draw_list->_TransformStack.Size > 0) ? &draw_list->_Transform : NULL;
 
     while (s < text_end)
     {
@@ -4133,6 +7189,13 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
             float y2 = y + glyph->Y1 * scale;
             if (x1 <= clip_rect.z && x2 >= clip_rect.x)
             {
+                // Rasterize glyph on demand, it may not fit in texture (see ImFontAtlasFlags_DynamicGlyphs)
+                if (glyph->Dynamic && !ImFontAtlasBuildUseDynamicGlyph(ContainerAtlas, this, glyph))
+                {
+                    x += char_width;
+                    continue;
+                }
+
                 // Render a character
                 float u1 = glyph->U0;
                 float v1 = glyph->V0;
@@ -4178,6 +7241,16 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
                     vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
                     vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
                     vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+                    if (transform != NULL)
+                    {
+                        const ImVec2 p1 = transform->Apply(ImVec2(x1, y1));
+                        const ImVec2 dx = transform->AxisX * (x2 - x1);
+                        const ImVec2 dy = transform->AxisY * (y2 - y1);
+                        vtx_write[0].pos = p1;
+                        vtx_write[1].pos = p1 + dx;
+                        vtx_write[2].pos = p1 + dx + dy;
+                        vtx_write[3].pos = p1 + dy;
+                    }
                     idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
                     idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
                     vtx_write += 4;
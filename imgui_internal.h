@@ -60,6 +60,11 @@ Index of this file:
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
 #endif
+// Enable NEON intrinsics if available (AArch64 only, as we rely on IEEE compliant vector division/square root to match scalar code)
+#if (defined __aarch64__ || defined _M_ARM64) && !defined(IMGUI_ENABLE_SSE) && !defined(IMGUI_DISABLE_NEON)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -123,6 +128,7 @@ struct ImBitVector;                 // Store 1-bit per value
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
+struct ImFontAtlasDynamicGlyph;     // A glyph rasterized on demand (see ImFontAtlasFlags_DynamicGlyphs)
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiContext;                // Main Dear ImGui context
 struct ImGuiContextHook;            // Hook for extensions like ImGuiTestEngine
@@ -504,6 +510,7 @@ IMGUI_API ImVec2     ImTriangleClosestPoint(const ImVec2& a, const ImVec2& b, co
 IMGUI_API void       ImTriangleBarycentricCoords(const ImVec2& a, const ImVec2& b, const ImVec2& c, const ImVec2& p, float& out_u, float& out_v, float& out_w);
 inline float         ImTriangleArea(const ImVec2& a, const ImVec2& b, const ImVec2& c)          { return ImFabs((a.x * (b.y - c.y)) + (b.x * (c.y - a.y)) + (c.x * (a.y - b.y))) * 0.5f; }
 inline bool          ImTriangleIsClockwise(const ImVec2& a, const ImVec2& b, const ImVec2& c)   { return ((b.x - a.x) * (c.y - b.y)) - ((c.x - b.x) * (b.y - a.y)) > 0.0f; }
+IMGUI_API bool       ImFindMinMaxIndices(const float* values, int values_count, int values_stride, int* out_idx_min, int* out_idx_max); // Used for min/max decimation of dense polylines and plots. NaN values are ignored. Return false if no value was found.
 
 // Helper: ImVec1 (1D vector)
 // (this odd construct is used to facilitate the transition between 1D and 2D, and the maintenance of some branches/patches)
@@ -767,6 +774,21 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+// ImDrawList: Largest segment count for which ImDrawListSharedData::GetCircleVtx() caches unit circle samples.
+#ifndef IM_DRAWLIST_CIRCLE_VTX_CACHE_MAX
+#define IM_DRAWLIST_CIRCLE_VTX_CACHE_MAX                        IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX
+#endif
+
+// ImDrawList: Smallest point count for which AddConcavePolyFilled() uses O(N log N) sweep-line triangulation instead of O(N^2) ear-clipping.
+#ifndef IM_DRAWLIST_CONCAVE_MONOTONE_THRESHOLD
+#define IM_DRAWLIST_CONCAVE_MONOTONE_THRESHOLD                  64
+#endif
+
+// ImDrawListSplitter: Smallest channel index count moved to ImDrawList::IdxSegments[] by Merge() instead of being copied (see ImDrawListFlags_AllowIdxSegments).
+#ifndef IM_DRAWLIST_IDX_SEGMENT_MIN
+#define IM_DRAWLIST_IDX_SEGMENT_MIN                             1024
+#endif
+
 // Data shared between all ImDrawList instances
 // You may want to create your own instance of this if you want to use ImDrawList completely without ImGui. In that case, watch out for future changes to this structure.
 struct IMGUI_API ImDrawListSharedData
@@ -779,24 +801,83 @@ struct IMGUI_API ImDrawListSharedData
     float           CircleSegmentMaxError;      // Number of circle segments to use per pixel of radius for AddCircle() etc
     ImVec4          ClipRectFullscreen;         // Value for PushClipRectFullscreen()
     ImDrawListFlags InitialFlags;               // Initial flags at the beginning of the frame (it is possible to alter flags on a per-drawlist basis afterwards)
-
-    // [Internal] Temp write buffer
-    ImVector<ImVec2> TempBuffer;
+    bool            ReadOnly;                   // Lookup tables are not extended on demand, so draw lists using this may be built from multiple threads (see ImGui::BeginDrawListThreads())
 
     // [Internal] Lookup tables
     ImVec2          ArcFastVtx[IM_DRAWLIST_ARCFAST_TABLE_SIZE]; // Sample points on the quarter of the circle.
     float           ArcFastRadiusCutoff;                        // Cutoff radius after which arc drawing will fallback to slower PathArcTo()
     ImU8            CircleSegmentCounts[64];    // Precomputed segment count for given radius before we calculate it dynamically (to avoid calculation overhead)
     const ImVec4*   TexUvLines;                 // UV of anti-aliased lines in the atlas
+    const ImVec4*   TexUvRoundCornersFilled;    // UV of anti-aliased quarter circles in the atlas
+    const ImVec4*   TexUvRoundCornersStroked;   // UV of anti-aliased quarter rings in the atlas
+    ImVector<ImVec2> CircleVtxBuffer;           // Sample points on the unit circle, for all segment counts requested so far (see GetCircleVtx())
+    ImVector<int>   CircleVtxOffsets;           // Offset into CircleVtxBuffer[] for a given segment count, -1 when not built yet
 
     ImDrawListSharedData();
     void SetCircleTessellationMaxError(float max_error);
+    const ImVec2* GetCircleVtx(int num_segments); // Return 'num_segments' sample points on the unit circle (starting at angle 0), building them on first use. NULL if 'num_segments > IM_DRAWLIST_CIRCLE_VTX_CACHE_MAX', or if not built yet and ReadOnly is set.
+};
+
+// Memory blocks from which draw lists owned by the context allocate their buffers (see io.ConfigDrawListFrameArena)
+// - Allocations are carved by bumping an offset, and are all released at once when the arena is reused.
+// - Two sets of blocks are used on alternate frames, so the renderer may still read previous frame ImDrawData while we build the current one.
+// - Blocks are never freed before context destruction: draw lists of hidden windows may still point to them. Those pointers are
+//   dropped without being freed when the draw list is reset (ImGui::MemFree() also ignores pointers into the arena).
+// - Heap buffers that draw lists had before using the arena are freed one frame later, for the same reason as above.
+struct ImDrawListFrameArenaBlock
+{
+    char*           Data;
+    size_t          Size;
+    size_t          Offset;                     // Bytes carved so far in current frame
+};
+
+struct IMGUI_API ImDrawListFrameArena
+{
+    bool            Enabled;                    // Copy of io.ConfigDrawListFrameArena for current frame
+    bool            BlocksLocked;               // Don't add blocks, as other threads may call Contains() from ImGui::MemFree() (see ImGui::BeginDrawListThreads())
+    int             CurrentSet;                 // Index in Blocks[] used by current frame
+    size_t          UsedBytes;                  // Bytes allocated during current frame
+    size_t          UsedBytesPrevFrame;         // Bytes allocated during previous frame
+    ImVector<ImDrawListFrameArenaBlock> Blocks[2];
+    ImVector<void*> PendingFrees[2];            // Heap buffers given up by draw lists during a frame, freed when the same set of blocks is reused
+
+    ImDrawListFrameArena()                      { Enabled = BlocksLocked = false; CurrentSet = 0; UsedBytes = UsedBytesPrevFrame = 0; }
+    ~ImDrawListFrameArena()                     { ClearFreeMemory(); }
+    void*   Alloc(size_t size);                 // Return NULL if 'size' doesn't fit and BlocksLocked is set
+    bool    Extend(void* ptr, size_t old_size, size_t new_size); // Grow last allocation in place if possible
+    bool    Contains(const void* ptr) const;
+    void    FreeLater(void* ptr)                { PendingFrees[CurrentSet].push_back(ptr); }
+    void    NewFrame();
+    void    ClearFreeMemory();
+    size_t  GetBlocksSize() const;
+};
+
+// Output of a run of triangles or rectangle instances of a draw command, compared from one frame to the next (see io.ConfigDrawDataDamageRects)
+struct ImDrawDataDamageChunk
+{
+    ImRect                  Bounds;         // Pixels which may be touched: bounding box of the geometry, clipped and rounded to whole pixels
+    ImU32                   Hash;           // Hash of vertices/rectangle instances, texture and clip rectangle. 0 for chunks which never match (user callbacks)
+};
+
+// Chunks of last two frames, for ComputeDrawDataDamageRects()
+struct ImDrawDataDamageState
+{
+    bool                    Valid;          // Chunks[] holds the output of previous frame
+    ImRect                  DisplayRect;    // Display rectangle of previous frame
+    ImVec2                  FramebufferScale;
+    ImVector<ImDrawDataDamageChunk> Chunks;
+    ImVector<ImDrawDataDamageChunk> ChunksPrev;
+    ImVector<ImU64>         ChunksPrevSorted; // (Hash << 32) | index into ChunksPrev[], sorted. Only built when the output is not identical to previous frame.
+
+    void                    ClearFreeMemory() { Valid = false; Chunks.clear(); ChunksPrev.clear(); ChunksPrevSorted.clear(); }
 };
 
 struct ImDrawDataBuilder
 {
     ImVector<ImDrawList*>*  Layers[2];      // Pointers to global layers for: regular, tooltip. LayersP[0] is owned by DrawData.
     ImVector<ImDrawList*>   LayerData1;
+    ImVector<ImDrawList*>   MergedLists;    // Draw lists owned by the viewport, output of MergeDrawDataLists() when io.ConfigDrawDataMergeLists is set
+    ImDrawDataDamageState   DamageState;    // Output of previous frame when io.ConfigDrawDataDamageRects is set
 
     ImDrawDataBuilder()                     { memset(this, 0, sizeof(*this)); }
 };
@@ -1301,6 +1382,46 @@ struct ImGuiPtrOrIndex
     ImGuiPtrOrIndex(int index)  { Ptr = NULL; Index = index; }
 };
 
+// Results of CalcTextSize() kept across frames (see io.ConfigTextSizeCache)
+// - Only texts of IMGUI_TEXT_SIZE_CACHE_MIN_LENGTH bytes or more, or wrapped texts, are cached.
+// - Keyed by font, font size, wrap width and text. Texts are copied and compared on lookup: hash collisions never return a wrong size.
+// - Flushed when the atlas of measured fonts is modified or rebuilt (see ImFontAtlas::FontsGeneration), or when adding an entry
+//   would exceed io.ConfigTextSizeCacheMaxBytes. The frame working set is then cached again from scratch.
+#ifndef IMGUI_TEXT_SIZE_CACHE_MIN_LENGTH
+#define IMGUI_TEXT_SIZE_CACHE_MIN_LENGTH    16
+#endif
+
+struct ImGuiTextSizeCacheEntry
+{
+    ImFont*     Font;                       // NULL for an empty slot
+    float       FontSize;
+    float       WrapWidth;
+    ImGuiID     Hash;
+    int         TextOffset;                 // Offset of text in ImGuiTextSizeCache::TextBuf[]
+    int         TextLen;
+    ImVec2      Size;
+};
+
+struct IMGUI_API ImGuiTextSizeCache
+{
+    ImVector<ImGuiTextSizeCacheEntry> Entries;  // Open addressing hash table, size is a power of two
+    ImVector<char>  TextBuf;
+    int             EntriesCount;
+    ImFontAtlas*    Atlas;                      // Atlas of cached fonts
+    int             AtlasFontsGeneration;       // Value of Atlas->FontsGeneration when entries were added
+    int             Hits, Misses;               // Current frame
+    int             HitsPrevFrame, MissesPrevFrame;
+    int             FlushesCount;               // Total number of flushes, because of memory budget or font changes
+
+    ImGuiTextSizeCache()                        { EntriesCount = 0; Atlas = NULL; AtlasFontsGeneration = 0; Hits = Misses = HitsPrevFrame = MissesPrevFrame = FlushesCount = 0; }
+    bool    Find(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end, ImGuiID hash, ImVec2* out_size);
+    void    Add(ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end, ImGuiID hash, const ImVec2& size, int max_bytes);
+    void    Flush();
+    void    ClearFreeMemory()                   { Entries.clear(); TextBuf.clear(); EntriesCount = 0; Atlas = NULL; }
+    void    NewFrame()                          { HitsPrevFrame = Hits; MissesPrevFrame = Misses; Hits = Misses = 0; }
+    int     GetMemoryBytes() const              { return Entries.size_in_bytes() + TextBuf.Capacity; }
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Popup support
 //-----------------------------------------------------------------------------
@@ -1741,7 +1862,7 @@ struct ImGuiViewportP : public ImGuiViewport
     ImVec2              BuildWorkOffsetMax;     // Work Area: Offset being built during current frame. Generally <= 0.0f.
 
     ImGuiViewportP()    { BgFgDrawListsLastFrame[0] = BgFgDrawListsLastFrame[1] = -1; BgFgDrawLists[0] = BgFgDrawLists[1] = NULL; }
-    ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); }
+    ~ImGuiViewportP()   { if (BgFgDrawLists[0]) IM_DELETE(BgFgDrawLists[0]); if (BgFgDrawLists[1]) IM_DELETE(BgFgDrawLists[1]); for (ImDrawList* draw_list : DrawDataBuilder.MergedLists) IM_DELETE(draw_list); }
 
     // Calculate work rect pos/size given a set of offset (we have 1 pair of offset for rect locked from last frame data, and 1 pair for currently building rect)
     ImVec2  CalcWorkRectPos(const ImVec2& off_min) const                            { return ImVec2(Pos.x + off_min.x, Pos.y + off_min.y); }
@@ -1930,6 +2051,10 @@ struct ImGuiContext
     float                   FontScale;                          // == FontSize / Font->FontSize
     float                   CurrentDpiScale;                    // Current window/viewport DpiScale
     ImDrawListSharedData    DrawListSharedData;
+    ImDrawListSharedData    DrawListSharedDataForThreads;       // Read-only copy of DrawListSharedData, see BeginDrawListThreads()
+    ImDrawListFrameArena    DrawListFrameArena;                 // Storage for draw lists buffers when io.ConfigDrawListFrameArena is set
+    ImGuiTextSizeCache      TextSizeCache;                      // Results of CalcTextSize() when io.ConfigTextSizeCache is set
+    bool                    DrawListThreadsActive;              // Between BeginDrawListThreads() and EndDrawListThreads(): other threads may allocate memory
     double                  Time;
     int                     FrameCount;
     int                     FrameCountEnded;
@@ -2254,7 +2379,10 @@ struct ImGuiContext
     int                     WantCaptureMouseNextFrame;          // Explicit capture override via SetNextFrameWantCaptureMouse()/SetNextFrameWantCaptureKeyboard(). Default to -1.
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;
+    float                   NextFrameDelay;                     // Output of last EndFrame(), see GetNextFrameDelay()
+    float                   NextFrameDelayRequested;            // Smallest delay passed to RequestNextFrame() during current frame
     ImVector<char>          TempBuffer;                         // Temporary text buffer
+    ImVector<ImVec2>        PlotLinesBuffer;                    // Temporary min/max envelope built by PlotLines() for ImDrawList::AddPolylineDecimated(), at most 4 points per pixel column
     char                    TempKeychordName[64];
 
     ImGuiContext(ImFontAtlas* shared_font_atlas)
@@ -2270,6 +2398,7 @@ struct ImGuiContext
         Time = 0.0f;
         FrameCount = 0;
         FrameCountEnded = FrameCountRendered = -1;
+        DrawListThreadsActive = false;
         WithinFrameScope = WithinFrameScopeWithImplicitWindow = WithinEndChild = false;
         GcCompactAll = false;
         TestEngineHookItems = false;
@@ -2458,6 +2587,8 @@ struct ImGuiContext
         FramerateSecPerFrameIdx = FramerateSecPerFrameCount = 0;
         FramerateSecPerFrameAccum = 0.0f;
         WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
+        NextFrameDelay = 0.0f;
+        NextFrameDelayRequested = FLT_MAX;
         memset(TempKeychordName, 0, sizeof(TempKeychordName));
     }
 };
@@ -2599,6 +2730,7 @@ struct IMGUI_API ImGuiWindow
     ImVec2ih                HitTestHoleOffset;
 
     int                     LastFrameActive;                    // Last frame number the window was Active.
+    int                     LastFrameRefreshed;                 // Last frame number the window contents were submitted (as opposed to reused, see SkipRefresh).
     float                   LastTimeActive;                     // Last timestamp the window was Active (using float as we don't need high precision there)
     float                   ItemWidthDefault;
     ImGuiStorage            StateStorage;
@@ -3064,6 +3196,9 @@ namespace ImGui
     IMGUI_API ImDrawList*   GetBackgroundDrawList(ImGuiViewport* viewport);                     // get background draw list for the given viewport. this draw list will be the first rendering one. Useful to quickly draw shapes/text behind dear imgui contents.
     IMGUI_API ImDrawList*   GetForegroundDrawList(ImGuiViewport* viewport);                     // get foreground draw list for the given viewport. this draw list will be the last rendered one. Useful to quickly draw shapes/text over dear imgui contents.
     IMGUI_API void          AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>* out_list, ImDrawList* draw_list);
+    IMGUI_API void          MergeDrawDataLists(ImDrawData* draw_data, ImVector<ImDrawList*>* pool);
+    IMGUI_API void          ComputeDrawDataDamageRects(ImDrawData* draw_data, ImDrawDataDamageState* state);
+    IMGUI_API int           CalcDrawDataCmdCount(const ImDrawData* draw_data);
 
     // Init
     IMGUI_API void          Initialize();
@@ -3575,6 +3710,62 @@ namespace ImGui
 struct ImFontBuilderIO
 {
     bool    (*FontBuilder_Build)(ImFontAtlas* atlas);
+    bool    (*FontBuilder_RenderGlyph)(ImFontAtlas* atlas, ImFontAtlasDynamicGlyph* glyph, int x, int y);   // Optional: rasterize a glyph into texture at (x,y) and set its UV (see ImFontAtlasFlags_DynamicGlyphs)
+};
+
+// Glyph rasterized on demand (see ImFontAtlasFlags_DynamicGlyphs)
+// Glyphs metrics are computed by Build(): only texture contents and UV change when a glyph is loaded.
+struct ImFontAtlasDynamicGlyph
+{
+    ImFont*         Font;
+    int             GlyphIndex;         // Index in Font->Glyphs[]
+    int             SrcIndex;           // Index in atlas->ConfigData[] (merged fonts have multiple sources)
+    unsigned short  Width, Height;      // Size of rectangle in texture, including padding
+    int             SlotIndex;          // Index in ImFontAtlasDynamicGlyphs::Slots[], -1 when not resident
+    int             LastUsedFrame;
+    int             MissedByThreads;    // Set atomically when other threads couldn't render it (see ImFontAtlasDynamicGlyphs::ThreadsMissed)
+};
+
+// Horizontal band of texture holding glyphs of similar height, allocated from left to right
+struct ImFontAtlasDynamicShelf
+{
+    int             Y, Height;
+    int             UsedWidth;          // Right of last allocated slot
+};
+
+// Texture area of a shelf allocated to a glyph. Once allocated, it keeps its size until its shelf is repurposed.
+struct ImFontAtlasDynamicSlot
+{
+    int             ShelfIndex;         // -1 when unused (its shelf was repurposed)
+    int             X, Width;
+    int             GlyphIndex;         // Index in ImFontAtlasDynamicGlyphs::Glyphs[] of glyph stored here, -1 if free
+};
+
+// Storage for glyphs rasterized on demand, allocated in texture space left free by Build()
+// - Shelves are allocated from top to bottom. Glyphs go to a shelf at most 25% taller than them, in a free slot or after its last slot.
+// - When no space is available, the least recently used glyph which fits is evicted, then the least recently used shelf is repurposed.
+//   Glyphs used during current frame are never evicted, as their UV may already have been output.
+//   Neither are glyphs used since RetainedFrame, which may be displayed by draw lists submitted again without being rebuilt (see ImGuiWindow::SkipRefresh).
+// - Glyphs missed by other threads are rasterized by ImGui::EndDrawListThreads(), so they are displayed from the next frame.
+struct ImFontAtlasDynamicGlyphs
+{
+    ImVector<ImFontAtlasDynamicGlyph>   Glyphs;
+    ImVector<ImFontAtlasDynamicShelf>   Shelves;
+    ImVector<ImFontAtlasDynamicSlot>    Slots;
+    int                                 ShelvesY;       // Top of texture space not allocated to shelves
+    int                                 FrameCount;     // Incremented by ImGui::NewFrame()
+    int                                 NoEvictFrame;   // Set by ImGui::BeginDrawListThreads(): glyphs used by other threads are not marked, so none can be evicted until next frame
+    int                                 RetainedFrame;  // Oldest frame whose glyphs may still be displayed. Set by ImGui::NewFrame() and lowered by Begin() for windows skipping refresh
+    ImVector<int>                       ThreadsMissed;  // Indices in Glyphs[] of glyphs other threads couldn't render. Sized by ImGui::BeginDrawListThreads(), so other threads never grow it
+    int                                 ThreadsMissedCount; // Number of valid entries in ThreadsMissed[], incremented atomically
+    const ImFontBuilderIO*              BuilderIO;
+
+    // Statistics
+    int                                 StatsLoaded;    // Number of glyphs rasterized since Build()
+    int                                 StatsEvicted;   // Number of glyphs evicted since Build()
+    int                                 StatsFailed;    // Number of glyphs which couldn't fit (they are not rendered)
+
+    ImFontAtlasDynamicGlyphs()          { ShelvesY = FrameCount = 0; NoEvictFrame = -1; RetainedFrame = INT_MAX; ThreadsMissedCount = 0; BuilderIO = NULL; StatsLoaded = StatsEvicted = StatsFailed = 0; }
 };
 
 // Helper for font builder
@@ -3590,6 +3781,10 @@ IMGUI_API void      ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas,
 IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned int in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
+IMGUI_API void      ImFontAtlasBuildInitDynamicGlyphs(ImFontAtlas* atlas, const ImFontBuilderIO* builder_io, int free_y);
+IMGUI_API void      ImFontAtlasBuildAddDynamicGlyph(ImFontAtlas* atlas, ImFont* font, int glyph_index, int src_index, int w, int h);
+IMGUI_API bool      ImFontAtlasBuildUseDynamicGlyph(ImFontAtlas* atlas, const ImFont* font, const ImFontGlyph* glyph);  // Mark glyph as used by current frame, rasterize it if needed. Return false if it cannot be rendered.
+IMGUI_API void      ImFontAtlasBuildLoadDynamicGlyphsMissedByThreads(ImFontAtlas* atlas);                              // Rasterize glyphs other threads couldn't render (called by ImGui::EndDrawListThreads())
 
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
@@ -90,6 +90,7 @@ Index of this file:
 // Widgets
 static const float          DRAGDROP_HOLD_TO_OPEN_TIMER = 0.70f;    // Time for drag-hold to activate items accepting the ImGuiButtonFlags_PressedOnDragDropHold button behavior.
 static const float          DRAG_MOUSE_THRESHOLD_FACTOR = 0.50f;    // Multiplier for the default value of io.MouseDragThreshold to make DragFloat/DragInt react faster to mouse drags.
+static const int            PLOT_DECIMATION_MIN_SAMPLES_PER_PIXEL = 4;  // PlotLines/PlotHistogram switch to min/max decimation when there are more values than this per pixel column.
 
 // Those MIN/MAX values are not define because we need to point to them
 static const signed char    IM_S8_MIN  = -128;
@@ -1317,6 +1318,7 @@ void ImGui::ProgressBar(float fraction, const ImVec2& size_arg, const char* over
 
     if (is_indeterminate)
     {
+        RequestNextFrame();
         const float fill_width_n = 0.2f;
         fill_n0 = ImFmod(-fraction, 1.0f) * (1.0f + fill_width_n) - fill_width_n;
         fill_n1 = ImSaturate(fill_n0 + fill_width_n);
@@ -1677,6 +1679,8 @@ bool ImGui::SplitterBehavior(const ImRect& bb, ImGuiID id, ImGuiAxis axis, float
 
     if (held || (hovered && g.HoveredIdPreviousFrame == id && g.HoveredIdTimer >= hover_visibility_delay))
         SetMouseCursor(axis == ImGuiAxis_Y ? ImGuiMouseCursor_ResizeNS : ImGuiMouseCursor_ResizeEW);
+    else if (hovered)
+        RequestNextFrame((g.HoveredIdPreviousFrame == id) ? hover_visibility_delay - g.HoveredIdTimer : 0.0f);
 
     ImRect bb_render = bb;
     if (held)
@@ -5126,6 +5130,8 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
         {
             state->CursorAnim += io.DeltaTime;
             bool cursor_is_visible = (!g.IO.ConfigInputTextCursorBlink) || (state->CursorAnim <= 0.0f) || ImFmod(state->CursorAnim, 1.20f) <= 0.80f;
+            if (g.IO.ConfigInputTextCursorBlink)
+                RequestNextFrame((state->CursorAnim <= 0.0f) ? 0.80f - state->CursorAnim : cursor_is_visible ? 0.80f - ImFmod(state->CursorAnim, 1.20f) : 1.20f - ImFmod(state->CursorAnim, 1.20f));
             ImVec2 cursor_screen_pos = ImTrunc(draw_pos + cursor_offset - draw_scroll);
             ImRect cursor_screen_rect(cursor_screen_pos.x, cursor_screen_pos.y - g.FontSize + 0.5f, cursor_screen_pos.x + 1.0f, cursor_screen_pos.y - 1.5f);
             if (cursor_is_visible && cursor_screen_rect.Overlaps(clip_rect))
@@ -7186,6 +7192,70 @@ bool ImGui::ListBox(const char* label, int* current_item, const char* (*getter)(
 // - others https://github.com/ocornut/imgui/wiki/Useful-Extensions
 //-------------------------------------------------------------------------
 
+struct ImGuiPlotArrayGetterData
+{
+    const float* Values;
+    int Stride;
+
+    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
+};
+
+static float Plot_ArrayGetter(void* data, int idx)
+{
+    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
+    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
+    return v;
+}
+
+// Find smallest and largest values over the [idx_begin, idx_end) range of plotted indices (before applying values_offset). NaN values are ignored.
+// When plotting an array we scan memory directly, in at most two parts as values_offset may wrap around the end of the array.
+static bool PlotFindMinMax(float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, int idx_begin, int idx_end, int* out_idx_min, int* out_idx_max, float* out_v_min, float* out_v_max)
+{
+    int idx_min = -1, idx_max = -1;
+    float v_min = FLT_MAX, v_max = -FLT_MAX;
+    if (values_getter == &Plot_ArrayGetter)
+    {
+        ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
+        for (int idx = idx_begin; idx < idx_end; )
+        {
+            const int src_idx = (idx + values_offset) % values_count;
+            const int src_count = ImMin(idx_end - idx, values_count - src_idx);
+            const float* src_values = (const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)src_idx * plot_data->Stride);
+            int src_idx_min, src_idx_max;
+            if (ImFindMinMaxIndices(src_values, src_count, plot_data->Stride, &src_idx_min, &src_idx_max))
+            {
+                const float src_v_min = Plot_ArrayGetter(data, src_idx + src_idx_min);
+                const float src_v_max = Plot_ArrayGetter(data, src_idx + src_idx_max);
+                if (idx_min == -1 || src_v_min < v_min)
+                    { v_min = src_v_min; idx_min = idx + src_idx_min; }
+                if (idx_max == -1 || src_v_max > v_max)
+                    { v_max = src_v_max; idx_max = idx + src_idx_max; }
+            }
+            idx += src_count;
+        }
+    }
+    else
+    {
+        for (int idx = idx_begin; idx < idx_end; idx++)
+        {
+            const float v = values_getter(data, (idx + values_offset) % values_count);
+            if (v != v) // Ignore NaN values
+                continue;
+            if (idx_min == -1 || v < v_min)
+                { v_min = v; idx_min = idx; }
+            if (idx_max == -1 || v > v_max)
+                { v_max = v; idx_max = idx; }
+        }
+    }
+    if (idx_min == -1)
+        return false;
+    *out_idx_min = idx_min;
+    *out_idx_max = idx_max;
+    *out_v_min = v_min;
+    *out_v_max = v_max;
+    return true;
+}
+
 int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, const ImVec2& size_arg)
 {
     ImGuiContext& g = *GImGui;
@@ -7212,14 +7282,8 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     {
         float v_min = FLT_MAX;
         float v_max = -FLT_MAX;
-        for (int i = 0; i < values_count; i++)
-        {
-            const float v = values_getter(data, i);
-            if (v != v) // Ignore NaN values
-                continue;
-            v_min = ImMin(v_min, v);
-            v_max = ImMax(v_max, v);
-        }
+        int idx_min, idx_max;
+        PlotFindMinMax(values_getter, data, values_count, 0, 0, values_count, &idx_min, &idx_max, &v_min, &v_max);
         if (scale_min == FLT_MAX)
             scale_min = v_min;
         if (scale_max == FLT_MAX)
@@ -7251,41 +7315,93 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
             idx_hovered = v_idx;
         }
 
-        const float t_step = 1.0f / (float)res_w;
         const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
-
-        float v0 = values_getter(data, (0 + values_offset) % values_count);
-        float t0 = 0.0f;
-        ImVec2 tp0 = ImVec2( t0, 1.0f - ImSaturate((v0 - scale_min) * inv_scale) );                       // Point in the normalized space of our target rectangle
         float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (1 + scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);   // Where does the zero line stands
 
         const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
         const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
 
-        for (int n = 0; n < res_w; n++)
-        {
-            const float t1 = t0 + t_step;
-            const int v1_idx = (int)(t0 * item_count + 0.5f);
-            IM_ASSERT(v1_idx >= 0 && v1_idx < values_count);
-            const float v1 = values_getter(data, (v1_idx + values_offset + 1) % values_count);
-            const ImVec2 tp1 = ImVec2( t1, 1.0f - ImSaturate((v1 - scale_min) * inv_scale) );
-
-            // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
-            ImVec2 pos0 = ImLerp(inner_bb.Min, inner_bb.Max, tp0);
-            ImVec2 pos1 = ImLerp(inner_bb.Min, inner_bb.Max, (plot_type == ImGuiPlotType_Lines) ? tp1 : ImVec2(tp1.x, histogram_zero_line_t));
-            if (plot_type == ImGuiPlotType_Lines)
+        const int bucket_count = (int)inner_bb.GetWidth();
+        if (bucket_count > 0 && values_count > bucket_count * PLOT_DECIMATION_MIN_SAMPLES_PER_PIXEL)
+        {
+            // Min/max decimation: split values in one bucket per pixel column, and only keep the first/min/max/last values of each bucket.
+            // Buckets are scanned in place, so lines only build this envelope (at most 4 points per pixel column) for AddPolylineDecimated().
+            // Unlike subsampling this keeps peaks visible.
+            ImDrawList* draw_list = window->DrawList;
+            ImVector<ImVec2>& points = g.PlotLinesBuffer;
+            points.resize(0);
+            const float x_scale = inner_bb.GetWidth() / (float)item_count;
+            int points_hovered_begin = -1, points_hovered_end = -1;
+            for (int bucket_n = 0; bucket_n < bucket_count; bucket_n++)
             {
-                window->DrawList->AddLine(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                const int idx_begin = (int)((ImS64)values_count * bucket_n / bucket_count);
+                const int idx_end = (int)((ImS64)values_count * (bucket_n + 1) / bucket_count);
+                const bool bucket_hovered = (idx_hovered >= idx_begin && idx_hovered < idx_end);
+                int idx_min = idx_begin, idx_max = idx_begin;
+                float v_min = 0.0f, v_max = 0.0f;
+                const bool found = PlotFindMinMax(values_getter, data, values_count, values_offset, idx_begin, idx_end, &idx_min, &idx_max, &v_min, &v_max);
+                if (plot_type == ImGuiPlotType_Lines)
+                {
+                    if (bucket_hovered)
+                        points_hovered_begin = ImMax(points.Size - 1, 0); // Include segment from previous bucket
+                    const int idx_list[4] = { idx_begin, ImMin(idx_min, idx_max), ImMax(idx_min, idx_max), idx_end - 1 };
+                    for (int n = 0; n < 4; n++)
+                    {
+                        if (n > 0 && idx_list[n] == idx_list[n - 1])
+                            continue;
+                        const float v = values_getter(data, (idx_list[n] + values_offset) % values_count);
+                        points.push_back(ImVec2(inner_bb.Min.x + idx_list[n] * x_scale, ImLerp(inner_bb.Min.y, inner_bb.Max.y, 1.0f - ImSaturate((v - scale_min) * inv_scale))));
+                    }
+                    if (bucket_hovered)
+                        points_hovered_end = points.Size;
+                }
+                else if (plot_type == ImGuiPlotType_Histogram && found)
+                {
+                    // Cover everything between the zero line and the extreme values of the bucket
+                    const float y0 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, ImMin(1.0f - ImSaturate((v_max - scale_min) * inv_scale), histogram_zero_line_t));
+                    const float y1 = ImLerp(inner_bb.Min.y, inner_bb.Max.y, ImMax(1.0f - ImSaturate((v_min - scale_min) * inv_scale), histogram_zero_line_t));
+                    draw_list->AddRectFilled(ImVec2(inner_bb.Min.x + idx_begin * x_scale, y0), ImVec2(inner_bb.Min.x + idx_end * x_scale, y1), bucket_hovered ? col_hovered : col_base);
+                }
             }
-            else if (plot_type == ImGuiPlotType_Histogram)
+            if (plot_type == ImGuiPlotType_Lines)
             {
-                if (pos1.x >= pos0.x + 2.0f)
-                    pos1.x -= 1.0f;
-                window->DrawList->AddRectFilled(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                draw_list->AddPolylineDecimated(points.Data, points.Size, col_base, 1.0f);
+                if (points_hovered_begin != -1)
+                    draw_list->AddPolylineDecimated(points.Data + points_hovered_begin, points_hovered_end - points_hovered_begin, col_hovered, 1.0f);
             }
+        }
+        else
+        {
+            const float t_step = 1.0f / (float)res_w;
+            float v0 = values_getter(data, (0 + values_offset) % values_count);
+            float t0 = 0.0f;
+            ImVec2 tp0 = ImVec2( t0, 1.0f - ImSaturate((v0 - scale_min) * inv_scale) );                       // Point in the normalized space of our target rectangle
 
-            t0 = t1;
-            tp0 = tp1;
+            for (int n = 0; n < res_w; n++)
+            {
+                const float t1 = t0 + t_step;
+                const int v1_idx = (int)(t0 * item_count + 0.5f);
+                IM_ASSERT(v1_idx >= 0 && v1_idx < values_count);
+                const float v1 = values_getter(data, (v1_idx + values_offset + 1) % values_count);
+                const ImVec2 tp1 = ImVec2( t1, 1.0f - ImSaturate((v1 - scale_min) * inv_scale) );
+
+                // NB: Draw calls are merged together by the DrawList system. Still, we should render our batch are lower level to save a bit of CPU.
+                ImVec2 pos0 = ImLerp(inner_bb.Min, inner_bb.Max, tp0);
+                ImVec2 pos1 = ImLerp(inner_bb.Min, inner_bb.Max, (plot_type == ImGuiPlotType_Lines) ? tp1 : ImVec2(tp1.x, histogram_zero_line_t));
+                if (plot_type == ImGuiPlotType_Lines)
+                {
+                    window->DrawList->AddLine(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                }
+                else if (plot_type == ImGuiPlotType_Histogram)
+                {
+                    if (pos1.x >= pos0.x + 2.0f)
+                        pos1.x -= 1.0f;
+                    window->DrawList->AddRectFilled(pos0, pos1, idx_hovered == v1_idx ? col_hovered : col_base);
+                }
+
+                t0 = t1;
+                tp0 = tp1;
+            }
         }
     }
 
@@ -7301,21 +7417,6 @@ int ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_get
     return idx_hovered;
 }
 
-struct ImGuiPlotArrayGetterData
-{
-    const float* Values;
-    int Stride;
-
-    ImGuiPlotArrayGetterData(const float* values, int stride) { Values = values; Stride = stride; }
-};
-
-static float Plot_ArrayGetter(void* data, int idx)
-{
-    ImGuiPlotArrayGetterData* plot_data = (ImGuiPlotArrayGetterData*)data;
-    const float v = *(const float*)(const void*)((const unsigned char*)plot_data->Values + (size_t)idx * plot_data->Stride);
-    return v;
-}
-
 void ImGui::PlotLines(const char* label, const float* values, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size, int stride)
 {
     ImGuiPlotArrayGetterData data(values, stride);
@@ -7741,6 +7842,8 @@ bool ImGui::BeginMenuEx(const char* label, const char* icon, bool enabled)
             want_open = true;
         else if (!menu_is_open && hovered && g.HoveredIdTimer >= 0.30f && g.MouseStationaryTimer >= 0.30f) // Hover to open (timer fallback)
             want_open = true;
+        else if (!menu_is_open && hovered)
+            RequestNextFrame(0.30f - ImMin(g.HoveredIdTimer, g.MouseStationaryTimer));
         if (g.NavId == id && g.NavMoveDir == ImGuiDir_Right) // Nav-Right to open
         {
             want_open = want_open_nav_init = true;
@@ -8375,6 +8478,8 @@ static void ImGui::TabBarLayout(ImGuiTabBar* tab_bar)
         tab_bar->ScrollingSpeed = ImMax(tab_bar->ScrollingSpeed, ImFabs(tab_bar->ScrollingTarget - tab_bar->ScrollingAnim) / 0.3f);
         const bool teleport = (tab_bar->PrevFrameVisible + 1 < g.FrameCount) || (tab_bar->ScrollingTargetDistToVisibility > 10.0f * g.FontSize);
         tab_bar->ScrollingAnim = teleport ? tab_bar->ScrollingTarget : ImLinearSweep(tab_bar->ScrollingAnim, tab_bar->ScrollingTarget, g.IO.DeltaTime * tab_bar->ScrollingSpeed);
+        if (tab_bar->ScrollingAnim != tab_bar->ScrollingTarget)
+            RequestNextFrame();
     }
     else
     {
@@ -0,0 +1,613 @@
+// dear imgui: binary capture of ImDrawData, for offline replay of frames (benchmarking renderer backends, diagnosing rendering regressions)
+// (code)
+
+// Get the latest version at https://github.com/ocornut/imgui/tree/master/misc/capture
+
+// File layout (all values in native byte order, chunks and buffers aligned to 8 bytes):
+//   ImGuiCaptureFileHeader
+//   ImGuiCaptureChunkHeader + payload, repeated:
+//   - 'TEXT' texture:  ImGuiCaptureTextureHeader, pixels.
+//   - 'FRAM' frame:    ImGuiCaptureFrameHeader, then for each draw list:
+//                      ImGuiCaptureListHeader, ImGuiCaptureCmd[CmdCount], ImDrawVert[VtxCount], indices[IdxCount] (IdxSize bytes each), ImDrawRectInstance[RectCount].
+// Readers skip chunks of unknown types.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_internal.h"
+#include "imgui_capture.h"
+#include <stddef.h>     // offsetof
+#include <stdint.h>     // intptr_t
+
+#define IMGUI_CAPTURE_MAGIC             0x50434D49  // "IMCP"
+#define IMGUI_CAPTURE_VERSION           1
+#define IMGUI_CAPTURE_CHUNK_TEXTURE     0x54584554  // "TEXT"
+#define IMGUI_CAPTURE_CHUNK_FRAME       0x4D415246  // "FRAM"
+#define IMGUI_CAPTURE_CMD_RESET_RENDER_STATE    (1 << 0)
+#define IMGUI_CAPTURE_CMD_USER_CALLBACK         (1 << 1)
+#define IMGUI_CAPTURE_RENDERER_FLAGS            (ImGuiBackendFlags_RendererHasVtxOffset | ImGuiBackendFlags_RendererHasPackedIdx | ImGuiBackendFlags_RendererHasRectInstances)
+
+struct ImGuiCaptureFileHeader
+{
+    ImU32   Magic;
+    ImU32   Version;
+    ImU16   VtxSize;            // sizeof(ImDrawVert)
+    ImU8    VtxPosOffset;       // offsetof(ImDrawVert, pos)
+    ImU8    VtxUvOffset;        // offsetof(ImDrawVert, uv)
+    ImU8    VtxColOffset;       // offsetof(ImDrawVert, col)
+    ImU8    VtxPosFracBits;     // IM_DRAWVERT_POS_FRAC_BITS, 0 with float positions
+    ImU8    IdxSize;            // sizeof(ImDrawIdx)
+    ImU8    RectSize;           // sizeof(ImDrawRectInstance)
+    ImU32   RendererFlags;      // io.BackendFlags & IMGUI_CAPTURE_RENDERER_FLAGS of the capturing application: features its draw lists may use
+    ImU32   Reserved;
+};
+
+struct ImGuiCaptureChunkHeader
+{
+    ImU32   Type;
+    ImU32   Reserved;
+    ImU64   Size;               // Payload size, multiple of 8
+};
+
+struct ImGuiCaptureTextureHeader
+{
+    ImU64   TexID;
+    ImS32   Width;
+    ImS32   Height;
+    ImS32   BytesPerPixel;
+    ImS32   Reserved;
+};
+
+struct ImGuiCaptureFrameHeader
+{
+    ImVec2  DisplayPos;
+    ImVec2  DisplaySize;
+    ImVec2  FramebufferScale;
+    ImVec2  TexUvWhitePixel;    // Used to tessellate rectangle instances for renderers not supporting them
+    ImS32   CmdListsCount;
+    ImS32   Reserved;
+};
+
+struct ImGuiCaptureListHeader
+{
+    ImS32   CmdCount;
+    ImS32   VtxCount;
+    ImS32   IdxCount;
+    ImS32   RectCount;
+    ImS32   IdxSize;
+    ImS32   Reserved;
+};
+
+struct ImGuiCaptureCmd
+{
+    ImVec4  ClipRect;
+    ImU64   TexID;
+    ImU32   VtxOffset;
+    ImU32   IdxOffset;
+    ImU32   ElemCount;
+    ImU32   RectOffset;
+    ImU32   RectCount;
+    ImU32   Flags;              // IMGUI_CAPTURE_CMD_XXX
+};
+
+static inline size_t ImGuiCapture_Align(size_t size) { return (size + 7) & ~(size_t)7; }
+
+static void ImGuiCapture_InitFileHeader(ImGuiCaptureFileHeader* header)
+{
+    memset(header, 0, sizeof(*header));
+    header->Magic = IMGUI_CAPTURE_MAGIC;
+    header->Version = IMGUI_CAPTURE_VERSION;
+    header->VtxSize = (ImU16)sizeof(ImDrawVert);
+    header->VtxPosOffset = (ImU8)offsetof(ImDrawVert, pos);
+    header->VtxUvOffset = (ImU8)offsetof(ImDrawVert, uv);
+    header->VtxColOffset = (ImU8)offsetof(ImDrawVert, col);
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    header->VtxPosFracBits = (ImU8)IM_DRAWVERT_POS_FRAC_BITS;
+#endif
+    header->IdxSize = (ImU8)sizeof(ImDrawIdx);
+    header->RectSize = (ImU8)sizeof(ImDrawRectInstance);
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiCaptureWriter
+//-----------------------------------------------------------------------------
+
+ImGuiCaptureWriter::ImGuiCaptureWriter()
+{
+    WriteFunc = NULL;
+    WriteFuncUserData = NULL;
+    File = NULL;
+    HeaderWritten = Error = false;
+    FramesCount = 0;
+    BytesWritten = 0;
+    AtlasTexID = 0;
+    AtlasPixels = NULL;
+    AtlasWidth = AtlasHeight = 0;
+}
+
+ImGuiCaptureWriter::~ImGuiCaptureWriter()
+{
+    Close();
+}
+
+bool ImGuiCaptureWriter::Open(const char* filename)
+{
+    Close();
+    File = ImFileOpen(filename, "wb");
+    return File != NULL;
+}
+
+void ImGuiCaptureWriter::Close()
+{
+    if (File != NULL)
+        ImFileClose((ImFileHandle)File);
+    File = NULL;
+    HeaderWritten = Error = false;
+    FramesCount = 0;
+    BytesWritten = 0;
+    AtlasPixels = NULL;
+}
+
+bool ImGuiCaptureWriter::_Write(const void* data, size_t size)
+{
+    if (Error || size == 0)
+        return !Error;
+    if (WriteFunc != NULL)
+        Error = !WriteFunc(data, size, WriteFuncUserData);
+    else if (File != NULL)
+        Error = ImFileWrite(data, 1, (ImU64)size, (ImFileHandle)File) != (ImU64)size;
+    else
+        Error = true;
+    BytesWritten += size;
+    return !Error;
+}
+
+bool ImGuiCaptureWriter::_WritePadding(size_t size)
+{
+    static const char zeroes[8] = {};
+    return _Write(zeroes, ImGuiCapture_Align(size) - size);
+}
+
+bool ImGuiCaptureWriter::_WriteChunk(ImU32 type, const void* header, size_t header_size, size_t payload_size)
+{
+    if (!HeaderWritten)
+    {
+        ImGuiCaptureFileHeader file_header;
+        ImGuiCapture_InitFileHeader(&file_header);
+        file_header.RendererFlags = (GImGui != NULL) ? (ImU32)(GImGui->IO.BackendFlags & IMGUI_CAPTURE_RENDERER_FLAGS) : IMGUI_CAPTURE_RENDERER_FLAGS;
+        _Write(&file_header, sizeof(file_header));
+        HeaderWritten = true;
+    }
+    ImGuiCaptureChunkHeader chunk_header;
+    chunk_header.Type = type;
+    chunk_header.Reserved = 0;
+    chunk_header.Size = (ImU64)(header_size + payload_size);
+    _Write(&chunk_header, sizeof(chunk_header));
+    return _Write(header, header_size);
+}
+
+bool ImGuiCaptureWriter::WriteTexture(ImTextureID tex_id, const void* pixels, int width, int height, int bytes_per_pixel)
+{
+    IM_ASSERT(pixels != NULL && width > 0 && height > 0 && (bytes_per_pixel == 4 || bytes_per_pixel == 1));
+    const size_t pixels_size = (size_t)width * height * bytes_per_pixel;
+    ImGuiCaptureTextureHeader header;
+    header.TexID = (ImU64)(intptr_t)tex_id;
+    header.Width = width;
+    header.Height = height;
+    header.BytesPerPixel = bytes_per_pixel;
+    header.Reserved = 0;
+    _WriteChunk(IMGUI_CAPTURE_CHUNK_TEXTURE, &header, sizeof(header), ImGuiCapture_Align(pixels_size));
+    _Write(pixels, pixels_size);
+    return _WritePadding(pixels_size);
+}
+
+bool ImGuiCaptureWriter::WriteFrame(const ImDrawData* draw_data, ImFontAtlas* atlas)
+{
+    IM_ASSERT(draw_data != NULL && draw_data->Valid);
+
+    // Store atlas texture when it changed (we only compare identifier, pixels pointer and size: call WriteTexture() yourself if you modify pixels in place)
+    if (atlas != NULL)
+    {
+        const void* atlas_pixels = atlas->TexPixelsRGBA32 ? (const void*)atlas->TexPixelsRGBA32 : (const void*)atlas->TexPixelsAlpha8;
+        if (atlas_pixels != NULL && (atlas_pixels != AtlasPixels || AtlasTexID != (ImU64)(intptr_t)atlas->TexID || AtlasWidth != atlas->TexWidth || AtlasHeight != atlas->TexHeight))
+        {
+            WriteTexture(atlas->TexID, atlas_pixels, atlas->TexWidth, atlas->TexHeight, atlas->TexPixelsRGBA32 ? 4 : 1);
+            AtlasTexID = (ImU64)(intptr_t)atlas->TexID;
+            AtlasPixels = atlas_pixels;
+            AtlasWidth = atlas->TexWidth;
+            AtlasHeight = atlas->TexHeight;
+        }
+    }
+
+    // Calculate frame size first, so it may be streamed without seeking back
+    size_t payload_size = 0;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        payload_size += sizeof(ImGuiCaptureListHeader) + sizeof(ImGuiCaptureCmd) * (size_t)draw_list->CmdBuffer.Size;
+        payload_size += ImGuiCapture_Align(sizeof(ImDrawVert) * (size_t)draw_list->VtxBuffer.Size);
+        payload_size += ImGuiCapture_Align((size_t)draw_list->IdxSize * (size_t)draw_list->IdxBuffer.Size);
+        payload_size += ImGuiCapture_Align(sizeof(ImDrawRectInstance) * (size_t)draw_list->RectBuffer.Size);
+    }
+
+    ImGuiCaptureFrameHeader header;
+    header.DisplayPos = draw_data->DisplayPos;
+    header.DisplaySize = draw_data->DisplaySize;
+    header.FramebufferScale = draw_data->FramebufferScale;
+    header.TexUvWhitePixel = (draw_data->CmdLists.Size > 0 && draw_data->CmdLists[0]->_Data != NULL) ? draw_data->CmdLists[0]->_Data->TexUvWhitePixel : ImVec2(0.0f, 0.0f);
+    header.CmdListsCount = draw_data->CmdLists.Size;
+    header.Reserved = 0;
+    _WriteChunk(IMGUI_CAPTURE_CHUNK_FRAME, &header, sizeof(header), payload_size);
+
+    ImGuiCaptureCmd cmds[64];
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        ImGuiCaptureListHeader list_header;
+        list_header.CmdCount = draw_list->CmdBuffer.Size;
+        list_header.VtxCount = draw_list->VtxBuffer.Size;
+        list_header.IdxCount = draw_list->IdxBuffer.Size;
+        list_header.RectCount = draw_list->RectBuffer.Size;
+        list_header.IdxSize = draw_list->IdxSize;
+        list_header.Reserved = 0;
+        _Write(&list_header, sizeof(list_header));
+
+        // Commands, converted in batches
+        for (int cmd_n = 0; cmd_n < draw_list->CmdBuffer.Size; cmd_n += IM_ARRAYSIZE(cmds))
+        {
+            const int batch_count = ImMin(draw_list->CmdBuffer.Size - cmd_n, IM_ARRAYSIZE(cmds));
+            for (int batch_n = 0; batch_n < batch_count; batch_n++)
+            {
+                const ImDrawCmd* src = &draw_list->CmdBuffer.Data[cmd_n + batch_n];
+                ImGuiCaptureCmd* dst = &cmds[batch_n];
+                dst->ClipRect = src->ClipRect;
+                dst->TexID = (ImU64)(intptr_t)src->GetTexID();
+                dst->VtxOffset = src->VtxOffset;
+                dst->IdxOffset = src->IdxOffset;
+                dst->ElemCount = src->ElemCount;
+                dst->RectOffset = src->RectOffset;
+                dst->RectCount = src->RectCount;
+                dst->Flags = (src->UserCallback == ImDrawCallback_ResetRenderState) ? IMGUI_CAPTURE_CMD_RESET_RENDER_STATE : (src->UserCallback != NULL) ? IMGUI_CAPTURE_CMD_USER_CALLBACK : 0;
+            }
+            _Write(cmds, sizeof(ImGuiCaptureCmd) * (size_t)batch_count);
+        }
+
+        // Vertices
+        const size_t vtx_size = sizeof(ImDrawVert) * (size_t)draw_list->VtxBuffer.Size;
+        _Write(draw_list->VtxBuffer.Data, vtx_size);
+        _WritePadding(vtx_size);
+
+        // Indices, flattening segments
+        const size_t idx_size = (size_t)draw_list->IdxSize * (size_t)draw_list->IdxBuffer.Size;
+        unsigned int idx_n = 0;
+        for (const ImDrawIdxSegment& segment : draw_list->IdxSegments)
+        {
+            _Write((const char*)draw_list->IdxBuffer.Data + (size_t)idx_n * draw_list->IdxSize, (size_t)(segment.IdxOffset - idx_n) * draw_list->IdxSize);
+            _Write(segment.IdxBuffer.Data, (size_t)segment.IdxBuffer.Size * draw_list->IdxSize);
+            idx_n = segment.IdxOffset + (unsigned int)segment.IdxBuffer.Size;
+        }
+        _Write((const char*)draw_list->IdxBuffer.Data + (size_t)idx_n * draw_list->IdxSize, idx_size - (size_t)idx_n * draw_list->IdxSize);
+        _WritePadding(idx_size);
+
+        // Rectangle instances
+        const size_t rect_size = sizeof(ImDrawRectInstance) * (size_t)draw_list->RectBuffer.Size;
+        _Write(draw_list->RectBuffer.Data, rect_size);
+        _WritePadding(rect_size);
+    }
+
+    if (!Error)
+        FramesCount++;
+    return !Error;
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiCaptureReader
+//-----------------------------------------------------------------------------
+
+ImGuiCaptureReader::ImGuiCaptureReader()
+{
+    Data = NULL;
+    DataSize = 0;
+    FramesCount = 0;
+    CapturedRendererFlags = RendererFlags = ImGuiBackendFlags_None;
+    MissingTexID = 0;
+    ConvertSharedData = NULL;
+}
+
+ImGuiCaptureReader::~ImGuiCaptureReader()
+{
+    Clear();
+}
+
+// Buffers of our draw lists point into capture data: detach them before the draw list frees them.
+static void ImGuiCapture_DetachBuffers(ImDrawList* draw_list)
+{
+    draw_list->VtxBuffer.Data = NULL;
+    draw_list->VtxBuffer.Size = draw_list->VtxBuffer.Capacity = 0;
+    draw_list->IdxBuffer.Data = NULL;
+    draw_list->IdxBuffer.Size = draw_list->IdxBuffer.Capacity = 0;
+    draw_list->RectBuffer.Data = NULL;
+    draw_list->RectBuffer.Size = draw_list->RectBuffer.Capacity = 0;
+}
+
+template<typename T>
+static void ImGuiCapture_AttachBuffer(ImVector<T>& buffer, const char* data, int count)
+{
+    buffer.Data = (T*)(void*)data;
+    buffer.Size = buffer.Capacity = count;
+}
+
+// Rebuild 'src' for a renderer lacking some of the features it uses (see ImGuiCaptureReader::Init()):
+// - Indices are widened to ImDrawIdx, and rectangle instances are tessellated unless the renderer supports them.
+// - Vertices are copied per command, so ImDrawCmd::VtxOffset is only used when the renderer supports it.
+// Return false if 16-bit indices can't address the vertices without ImDrawCmd::VtxOffset.
+static bool ImGuiCapture_ConvertDrawList(ImDrawList* dst, const ImDrawList* src, ImGuiBackendFlags renderer_flags)
+{
+    dst->_ResetForNewFrame();
+    dst->Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill;
+    if (renderer_flags & ImGuiBackendFlags_RendererHasVtxOffset)
+        dst->Flags |= ImDrawListFlags_AllowVtxOffset;
+    if (renderer_flags & ImGuiBackendFlags_RendererHasRectInstances)
+        dst->Flags |= ImDrawListFlags_AllowRectInstances;
+    for (const ImDrawCmd& src_cmd : src->CmdBuffer)
+    {
+        if (src_cmd.UserCallback != NULL)
+        {
+            dst->AddCallback(src_cmd.UserCallback, NULL);
+            continue;
+        }
+        if (memcmp(&src_cmd.ClipRect, &dst->_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
+        {
+            dst->_CmdHeader.ClipRect = src_cmd.ClipRect;
+            dst->_OnChangedClipRect();
+        }
+        if (src_cmd.TextureId != dst->_CmdHeader.TextureId)
+        {
+            dst->_CmdHeader.TextureId = src_cmd.TextureId;
+            dst->_OnChangedTextureID();
+        }
+
+        // Rectangle instances are re-submitted one by one, falling back to tessellation as ImDrawList::AddRecording() does
+        for (unsigned int rect_n = src_cmd.RectOffset; rect_n < src_cmd.RectOffset + src_cmd.RectCount; rect_n++)
+        {
+            const ImDrawRectInstance& rect = src->RectBuffer.Data[rect_n];
+            const ImDrawFlags rect_flags = (rect.Flags & 0x0F) ? (ImDrawFlags)((rect.Flags & 0x0F) << 4) : ImDrawFlags_RoundCornersNone;
+            if (rect.Flags & (1 << 4))
+                dst->Flags |= ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill;
+            else
+                dst->Flags &= ~(ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill);
+            if ((dst->Flags & ImDrawListFlags_AllowRectInstances) && dst->_TryAddRectInstance(rect.Min, rect.Max, rect.Col, rect.Rounding, rect_flags, rect.Thickness))
+                continue;
+            if (rect.Thickness > 0.0f)
+            {
+                dst->PathRect(rect.Min, rect.Max, rect.Rounding, rect_flags);
+                dst->PathStroke(rect.Col, ImDrawFlags_Closed, rect.Thickness);
+            }
+            else
+            {
+                dst->AddRectFilled(rect.Min, rect.Max, rect.Col, rect.Rounding, rect_flags);
+            }
+        }
+        if (src_cmd.ElemCount == 0)
+            continue;
+
+        // Triangles: copy the range of vertices used by the command, and rebase its indices
+        unsigned int vtx_min = (unsigned int)-1, vtx_max = 0;
+        for (unsigned int idx_n = src_cmd.IdxOffset; idx_n < src_cmd.IdxOffset + src_cmd.ElemCount; idx_n++)
+        {
+            const unsigned int vtx_n = src->_GetIdx((int)idx_n);
+            vtx_min = ImMin(vtx_min, vtx_n);
+            vtx_max = ImMax(vtx_max, vtx_n);
+        }
+        const int vtx_count = (int)(vtx_max - vtx_min + 1);
+        if (sizeof(ImDrawIdx) == 2 && !(dst->Flags & ImDrawListFlags_AllowVtxOffset) && dst->_VtxCurrentIdx + vtx_count > (1 << 16))
+            return false;
+        dst->PrimReserve((int)src_cmd.ElemCount, vtx_count);
+        memcpy(dst->_VtxWritePtr, src->VtxBuffer.Data + src_cmd.VtxOffset + vtx_min, (size_t)vtx_count * sizeof(ImDrawVert));
+        const unsigned int idx_base = dst->_VtxCurrentIdx - vtx_min;
+        for (unsigned int idx_n = 0; idx_n < src_cmd.ElemCount; idx_n++)
+            dst->_IdxWritePtr[idx_n] = (ImDrawIdx)(src->_GetIdx((int)(src_cmd.IdxOffset + idx_n)) + idx_base);
+        dst->_VtxWritePtr += vtx_count;
+        dst->_IdxWritePtr += src_cmd.ElemCount;
+        dst->_VtxCurrentIdx += vtx_count;
+    }
+    dst->_PopUnusedDrawCmd();
+    return true;
+}
+
+void ImGuiCaptureReader::Clear()
+{
+    for (ImDrawList* draw_list : DrawLists)
+    {
+        ImGuiCapture_DetachBuffers(draw_list);
+        IM_DELETE(draw_list);
+    }
+    DrawLists.clear();
+    for (ImDrawList* draw_list : ConvertedDrawLists)
+        IM_DELETE(draw_list);
+    ConvertedDrawLists.clear();
+    if (ConvertSharedData != NULL)
+        IM_DELETE(ConvertSharedData);
+    ConvertSharedData = NULL;
+    DrawData.Clear();
+    FrameOffsets.clear();
+    FrameTexturesCount.clear();
+    Textures.clear();
+    Data = NULL;
+    DataSize = 0;
+    FramesCount = 0;
+}
+
+bool ImGuiCaptureReader::Init(const void* data, size_t data_size, ImGuiBackendFlags renderer_flags)
+{
+    Clear();
+    ImGuiCaptureFileHeader expected_header;
+    ImGuiCapture_InitFileHeader(&expected_header);
+    if (((intptr_t)data & 7) != 0 || data_size < sizeof(ImGuiCaptureFileHeader) || memcmp(data, &expected_header, offsetof(ImGuiCaptureFileHeader, RendererFlags)) != 0)
+        return false;
+    Data = (const char*)data;
+    DataSize = data_size;
+    CapturedRendererFlags = (ImGuiBackendFlags)(((const ImGuiCaptureFileHeader*)data)->RendererFlags & IMGUI_CAPTURE_RENDERER_FLAGS);
+    RendererFlags = renderer_flags;
+
+    // Index chunks
+    size_t offset = sizeof(ImGuiCaptureFileHeader);
+    while (offset + sizeof(ImGuiCaptureChunkHeader) <= data_size)
+    {
+        const ImGuiCaptureChunkHeader* chunk = (const ImGuiCaptureChunkHeader*)(const void*)(Data + offset);
+        const size_t payload_offset = offset + sizeof(ImGuiCaptureChunkHeader);
+        if (chunk->Size > (ImU64)(data_size - payload_offset) || (chunk->Size & 7) != 0)
+            break; // Truncated (e.g. application still running or crashed): keep what we have
+        if (chunk->Type == IMGUI_CAPTURE_CHUNK_TEXTURE && chunk->Size >= sizeof(ImGuiCaptureTextureHeader))
+        {
+            const ImGuiCaptureTextureHeader* tex_header = (const ImGuiCaptureTextureHeader*)(const void*)(Data + payload_offset);
+            if (tex_header->Width > 0 && tex_header->Height > 0 && (tex_header->BytesPerPixel == 4 || tex_header->BytesPerPixel == 1) &&
+                (ImU64)tex_header->Width * (ImU64)tex_header->Height * (ImU64)tex_header->BytesPerPixel <= chunk->Size - sizeof(ImGuiCaptureTextureHeader))
+            {
+                ImGuiCaptureTexture tex;
+                tex.CapturedTexID = tex_header->TexID;
+                tex.Width = tex_header->Width;
+                tex.Height = tex_header->Height;
+                tex.BytesPerPixel = tex_header->BytesPerPixel;
+                tex.Pixels = tex_header + 1;
+                tex.TexID = 0;
+                Textures.push_back(tex);
+            }
+        }
+        else if (chunk->Type == IMGUI_CAPTURE_CHUNK_FRAME && chunk->Size >= sizeof(ImGuiCaptureFrameHeader))
+        {
+            FrameOffsets.push_back((ImU64)offset);
+            FrameTexturesCount.push_back(Textures.Size);
+        }
+        offset = payload_offset + (size_t)chunk->Size;
+    }
+    FramesCount = FrameOffsets.Size;
+
+    // Draw lists using features the renderer doesn't support will be converted by GetFrame()
+    if (CapturedRendererFlags & ~RendererFlags)
+    {
+        ConvertSharedData = IM_NEW(ImDrawListSharedData)();
+        ConvertSharedData->CurveTessellationTol = 1.25f;
+        ConvertSharedData->SetCircleTessellationMaxError(0.30f);
+    }
+    return true;
+}
+
+ImDrawData* ImGuiCaptureReader::GetFrame(int frame_n)
+{
+    IM_ASSERT(frame_n >= 0 && frame_n < FramesCount);
+    const ImGuiCaptureChunkHeader* chunk = (const ImGuiCaptureChunkHeader*)(const void*)(Data + FrameOffsets[frame_n]);
+    const char* p = (const char*)(chunk + 1);
+    const char* p_end = p + chunk->Size;
+    const ImGuiCaptureFrameHeader* header = (const ImGuiCaptureFrameHeader*)(const void*)p;
+    p += sizeof(ImGuiCaptureFrameHeader);
+
+    DrawData.Clear();
+    DrawData.DisplayPos = header->DisplayPos;
+    DrawData.DisplaySize = header->DisplaySize;
+    DrawData.FramebufferScale = header->FramebufferScale;
+    if (header->CmdListsCount < 0)
+        return NULL;
+    while (DrawLists.Size < header->CmdListsCount)
+        DrawLists.push_back(IM_NEW(ImDrawList)(NULL));
+    if (ConvertSharedData != NULL)
+        ConvertSharedData->TexUvWhitePixel = header->TexUvWhitePixel;
+
+    // Textures stored before this frame, latest first (an atlas may have been rebuilt under the same identifier)
+    const int textures_count = FrameTexturesCount[frame_n];
+    ImU64 last_captured_tex_id = 0;
+    ImTextureID last_tex_id = MissingTexID;
+    bool last_tex_valid = false;
+
+    for (int list_n = 0; list_n < header->CmdListsCount; list_n++)
+    {
+        ImDrawList* draw_list = DrawLists[list_n];
+        ImGuiCapture_DetachBuffers(draw_list);
+        draw_list->CmdBuffer.resize(0);
+
+        if (p_end - p < (ptrdiff_t)sizeof(ImGuiCaptureListHeader))
+            return NULL;
+        const ImGuiCaptureListHeader* list_header = (const ImGuiCaptureListHeader*)(const void*)p;
+        p += sizeof(ImGuiCaptureListHeader);
+        if (list_header->CmdCount < 0 || list_header->VtxCount < 0 || list_header->IdxCount < 0 || list_header->RectCount < 0 || (list_header->IdxSize != 2 && list_header->IdxSize != 4))
+            return NULL;
+        const size_t cmd_size = sizeof(ImGuiCaptureCmd) * (size_t)list_header->CmdCount;
+        const size_t vtx_size = ImGuiCapture_Align(sizeof(ImDrawVert) * (size_t)list_header->VtxCount);
+        const size_t idx_size = ImGuiCapture_Align((size_t)list_header->IdxSize * (size_t)list_header->IdxCount);
+        const size_t rect_size = ImGuiCapture_Align(sizeof(ImDrawRectInstance) * (size_t)list_header->RectCount);
+        if ((size_t)(p_end - p) < cmd_size + vtx_size + idx_size + rect_size || list_header->IdxSize > (int)sizeof(ImDrawIdx))
+            return NULL;
+
+        const ImGuiCaptureCmd* src_cmds = (const ImGuiCaptureCmd*)(const void*)p;
+        p += cmd_size;
+        ImGuiCapture_AttachBuffer(draw_list->VtxBuffer, p, list_header->VtxCount);
+        p += vtx_size;
+        ImGuiCapture_AttachBuffer(draw_list->IdxBuffer, p, list_header->IdxCount);
+        p += idx_size;
+        ImGuiCapture_AttachBuffer(draw_list->RectBuffer, p, list_header->RectCount);
+        p += rect_size;
+        draw_list->IdxSize = list_header->IdxSize;
+        draw_list->IdxSegments.resize(0);
+
+        draw_list->CmdBuffer.reserve(list_header->CmdCount);
+        bool uses_vtx_offset = false;
+        for (int cmd_n = 0; cmd_n < list_header->CmdCount; cmd_n++)
+        {
+            const ImGuiCaptureCmd* src = &src_cmds[cmd_n];
+            if (src->Flags & IMGUI_CAPTURE_CMD_USER_CALLBACK)
+                continue;
+            if ((ImU64)src->VtxOffset > (ImU64)list_header->VtxCount || (ImU64)src->IdxOffset + src->ElemCount > (ImU64)list_header->IdxCount || (ImU64)src->RectOffset + src->RectCount > (ImU64)list_header->RectCount)
+                return NULL;
+
+            // Indices must address vertices past the VtxOffset of their command, so a corrupted capture can't make the renderer read out of bounds
+            const ImU32 vtx_limit = (ImU32)list_header->VtxCount - src->VtxOffset;
+            for (ImU32 idx_n = src->IdxOffset; idx_n < src->IdxOffset + src->ElemCount; idx_n++)
+                if (draw_list->_GetIdx((int)idx_n) >= vtx_limit)
+                    return NULL;
+
+            if (!last_tex_valid || src->TexID != last_captured_tex_id)
+            {
+                last_captured_tex_id = src->TexID;
+                last_tex_id = MissingTexID;
+                last_tex_valid = true;
+                for (int tex_n = textures_count - 1; tex_n >= 0; tex_n--)
+                    if (Textures[tex_n].CapturedTexID == src->TexID)
+                    {
+                        last_tex_id = Textures[tex_n].TexID;
+                        break;
+                    }
+            }
+            ImDrawCmd cmd;
+            cmd.ClipRect = src->ClipRect;
+            cmd.TextureId = last_tex_id;
+            cmd.VtxOffset = src->VtxOffset;
+            cmd.IdxOffset = src->IdxOffset;
+            cmd.ElemCount = src->ElemCount;
+            cmd.RectOffset = src->RectOffset;
+            cmd.RectCount = src->RectCount;
+            if (src->Flags & IMGUI_CAPTURE_CMD_RESET_RENDER_STATE)
+                cmd.UserCallback = ImDrawCallback_ResetRenderState;
+            draw_list->CmdBuffer.push_back(cmd);
+            uses_vtx_offset |= (src->VtxOffset != 0);
+        }
+
+        // Convert draw lists using features the renderer doesn't support
+        const bool needs_conversion = ConvertSharedData != NULL &&
+            ((draw_list->IdxSize != (int)sizeof(ImDrawIdx) && !(RendererFlags & ImGuiBackendFlags_RendererHasPackedIdx)) ||
+            (draw_list->RectBuffer.Size > 0 && !(RendererFlags & ImGuiBackendFlags_RendererHasRectInstances)) ||
+            (uses_vtx_offset && !(RendererFlags & ImGuiBackendFlags_RendererHasVtxOffset)));
+        if (needs_conversion)
+        {
+            while (ConvertedDrawLists.Size <= list_n)
+                ConvertedDrawLists.push_back(IM_NEW(ImDrawList)(ConvertSharedData));
+            if (!ImGuiCapture_ConvertDrawList(ConvertedDrawLists[list_n], draw_list, RendererFlags))
+                return NULL;
+            draw_list = ConvertedDrawLists[list_n];
+        }
+        DrawData.CmdLists.push_back(draw_list);
+        DrawData.CmdListsCount++;
+        DrawData.TotalVtxCount += draw_list->VtxBuffer.Size;
+        DrawData.TotalIdxCount += draw_list->IdxBuffer.Size;
+    }
+    DrawData.Valid = true;
+    return &DrawData;
+}
+
+#endif // #ifndef IMGUI_DISABLE
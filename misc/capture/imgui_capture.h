@@ -0,0 +1,102 @@
+// dear imgui: binary capture of ImDrawData, for offline replay of frames (benchmarking renderer backends, diagnosing rendering regressions)
+// (headers)
+
+// Usage (capture, after ImGui::Render()):
+//   static ImGuiCaptureWriter writer;
+//   if (!writer.IsOpen()) writer.Open("frames.imcap");
+//   writer.WriteFrame(ImGui::GetDrawData(), io.Fonts);
+//   [...]
+//   writer.Close();
+// Usage (replay):
+//   ImGuiCaptureReader reader;
+//   reader.Init(data, data_size, io.BackendFlags);   // e.g. memory-mapped file contents, must stay valid while the reader is used. Call after initializing your renderer.
+//   for (ImGuiCaptureTexture& tex : reader.Textures) tex.TexID = [create texture from tex.Pixels/Width/Height/BytesPerPixel];
+//   for (int n = 0; n < reader.FramesCount; n++) MyRenderFunction(reader.GetFrame(n));
+// See examples/example_null_replay/ for a tool replaying captures with imgui_impl_softraster or imgui_impl_opengl3 and reporting per-frame render cost.
+
+// About the format:
+// - A file is a header followed by chunks: texture contents, and one chunk per frame with draw lists, commands, vertices, indices and rectangle instances.
+// - Buffers are stored as they are in memory, aligned to 8 bytes: writing a frame is a few write calls and replaying a frame doesn't copy
+//   vertices/indices/rectangle instances. The file is therefore tied to the ImDrawVert/ImDrawIdx layout and byte order of the application
+//   which wrote it: ImGuiCaptureReader::Init() fails if they differ.
+// - Draw lists keep their ImDrawList::IdxSize, ImDrawCmd::VtxOffset and rectangle instances. The file header records which of ImGuiBackendFlags_RendererHasPackedIdx,
+//   ImGuiBackendFlags_RendererHasRectInstances and ImGuiBackendFlags_RendererHasVtxOffset the capturing renderer had. On replay, draw lists using features
+//   missing from the flags passed to ImGuiCaptureReader::Init() are converted by GetFrame(): indices are widened, rectangle instances are tessellated.
+//   Converted draw lists are copied, so their replay cost differs from the captured application's.
+// - Index buffer segments (ImDrawList::IdxSegments[]) are flattened into a single index buffer when writing.
+// - Textures identifiers are stored as 64-bit values. Font atlas contents are stored whenever the atlas texture changes, other textures
+//   may be stored with WriteTexture(). On replay, commands use the ImGuiCaptureTexture::TexID you assigned, or MissingTexID.
+//   Glyphs rasterized on demand after the atlas was stored (ImFontAtlasFlags_DynamicGlyphs, see ImFontAtlas::TexUpdates) are not captured.
+// - User callbacks can't be stored: commands with a callback are dropped on replay, except ImDrawCallback_ResetRenderState.
+
+#pragma once
+#include "imgui.h"      // IMGUI_API
+#ifndef IMGUI_DISABLE
+
+// Forward declarations
+struct ImFontAtlas;
+
+// Output function, return false on error. Default: write to the file opened with ImGuiCaptureWriter::Open().
+typedef bool (*ImGuiCaptureWriteFunc)(const void* data, size_t size, void* user_data);
+
+struct ImGuiCaptureWriter
+{
+    ImGuiCaptureWriteFunc   WriteFunc;          // Set to output elsewhere than in a file (e.g. a socket or memory buffer). File header is written before first frame.
+    void*                   WriteFuncUserData;
+    void*                   File;               // ImFileHandle opened by Open()
+    bool                    HeaderWritten;
+    bool                    Error;              // Set when a write failed. Further writes are ignored.
+    int                     FramesCount;        // Number of frames written
+    ImU64                   BytesWritten;
+    ImU64                   AtlasTexID;         // Font atlas state when last written, to detect changes
+    const void*             AtlasPixels;
+    int                     AtlasWidth, AtlasHeight;
+
+    IMGUI_API ImGuiCaptureWriter();
+    IMGUI_API ~ImGuiCaptureWriter();
+    IMGUI_API bool          Open(const char* filename);
+    IMGUI_API void          Close();
+    bool                    IsOpen() const      { return File != NULL || WriteFunc != NULL; }
+    IMGUI_API bool          WriteFrame(const ImDrawData* draw_data, ImFontAtlas* atlas = NULL);  // Also store atlas texture contents when they changed (needs atlas->TexPixelsRGBA32 or TexPixelsAlpha8 to be available)
+    IMGUI_API bool          WriteTexture(ImTextureID tex_id, const void* pixels, int width, int height, int bytes_per_pixel); // Store texture contents, used by next frames. bytes_per_pixel: 4 (RGBA32) or 1 (Alpha8)
+
+    // [Internal]
+    IMGUI_API bool          _Write(const void* data, size_t size);
+    IMGUI_API bool          _WriteChunk(ImU32 type, const void* header, size_t header_size, size_t payload_size);
+    IMGUI_API bool          _WritePadding(size_t size);
+};
+
+// A texture stored in a capture
+struct ImGuiCaptureTexture
+{
+    ImU64                   CapturedTexID;      // Texture identifier at the time of capture
+    int                     Width, Height;
+    int                     BytesPerPixel;      // 4: RGBA32, 1: Alpha8
+    const void*             Pixels;             // Points into capture data
+    ImTextureID             TexID;              // Set by you after ImGuiCaptureReader::Init(): identifier to use on replay.
+};
+
+struct ImGuiCaptureReader
+{
+    const char*             Data;
+    size_t                  DataSize;
+    int                     FramesCount;
+    ImGuiBackendFlags       CapturedRendererFlags;  // Renderer features the capture may use (ImGuiBackendFlags_RendererHasVtxOffset, _RendererHasPackedIdx, _RendererHasRectInstances)
+    ImGuiBackendFlags       RendererFlags;      // Renderer features available on replay, passed to Init()
+    ImVector<ImU64>         FrameOffsets;       // Offset of each frame chunk in Data
+    ImVector<int>           FrameTexturesCount; // Number of textures stored before each frame
+    ImVector<ImGuiCaptureTexture> Textures;
+    ImTextureID             MissingTexID;       // Used by commands whose texture wasn't stored
+    ImDrawData              DrawData;           // Output of GetFrame()
+    ImVector<ImDrawList*>   DrawLists;          // Draw lists of DrawData. Their vertex/index/rectangle buffers point into capture data!
+    ImVector<ImDrawList*>   ConvertedDrawLists; // Draw lists of DrawData converted for the renderer. They own their buffers.
+    ImDrawListSharedData*   ConvertSharedData;  // Used to tessellate converted draw lists, only allocated when CapturedRendererFlags has features missing from RendererFlags
+
+    IMGUI_API ImGuiCaptureReader();
+    IMGUI_API ~ImGuiCaptureReader();
+    IMGUI_API bool          Init(const void* data, size_t data_size, ImGuiBackendFlags renderer_flags);  // Return false if data is not a valid capture for this build. 'data' must be aligned to 8 bytes and stay valid. 'renderer_flags': io.BackendFlags of the replaying renderer.
+    IMGUI_API void          Clear();
+    IMGUI_API ImDrawData*   GetFrame(int frame_n);                      // Return NULL if frame data is invalid, or cannot be converted for the renderer. Returned ImDrawData is valid until next call. Don't resize/modify its buffers (e.g. DeIndexAllBuffers())!
+};
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,1079 @@
+// dear imgui: remote streaming of ImDrawData to a viewer, with inputs sent back (e.g. tools running on headless machines, viewed from thin clients)
+// (code)
+
+// Get the latest version at https://github.com/ocornut/imgui/tree/master/misc/remote
+
+// Messages: ImGuiRemoteMsgHeader + payload. Payloads are byte streams of fixed size values (native byte order) and varints.
+// - Application -> viewer:
+//   - Hello:   ImGuiRemoteHello (layout of ImDrawVert/ImDrawIdx, checked by viewer).
+//   - Texture: u64 texture id, varint width/height/bytes per pixel, pixels (compressed words).
+//   - Frame:   ImGuiRemoteFrameHeader, then for each draw list:
+//              u8 0 + u64 hash:    same as draw list of previous frame with this hash.
+//              u8 1 + u64 hash:    new draw list: varint commands/vertices/indices/rectangles count, commands (compressed words),
+//                                  varint blocks count, then for each block: u8 type (+ 0x80 when sent), u64 hash, varint elements count,
+//                                  and when sent: vertices/rectangles (compressed words) or indices (zigzag varint deltas).
+// - Viewer -> application:
+//   - Display: ImVec2 display size, ImVec2 framebuffer scale.
+//   - Inputs:  varint count, then for each input event: u8 type and its fields.
+// "Compressed words": each 32-bit word is XORed with the same word of previous element, then written as a varint,
+// with runs of zero words written as a zero byte followed by a varint count. Unchanged colors/UV and nearby positions are cheap.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_internal.h"
+#include "imgui_remote.h"
+#include <stddef.h>     // offsetof
+#include <stdint.h>     // intptr_t
+#if !defined(_WIN32)
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+#define IMGUI_REMOTE_VERSION            1
+#define IMGUI_REMOTE_BLOCK_VTX_MASK     0x3F    // Content-defined boundaries: average block size is (mask + 1) elements, before clamping to MIN/MAX
+#define IMGUI_REMOTE_BLOCK_IDX_MASK     0x7F
+#define IMGUI_REMOTE_BLOCK_RECT_MASK    0x0F
+#define IMGUI_REMOTE_BLOCK_MIN          8
+#define IMGUI_REMOTE_BLOCK_MAX          1024
+
+enum ImGuiRemoteMsgType
+{
+    ImGuiRemoteMsgType_Hello = 1,
+    ImGuiRemoteMsgType_Texture,
+    ImGuiRemoteMsgType_Frame,
+    ImGuiRemoteMsgType_Display,
+    ImGuiRemoteMsgType_Inputs,
+};
+
+enum ImGuiRemoteBlockType
+{
+    ImGuiRemoteBlockType_Vtx,
+    ImGuiRemoteBlockType_Idx,
+    ImGuiRemoteBlockType_Rect,
+};
+
+struct ImGuiRemoteMsgHeader
+{
+    ImU32   Type;
+    ImU32   Size;
+};
+
+struct ImGuiRemoteHello
+{
+    ImU32   Version;
+    ImU32   VtxSize;
+    ImU32   IdxSize;
+    ImU32   RectSize;
+};
+
+struct ImGuiRemoteFrameHeader
+{
+    ImVec2  DisplayPos;
+    ImVec2  DisplaySize;
+    ImVec2  FramebufferScale;
+    ImS32   CmdListsCount;
+    ImS32   MouseCursor;
+};
+
+// Commands are sent as words
+struct ImGuiRemoteCmd
+{
+    ImVec4  ClipRect;
+    ImU32   TexID[2];
+    ImU32   VtxOffset;
+    ImU32   IdxOffset;
+    ImU32   ElemCount;
+    ImU32   RectOffset;
+    ImU32   RectCount;
+    ImU32   Flags;      // 1: ImDrawCallback_ResetRenderState, 2: other user callback
+};
+
+// Draw list of previous/current frame on viewer side
+struct ImGuiRemoteDrawList
+{
+    ImU64                       Hash;
+    ImDrawList*                 DrawList;
+    ImVector<ImGuiRemoteBlock>  Blocks;
+    ImVector<ImU64>             CmdTexIDs;
+
+    ImGuiRemoteDrawList()       { Hash = 0; DrawList = IM_NEW(ImDrawList)(NULL); }
+    ~ImGuiRemoteDrawList()      { IM_DELETE(DrawList); }
+};
+
+IM_STATIC_ASSERT(sizeof(ImDrawVert) % 4 == 0);
+IM_STATIC_ASSERT(sizeof(ImDrawRectInstance) % 4 == 0);
+IM_STATIC_ASSERT(sizeof(ImGuiRemoteCmd) % 4 == 0);
+
+//-----------------------------------------------------------------------------
+// Encoding helpers
+//-----------------------------------------------------------------------------
+
+static inline void ImGuiRemote_PutBytes(ImVector<char>* out, const void* data, size_t size)
+{
+    const int offset = out->Size;
+    out->resize(out->Size + (int)size);
+    memcpy(out->Data + offset, data, size);
+}
+
+static inline void ImGuiRemote_PutU8(ImVector<char>* out, ImU32 v)
+{
+    out->push_back((char)v);
+}
+
+static inline void ImGuiRemote_PutU64(ImVector<char>* out, ImU64 v)
+{
+    ImGuiRemote_PutBytes(out, &v, sizeof(v));
+}
+
+static inline void ImGuiRemote_PutVarint(ImVector<char>* out, ImU32 v)
+{
+    while (v >= 0x80)
+    {
+        out->push_back((char)(v | 0x80));
+        v >>= 7;
+    }
+    out->push_back((char)v);
+}
+
+// Reader over a message payload. Reading past the end sets 'Error' and returns zeroes.
+struct ImGuiRemoteReader
+{
+    const char* P;
+    const char* End;
+    bool        Error;
+
+    ImGuiRemoteReader(const char* p, ImU32 size) { P = p; End = p + size; Error = false; }
+    void Get(void* dst, size_t size)
+    {
+        if ((size_t)(End - P) < size) { Error = true; memset(dst, 0, size); return; }
+        memcpy(dst, P, size);
+        P += size;
+    }
+    ImU32 GetU8()   { if (P >= End) { Error = true; return 0; } return (ImU8)*P++; }
+    ImU64 GetU64()  { ImU64 v; Get(&v, sizeof(v)); return v; }
+    ImU32 GetVarint()
+    {
+        ImU32 v = 0;
+        for (int shift = 0; shift < 35; shift += 7)
+        {
+            if (P >= End) { Error = true; return 0; }
+            const ImU32 b = (ImU8)*P++;
+            v |= (b & 0x7F) << shift;
+            if (b < 0x80)
+                return v;
+        }
+        Error = true;
+        return 0;
+    }
+};
+
+// Words are XORed with the same word of previous element (every 'stride' words)
+static void ImGuiRemote_PutWords(ImVector<char>* out, const ImU32* words, int count, int stride)
+{
+    for (int n = 0; n < count; )
+    {
+        const ImU32 v = (n >= stride) ? words[n] ^ words[n - stride] : words[n];
+        if (v != 0)
+        {
+            ImGuiRemote_PutVarint(out, v);
+            n++;
+            continue;
+        }
+        int run = 1;
+        while (n + run < count && words[n + run] == ((n + run >= stride) ? words[n + run - stride] : 0))
+            run++;
+        ImGuiRemote_PutU8(out, 0);
+        ImGuiRemote_PutVarint(out, (ImU32)(run - 1));
+        n += run;
+    }
+}
+
+static void ImGuiRemote_GetWords(ImGuiRemoteReader* in, ImU32* words, int count, int stride)
+{
+    for (int n = 0; n < count && !in->Error; )
+    {
+        ImU32 v = in->GetVarint();
+        if (v != 0)
+        {
+            words[n] = (n >= stride) ? v ^ words[n - stride] : v;
+            n++;
+            continue;
+        }
+        const ImU32 run = in->GetVarint() + 1;
+        if (run > (ImU32)(count - n))
+        {
+            in->Error = true;
+            return;
+        }
+        for (ImU32 run_n = 0; run_n < run; run_n++, n++)
+            words[n] = (n >= stride) ? words[n - stride] : 0;
+    }
+}
+
+static inline ImU64 ImGuiRemote_HashWords(const ImU32* words, int count)
+{
+    ImU64 h = 0x9E3779B97F4A7C15ULL;
+    for (int n = 0; n < count; n++)
+    {
+        h = (h ^ words[n]) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 32;
+    }
+    return h;
+}
+
+static inline ImU64 ImGuiRemote_HashCombine(ImU64 h, ImU64 v)
+{
+    h = ((h << 27) | (h >> 37)) ^ v;
+    return h * 0x9E3779B97F4A7C15ULL;
+}
+
+static bool ImGuiRemote_FindHash(const ImVector<ImU64>& sorted_hashes, ImU64 hash)
+{
+    int lo = 0, hi = sorted_hashes.Size;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        if (sorted_hashes.Data[mid] < hash)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo < sorted_hashes.Size && sorted_hashes.Data[lo] == hash;
+}
+
+static int IMGUI_CDECL ImGuiRemote_CompareU64(const void* lhs, const void* rhs)
+{
+    const ImU64 a = *(const ImU64*)lhs, b = *(const ImU64*)rhs;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+static int IMGUI_CDECL ImGuiRemote_CompareBlockRefs(const void* lhs, const void* rhs)
+{
+    const ImU64 a = ((const ImGuiRemoteBlockRef*)lhs)->Hash, b = ((const ImGuiRemoteBlockRef*)rhs)->Hash;
+    return (a < b) ? -1 : (a > b) ? +1 : 0;
+}
+
+// Cut elements into blocks at content-defined boundaries: an element whose hash matches the mask ends a block.
+// 'element_hashes' are hashes of each element. Block hashes include their type and elements count.
+static void ImGuiRemote_CutBlocks(ImVector<ImGuiRemoteBlock>* out_blocks, const ImU64* element_hashes, int count, ImU32 mask, ImGuiRemoteBlockType type)
+{
+    int block_start = 0;
+    ImU64 block_hash = 0;
+    for (int n = 0; n < count; n++)
+    {
+        const ImU64 h = element_hashes[n];
+        block_hash = ImGuiRemote_HashCombine(block_hash, h);
+        const int block_count = n + 1 - block_start;
+        if (n + 1 == count || (block_count >= IMGUI_REMOTE_BLOCK_MIN && ((h >> 40) & mask) == 0) || block_count == IMGUI_REMOTE_BLOCK_MAX)
+        {
+            ImGuiRemoteBlock block;
+            block.Hash = ImGuiRemote_HashCombine(block_hash, ((ImU64)type << 32) | (ImU64)block_count);
+            block.Offset = (ImU32)block_start;
+            block.Count = (ImU32)block_count;
+            block.BaseIdx = 0;
+            block.Type = (ImU32)type;
+            out_blocks->push_back(block);
+            block_start = n + 1;
+            block_hash = 0;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiRemoteConnection, transport
+//-----------------------------------------------------------------------------
+
+#if !defined(_WIN32)
+struct ImGuiRemoteTransportFd
+{
+    int FdRecv;
+    int FdSend;
+};
+
+static bool ImGuiRemote_SendFd(void* user_data, const void* data, size_t size)
+{
+    ImGuiRemoteTransportFd* fds = (ImGuiRemoteTransportFd*)user_data;
+    const char* p = (const char*)data;
+    while (size > 0)
+    {
+        const ssize_t n = write(fds->FdSend, p, size);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        size -= (size_t)n;
+    }
+    return true;
+}
+
+static int ImGuiRemote_RecvFd(void* user_data, void* data, size_t size)
+{
+    // Poll first so file descriptors may stay in blocking mode, for Send().
+    ImGuiRemoteTransportFd* fds = (ImGuiRemoteTransportFd*)user_data;
+    struct pollfd pfd = { fds->FdRecv, POLLIN, 0 };
+    const int ready = poll(&pfd, 1, 0);
+    if (ready == 0 || (ready < 0 && errno == EINTR))
+        return 0;
+    if (ready < 0)
+        return -1;
+    const ssize_t n = read(fds->FdRecv, data, size);
+    if (n < 0)
+        return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : -1;
+    return (n == 0) ? -1 : (int)n; // 0 == end of file
+}
+
+bool ImGuiRemote_InitTransportFd(ImGuiRemoteTransport* transport, int fd_recv, int fd_send)
+{
+    if (fd_recv < 0 || fd_send < 0)
+        return false;
+    ImGuiRemoteTransportFd* fds = IM_NEW(ImGuiRemoteTransportFd)();
+    fds->FdRecv = fd_recv;
+    fds->FdSend = fd_send;
+    transport->Send = ImGuiRemote_SendFd;
+    transport->Recv = ImGuiRemote_RecvFd;
+    transport->UserData = fds;
+    return true;
+}
+
+void ImGuiRemote_ShutdownTransportFd(ImGuiRemoteTransport* transport)
+{
+    IM_DELETE((ImGuiRemoteTransportFd*)transport->UserData);
+    memset(transport, 0, sizeof(*transport));
+}
+#else
+bool ImGuiRemote_InitTransportFd(ImGuiRemoteTransport*, int, int)
+{
+    return false;
+}
+
+void ImGuiRemote_ShutdownTransportFd(ImGuiRemoteTransport*)
+{
+}
+#endif
+
+bool ImGuiRemoteConnection::Flush()
+{
+    if (SendBuffer.Size == 0 || !Connected)
+        return Connected;
+    if (Transport.Send == NULL || !Transport.Send(Transport.UserData, SendBuffer.Data, (size_t)SendBuffer.Size))
+        Connected = false;
+    BytesSent += (ImU64)SendBuffer.Size;
+    SendBuffer.resize(0);
+    return Connected;
+}
+
+bool ImGuiRemoteConnection::Receive()
+{
+    if (!Connected || Transport.Recv == NULL)
+        return Connected = false;
+
+    // Discard consumed data
+    if (RecvBufferRead > 0)
+    {
+        memmove(RecvBuffer.Data, RecvBuffer.Data + RecvBufferRead, (size_t)(RecvBuffer.Size - RecvBufferRead));
+        RecvBuffer.resize(RecvBuffer.Size - RecvBufferRead);
+        RecvBufferRead = 0;
+    }
+    while (true)
+    {
+        const int read_size = 64 * 1024;
+        const int offset = RecvBuffer.Size;
+        RecvBuffer.resize(offset + read_size);
+        const int n = Transport.Recv(Transport.UserData, RecvBuffer.Data + offset, (size_t)read_size);
+        RecvBuffer.resize(offset + ImMax(n, 0));
+        if (n < 0)
+            Connected = false;
+        if (n <= 0)
+            break;
+        BytesReceived += (ImU64)n;
+    }
+    return Connected;
+}
+
+const char* ImGuiRemoteConnection::PeekMessage(ImU32* out_type, ImU32* out_size)
+{
+    const int available = RecvBuffer.Size - RecvBufferRead;
+    if (available < (int)sizeof(ImGuiRemoteMsgHeader))
+        return NULL;
+    ImGuiRemoteMsgHeader header;
+    memcpy(&header, RecvBuffer.Data + RecvBufferRead, sizeof(header));
+    if ((ImU64)header.Size > (ImU64)(available - (int)sizeof(ImGuiRemoteMsgHeader)))
+        return NULL;
+    *out_type = header.Type;
+    *out_size = header.Size;
+    return RecvBuffer.Data + RecvBufferRead + sizeof(ImGuiRemoteMsgHeader);
+}
+
+void ImGuiRemoteConnection::PopMessage()
+{
+    ImGuiRemoteMsgHeader header;
+    memcpy(&header, RecvBuffer.Data + RecvBufferRead, sizeof(header));
+    RecvBufferRead += (int)sizeof(ImGuiRemoteMsgHeader) + (int)header.Size;
+}
+
+static int ImGuiRemote_BeginMessage(ImVector<char>* out, ImGuiRemoteMsgType type)
+{
+    ImGuiRemoteMsgHeader header = { (ImU32)type, 0 };
+    const int offset = out->Size;
+    ImGuiRemote_PutBytes(out, &header, sizeof(header));
+    return offset;
+}
+
+static void ImGuiRemote_EndMessage(ImVector<char>* out, int offset)
+{
+    const ImU32 size = (ImU32)(out->Size - offset - (int)sizeof(ImGuiRemoteMsgHeader));
+    memcpy(out->Data + offset + offsetof(ImGuiRemoteMsgHeader, Size), &size, sizeof(size));
+}
+
+static void ImGuiRemote_GetHello(ImGuiRemoteHello* hello)
+{
+    hello->Version = IMGUI_REMOTE_VERSION;
+    hello->VtxSize = (ImU32)sizeof(ImDrawVert);
+    hello->IdxSize = (ImU32)sizeof(ImDrawIdx);
+    hello->RectSize = (ImU32)sizeof(ImDrawRectInstance);
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiRemoteServer
+//-----------------------------------------------------------------------------
+
+ImGuiRemoteServer::ImGuiRemoteServer()
+{
+    AtlasTexID = 0;
+    AtlasPixels = NULL;
+    AtlasWidth = AtlasHeight = 0;
+    FramesCount = InputEventsReceived = 0;
+    StatsListsSent = StatsListsReused = StatsBlocksSent = StatsBlocksReused = 0;
+    StatsBytesRaw = StatsBytesSent = 0;
+}
+
+ImGuiRemoteServer::~ImGuiRemoteServer()
+{
+}
+
+bool ImGuiRemoteServer::NewFrame()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    Receive();
+    ImU32 msg_type, msg_size;
+    while (const char* msg = PeekMessage(&msg_type, &msg_size))
+    {
+        ImGuiRemoteReader in(msg, msg_size);
+        if (msg_type == ImGuiRemoteMsgType_Display)
+        {
+            ImVec2 display_size, framebuffer_scale;
+            in.Get(&display_size, sizeof(display_size));
+            in.Get(&framebuffer_scale, sizeof(framebuffer_scale));
+            if (!in.Error)
+            {
+                io.DisplaySize = display_size;
+                io.DisplayFramebufferScale = framebuffer_scale;
+            }
+        }
+        else if (msg_type == ImGuiRemoteMsgType_Inputs)
+        {
+            const ImU32 count = in.GetVarint();
+            for (ImU32 n = 0; n < count && !in.Error; n++)
+            {
+                const ImU32 type = in.GetU8();
+                InputEventsReceived++;
+                float x, y;
+                switch (type)
+                {
+                case ImGuiInputEventType_MousePos:
+                case ImGuiInputEventType_MouseWheel:
+                    in.Get(&x, sizeof(x));
+                    in.Get(&y, sizeof(y));
+                    io.AddMouseSourceEvent((ImGuiMouseSource)ImMin(in.GetU8(), (ImU32)ImGuiMouseSource_COUNT - 1));
+                    if (type == ImGuiInputEventType_MousePos)
+                        io.AddMousePosEvent(x, y);
+                    else
+                        io.AddMouseWheelEvent(x, y);
+                    break;
+                case ImGuiInputEventType_MouseButton:
+                {
+                    const int button = (int)in.GetVarint();
+                    const bool down = in.GetU8() != 0;
+                    io.AddMouseSourceEvent((ImGuiMouseSource)ImMin(in.GetU8(), (ImU32)ImGuiMouseSource_COUNT - 1));
+                    if (button >= 0 && button < ImGuiMouseButton_COUNT)
+                        io.AddMouseButtonEvent(button, down);
+                    break;
+                }
+                case ImGuiInputEventType_Key:
+                {
+                    const ImGuiKey key = (ImGuiKey)in.GetVarint();
+                    const bool down = in.GetU8() != 0;
+                    in.Get(&x, sizeof(x));
+                    if (ImGui::IsNamedKeyOrMod(key) && !ImGui::IsAliasKey(key))
+                        io.AddKeyAnalogEvent(key, down, x);
+                    break;
+                }
+                case ImGuiInputEventType_Text:
+                    io.AddInputCharacter(in.GetVarint());
+                    break;
+                case ImGuiInputEventType_Focus:
+                    io.AddFocusEvent(in.GetU8() != 0);
+                    break;
+                default:
+                    in.Error = true;
+                    break;
+                }
+            }
+        }
+        PopMessage();
+        if (in.Error)
+            Connected = false;
+    }
+    return Connected;
+}
+
+bool ImGuiRemoteServer::SendFrame(const ImDrawData* draw_data, ImFontAtlas* atlas)
+{
+    IM_ASSERT(draw_data != NULL && draw_data->Valid);
+    if (!Connected)
+        return false;
+    ImVector<char>* out = &SendBuffer;
+    if (FramesCount == 0)
+    {
+        ImGuiRemoteHello hello;
+        ImGuiRemote_GetHello(&hello);
+        const int msg_offset = ImGuiRemote_BeginMessage(out, ImGuiRemoteMsgType_Hello);
+        ImGuiRemote_PutBytes(out, &hello, sizeof(hello));
+        ImGuiRemote_EndMessage(out, msg_offset);
+    }
+
+    // Send atlas texture when it changed
+    if (atlas != NULL)
+    {
+        const void* atlas_pixels = atlas->TexPixelsRGBA32 ? (const void*)atlas->TexPixelsRGBA32 : (const void*)atlas->TexPixelsAlpha8;
+        if (atlas_pixels != NULL && (atlas_pixels != AtlasPixels || AtlasTexID != (ImU64)(intptr_t)atlas->TexID || AtlasWidth != atlas->TexWidth || AtlasHeight != atlas->TexHeight))
+        {
+            AtlasTexID = (ImU64)(intptr_t)atlas->TexID;
+            AtlasPixels = atlas_pixels;
+            AtlasWidth = atlas->TexWidth;
+            AtlasHeight = atlas->TexHeight;
+            const int bytes_per_pixel = atlas->TexPixelsRGBA32 ? 4 : 1;
+            const int msg_offset = ImGuiRemote_BeginMessage(out, ImGuiRemoteMsgType_Texture);
+            ImGuiRemote_PutU64(out, AtlasTexID);
+            ImGuiRemote_PutVarint(out, (ImU32)AtlasWidth);
+            ImGuiRemote_PutVarint(out, (ImU32)AtlasHeight);
+            ImGuiRemote_PutVarint(out, (ImU32)bytes_per_pixel);
+            const int pixels_size = AtlasWidth * AtlasHeight * bytes_per_pixel;
+            if (pixels_size % 4 == 0)
+            {
+                ImGuiRemote_PutWords(out, (const ImU32*)atlas_pixels, pixels_size / 4, 1);
+            }
+            else
+            {
+                ImVector<ImU32> words;
+                words.resize((pixels_size + 3) / 4, 0);
+                memcpy(words.Data, atlas_pixels, (size_t)pixels_size);
+                ImGuiRemote_PutWords(out, words.Data, words.Size, 1);
+            }
+            ImGuiRemote_EndMessage(out, msg_offset);
+        }
+    }
+
+    StatsListsSent = StatsListsReused = StatsBlocksSent = StatsBlocksReused = 0;
+    StatsBytesRaw = 0;
+    CurrListHashes.resize(0);
+    CurrBlockHashes.resize(0);
+
+    const int msg_offset = ImGuiRemote_BeginMessage(out, ImGuiRemoteMsgType_Frame);
+    ImGuiRemoteFrameHeader header;
+    header.DisplayPos = draw_data->DisplayPos;
+    header.DisplaySize = draw_data->DisplaySize;
+    header.FramebufferScale = draw_data->FramebufferScale;
+    header.CmdListsCount = draw_data->CmdLists.Size;
+    header.MouseCursor = ImGui::GetMouseCursor();
+    ImGuiRemote_PutBytes(out, &header, sizeof(header));
+
+    ImVector<ImU64> element_hashes;
+    ImVector<ImGuiRemoteCmd> cmds;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        StatsBytesRaw += sizeof(ImDrawCmd) * (size_t)draw_list->CmdBuffer.Size + sizeof(ImDrawVert) * (size_t)draw_list->VtxBuffer.Size + (size_t)draw_list->IdxSize * draw_list->IdxBuffer.Size + sizeof(ImDrawRectInstance) * (size_t)draw_list->RectBuffer.Size;
+
+        // Commands
+        cmds.resize(0);
+        for (const ImDrawCmd& src : draw_list->CmdBuffer)
+        {
+            if (src.UserCallback != NULL && src.UserCallback != ImDrawCallback_ResetRenderState)
+                continue;
+            ImGuiRemoteCmd cmd;
+            const ImU64 tex_id = (ImU64)(intptr_t)src.GetTexID();
+            cmd.ClipRect = src.ClipRect;
+            cmd.TexID[0] = (ImU32)tex_id;
+            cmd.TexID[1] = (ImU32)(tex_id >> 32);
+            cmd.VtxOffset = src.VtxOffset;
+            cmd.IdxOffset = src.IdxOffset;
+            cmd.ElemCount = src.ElemCount;
+            cmd.RectOffset = src.RectOffset;
+            cmd.RectCount = src.RectCount;
+            cmd.Flags = (src.UserCallback != NULL) ? 1 : 0;
+            cmds.push_back(cmd);
+        }
+        const int cmd_words = (int)(sizeof(ImGuiRemoteCmd) / 4);
+        ImU64 list_hash = ImGuiRemote_HashWords((const ImU32*)(const void*)cmds.Data, cmds.Size * cmd_words);
+
+        // Indices, flattening segments and packed indices
+        Indices.resize(draw_list->IdxBuffer.Size);
+        if (draw_list->IdxSegments.Size == 0 && draw_list->IdxSize == 4)
+            memcpy(Indices.Data, draw_list->IdxBuffer.Data, (size_t)Indices.Size * 4);
+        else
+            for (int idx_n = 0; idx_n < Indices.Size; idx_n++)
+                Indices.Data[idx_n] = draw_list->_GetIdx(idx_n);
+
+        // Cut blocks
+        Blocks.resize(0);
+        const int vtx_words = (int)(sizeof(ImDrawVert) / 4);
+        element_hashes.resize(ImMax(ImMax(draw_list->VtxBuffer.Size, Indices.Size), draw_list->RectBuffer.Size));
+        for (int n = 0; n < draw_list->VtxBuffer.Size; n++)
+            element_hashes.Data[n] = ImGuiRemote_HashWords((const ImU32*)(const void*)&draw_list->VtxBuffer.Data[n], vtx_words);
+        ImGuiRemote_CutBlocks(&Blocks, element_hashes.Data, draw_list->VtxBuffer.Size, IMGUI_REMOTE_BLOCK_VTX_MASK, ImGuiRemoteBlockType_Vtx);
+        for (int n = 0; n < Indices.Size; n++)
+        {
+            const ImU32 delta = Indices.Data[n] - (n > 0 ? Indices.Data[n - 1] : 0);
+            element_hashes.Data[n] = ImGuiRemote_HashWords(&delta, 1);
+        }
+        ImGuiRemote_CutBlocks(&Blocks, element_hashes.Data, Indices.Size, IMGUI_REMOTE_BLOCK_IDX_MASK, ImGuiRemoteBlockType_Idx);
+        const int rect_words = (int)(sizeof(ImDrawRectInstance) / 4);
+        for (int n = 0; n < draw_list->RectBuffer.Size; n++)
+            element_hashes.Data[n] = ImGuiRemote_HashWords((const ImU32*)(const void*)&draw_list->RectBuffer.Data[n], rect_words);
+        ImGuiRemote_CutBlocks(&Blocks, element_hashes.Data, draw_list->RectBuffer.Size, IMGUI_REMOTE_BLOCK_RECT_MASK, ImGuiRemoteBlockType_Rect);
+        for (const ImGuiRemoteBlock& block : Blocks)
+        {
+            list_hash = ImGuiRemote_HashCombine(list_hash, block.Hash);
+            CurrBlockHashes.push_back(block.Hash);
+        }
+        CurrListHashes.push_back(list_hash);
+
+        // Same draw list as previous frame
+        if (ImGuiRemote_FindHash(PrevListHashes, list_hash))
+        {
+            ImGuiRemote_PutU8(out, 0);
+            ImGuiRemote_PutU64(out, list_hash);
+            StatsListsReused++;
+            continue;
+        }
+
+        ImGuiRemote_PutU8(out, 1);
+        ImGuiRemote_PutU64(out, list_hash);
+        ImGuiRemote_PutVarint(out, (ImU32)cmds.Size);
+        ImGuiRemote_PutVarint(out, (ImU32)draw_list->VtxBuffer.Size);
+        ImGuiRemote_PutVarint(out, (ImU32)Indices.Size);
+        ImGuiRemote_PutVarint(out, (ImU32)draw_list->RectBuffer.Size);
+        ImGuiRemote_PutWords(out, (const ImU32*)(const void*)cmds.Data, cmds.Size * cmd_words, cmd_words);
+        ImGuiRemote_PutVarint(out, (ImU32)Blocks.Size);
+        for (const ImGuiRemoteBlock& block : Blocks)
+        {
+            const bool reuse = ImGuiRemote_FindHash(PrevBlockHashes, block.Hash);
+            ImGuiRemote_PutU8(out, block.Type | (reuse ? 0 : 0x80));
+            ImGuiRemote_PutU64(out, block.Hash);
+            ImGuiRemote_PutVarint(out, block.Count);
+            if (reuse)
+            {
+                StatsBlocksReused++;
+                continue;
+            }
+            StatsBlocksSent++;
+            if (block.Type == ImGuiRemoteBlockType_Vtx)
+            {
+                ImGuiRemote_PutWords(out, (const ImU32*)(const void*)(draw_list->VtxBuffer.Data + block.Offset), (int)block.Count * vtx_words, vtx_words);
+            }
+            else if (block.Type == ImGuiRemoteBlockType_Rect)
+            {
+                ImGuiRemote_PutWords(out, (const ImU32*)(const void*)(draw_list->RectBuffer.Data + block.Offset), (int)block.Count * rect_words, rect_words);
+            }
+            else
+            {
+                ImU32 prev_idx = (block.Offset > 0) ? Indices.Data[block.Offset - 1] : 0;
+                for (ImU32 n = block.Offset; n < block.Offset + block.Count; n++)
+                {
+                    const int delta = (int)(Indices.Data[n] - prev_idx);
+                    ImGuiRemote_PutVarint(out, (ImU32)((delta << 1) ^ (delta >> 31))); // Zigzag
+                    prev_idx = Indices.Data[n];
+                }
+            }
+        }
+        StatsListsSent++;
+    }
+    ImGuiRemote_EndMessage(out, msg_offset);
+    StatsBytesSent = (size_t)(out->Size - msg_offset);
+
+    // Blocks and lists of this frame may be referenced by next frame
+    ImQsort(CurrListHashes.Data, (size_t)CurrListHashes.Size, sizeof(ImU64), ImGuiRemote_CompareU64);
+    ImQsort(CurrBlockHashes.Data, (size_t)CurrBlockHashes.Size, sizeof(ImU64), ImGuiRemote_CompareU64);
+    PrevListHashes.swap(CurrListHashes);
+    PrevBlockHashes.swap(CurrBlockHashes);
+    FramesCount++;
+    return Flush();
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiRemoteClient
+//-----------------------------------------------------------------------------
+
+ImGuiRemoteClient::ImGuiRemoteClient()
+{
+    MissingTexID = 0;
+    DisplaySizeSent = FramebufferScaleSent = ImVec2(-1.0f, -1.0f);
+    MouseCursor = ImGuiMouseCursor_Arrow;
+    FramesCount = InputEventsSent = 0;
+}
+
+ImGuiRemoteClient::~ImGuiRemoteClient()
+{
+    // A draw list may appear in several of those arrays (and several times when a frame has identical draw lists)
+    ImVector<ImGuiRemoteDrawList*>* arrays[] = { &DrawLists, &PrevDrawLists, &FreeDrawLists };
+    ImVector<ImGuiRemoteDrawList*> remote_lists;
+    for (ImVector<ImGuiRemoteDrawList*>* array : arrays)
+        for (ImGuiRemoteDrawList* remote_list : *array)
+            if (!remote_lists.contains(remote_list))
+                remote_lists.push_back(remote_list);
+    for (ImGuiRemoteDrawList* remote_list : remote_lists)
+        IM_DELETE(remote_list);
+    for (ImGuiRemoteTexture& tex : Textures)
+        tex.Pixels.clear();
+}
+
+static bool ImGuiRemote_DecodeDrawList(ImGuiRemoteClient* client, ImGuiRemoteReader* in, ImGuiRemoteDrawList* remote_list)
+{
+    ImDrawList* draw_list = remote_list->DrawList;
+    const int cmds_count = (int)in->GetVarint();
+    const int vtx_count = (int)in->GetVarint();
+    const int idx_count = (int)in->GetVarint();
+    const int rect_count = (int)in->GetVarint();
+    if (in->Error || cmds_count < 0 || vtx_count < 0 || idx_count < 0 || rect_count < 0 || (size_t)cmds_count > (size_t)(in->End - in->P) || (size_t)vtx_count + idx_count + rect_count > (size_t)(in->End - in->P) * IMGUI_REMOTE_BLOCK_MAX)
+        return false;
+
+    // Commands
+    const int cmd_words = (int)(sizeof(ImGuiRemoteCmd) / 4);
+    ImVector<ImGuiRemoteCmd> cmds;
+    cmds.resize(cmds_count);
+    ImGuiRemote_GetWords(in, (ImU32*)(void*)cmds.Data, cmds_count * cmd_words, cmd_words);
+    draw_list->CmdBuffer.resize(0);
+    remote_list->CmdTexIDs.resize(0);
+    for (const ImGuiRemoteCmd& src : cmds)
+    {
+        if ((ImU64)src.VtxOffset > (ImU64)vtx_count || (ImU64)src.IdxOffset + src.ElemCount > (ImU64)idx_count || (ImU64)src.RectOffset + src.RectCount > (ImU64)rect_count)
+            return false;
+        ImDrawCmd cmd;
+        cmd.ClipRect = src.ClipRect;
+        cmd.VtxOffset = src.VtxOffset;
+        cmd.IdxOffset = src.IdxOffset;
+        cmd.ElemCount = src.ElemCount;
+        cmd.RectOffset = src.RectOffset;
+        cmd.RectCount = src.RectCount;
+        cmd.UserCallback = (src.Flags & 1) ? ImDrawCallback_ResetRenderState : NULL;
+        draw_list->CmdBuffer.push_back(cmd);
+        remote_list->CmdTexIDs.push_back((ImU64)src.TexID[0] | ((ImU64)src.TexID[1] << 32));
+    }
+
+    // Blocks
+    draw_list->VtxBuffer.resize(vtx_count);
+    draw_list->IdxBuffer.resize(idx_count);
+    draw_list->RectBuffer.resize(rect_count);
+    draw_list->IdxSize = sizeof(ImDrawIdx);
+    remote_list->Blocks.resize(0);
+    const int vtx_words = (int)(sizeof(ImDrawVert) / 4);
+    const int rect_words = (int)(sizeof(ImDrawRectInstance) / 4);
+    const int blocks_count = (int)in->GetVarint();
+    ImU32 offsets[3] = { 0, 0, 0 };
+    ImU32 prev_idx = 0;
+    for (int block_n = 0; block_n < blocks_count && !in->Error; block_n++)
+    {
+        const ImU32 type_and_flags = in->GetU8();
+        ImGuiRemoteBlock block;
+        block.Type = type_and_flags & 0x7F;
+        block.Hash = in->GetU64();
+        block.Count = in->GetVarint();
+        block.BaseIdx = prev_idx;
+        if (block.Type > ImGuiRemoteBlockType_Rect)
+            return false;
+        const ImU32 elements_count = (block.Type == ImGuiRemoteBlockType_Vtx) ? (ImU32)vtx_count : (block.Type == ImGuiRemoteBlockType_Idx) ? (ImU32)idx_count : (ImU32)rect_count;
+        block.Offset = offsets[block.Type];
+        if (block.Count > elements_count - block.Offset)
+            return false;
+        offsets[block.Type] += block.Count;
+
+        if (type_and_flags & 0x80)
+        {
+            // Block sent
+            if (block.Type == ImGuiRemoteBlockType_Vtx)
+                ImGuiRemote_GetWords(in, (ImU32*)(void*)(draw_list->VtxBuffer.Data + block.Offset), (int)block.Count * vtx_words, vtx_words);
+            else if (block.Type == ImGuiRemoteBlockType_Rect)
+                ImGuiRemote_GetWords(in, (ImU32*)(void*)(draw_list->RectBuffer.Data + block.Offset), (int)block.Count * rect_words, rect_words);
+            else
+                for (ImU32 n = block.Offset; n < block.Offset + block.Count; n++)
+                {
+                    const ImU32 zigzag = in->GetVarint();
+                    prev_idx += (zigzag >> 1) ^ (ImU32)-(int)(zigzag & 1);
+                    if (prev_idx >= (ImU32)vtx_count)
+                        return false;
+                    draw_list->IdxBuffer.Data[n] = (ImDrawIdx)prev_idx;
+                }
+        }
+        else
+        {
+            // Block reused from previous frame
+            int lo = 0, hi = client->PrevBlocks.Size;
+            while (lo < hi)
+            {
+                const int mid = (lo + hi) >> 1;
+                if (client->PrevBlocks.Data[mid].Hash < block.Hash)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            if (lo == client->PrevBlocks.Size || client->PrevBlocks.Data[lo].Hash != block.Hash)
+                return false;
+            const ImGuiRemoteDrawList* src_list = client->PrevDrawLists[client->PrevBlocks.Data[lo].ListN];
+            const ImGuiRemoteBlock& src_block = src_list->Blocks[client->PrevBlocks.Data[lo].BlockN];
+            if (src_block.Count != block.Count || src_block.Type != block.Type)
+                return false;
+            if (block.Type == ImGuiRemoteBlockType_Vtx)
+                memcpy(draw_list->VtxBuffer.Data + block.Offset, src_list->DrawList->VtxBuffer.Data + src_block.Offset, sizeof(ImDrawVert) * block.Count);
+            else if (block.Type == ImGuiRemoteBlockType_Rect)
+                memcpy(draw_list->RectBuffer.Data + block.Offset, src_list->DrawList->RectBuffer.Data + src_block.Offset, sizeof(ImDrawRectInstance) * block.Count);
+            else
+                for (ImU32 n = 0; n < block.Count; n++)
+                {
+                    prev_idx = block.BaseIdx + ((ImU32)src_list->DrawList->IdxBuffer.Data[src_block.Offset + n] - src_block.BaseIdx);
+                    if (prev_idx >= (ImU32)vtx_count)
+                        return false;
+                    draw_list->IdxBuffer.Data[block.Offset + n] = (ImDrawIdx)prev_idx;
+                }
+        }
+        remote_list->Blocks.push_back(block);
+    }
+    if (in->Error || offsets[0] != (ImU32)vtx_count || offsets[1] != (ImU32)idx_count || offsets[2] != (ImU32)rect_count)
+        return false;
+
+    // Indices must address vertices past the VtxOffset of their command, so a corrupted stream can't make the renderer read out of bounds
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        const ImU32 vtx_limit = (ImU32)vtx_count - cmd.VtxOffset;
+        for (ImU32 n = cmd.IdxOffset; n < cmd.IdxOffset + cmd.ElemCount; n++)
+            if ((ImU32)draw_list->IdxBuffer.Data[n] >= vtx_limit)
+                return false;
+    }
+    return true;
+}
+
+static bool ImGuiRemote_DecodeFrame(ImGuiRemoteClient* client, ImGuiRemoteReader* in)
+{
+    ImGuiRemoteFrameHeader header;
+    in->Get(&header, sizeof(header));
+    if (in->Error || header.CmdListsCount < 0)
+        return false;
+    client->DrawData.Clear();
+    client->DrawData.DisplayPos = header.DisplayPos;
+    client->DrawData.DisplaySize = header.DisplaySize;
+    client->DrawData.FramebufferScale = header.FramebufferScale;
+    client->MouseCursor = header.MouseCursor;
+
+    client->DrawLists.resize(0);
+    for (int list_n = 0; list_n < header.CmdListsCount; list_n++)
+    {
+        const ImU32 kind = in->GetU8();
+        const ImU64 list_hash = in->GetU64();
+        ImGuiRemoteDrawList* remote_list = NULL;
+        if (kind == 0)
+        {
+            // Same as previous frame
+            for (ImGuiRemoteDrawList* prev_list : client->PrevDrawLists)
+                if (prev_list->Hash == list_hash)
+                    remote_list = prev_list;
+            if (remote_list == NULL)
+                return false;
+        }
+        else
+        {
+            if (client->FreeDrawLists.Size > 0)
+            {
+                remote_list = client->FreeDrawLists.back();
+                client->FreeDrawLists.pop_back();
+            }
+            else
+            {
+                remote_list = IM_NEW(ImGuiRemoteDrawList)();
+            }
+            remote_list->Hash = list_hash;
+            const bool ok = ImGuiRemote_DecodeDrawList(client, in, remote_list);
+            client->DrawLists.push_back(remote_list); // Add before checking error so it gets recycled
+            if (!ok)
+                return false;
+        }
+        if (kind == 0)
+            client->DrawLists.push_back(remote_list);
+        client->DrawData.CmdLists.push_back(remote_list->DrawList);
+        client->DrawData.CmdListsCount++;
+        client->DrawData.TotalVtxCount += remote_list->DrawList->VtxBuffer.Size;
+        client->DrawData.TotalIdxCount += remote_list->DrawList->IdxBuffer.Size;
+    }
+    client->DrawData.Valid = true;
+    return !in->Error;
+}
+
+bool ImGuiRemoteClient::Update()
+{
+    Receive();
+    bool new_frame = false;
+    ImU32 msg_type, msg_size;
+    while (const char* msg = PeekMessage(&msg_type, &msg_size))
+    {
+        ImGuiRemoteReader in(msg, msg_size);
+        if (msg_type == ImGuiRemoteMsgType_Hello)
+        {
+            ImGuiRemoteHello hello, expected_hello;
+            ImGuiRemote_GetHello(&expected_hello);
+            in.Get(&hello, sizeof(hello));
+            if (memcmp(&hello, &expected_hello, sizeof(hello)) != 0)
+                in.Error = true;
+        }
+        else if (msg_type == ImGuiRemoteMsgType_Texture)
+        {
+            const ImU64 remote_tex_id = in.GetU64();
+            const int width = (int)in.GetVarint();
+            const int height = (int)in.GetVarint();
+            const int bytes_per_pixel = (int)in.GetVarint();
+            if (width <= 0 || height <= 0 || (bytes_per_pixel != 1 && bytes_per_pixel != 4) || (ImU64)width * height > (ImU64)msg_size * 256)
+            {
+                in.Error = true;
+            }
+            else
+            {
+                ImGuiRemoteTexture* tex = NULL;
+                for (ImGuiRemoteTexture& existing_tex : Textures)
+                    if (existing_tex.RemoteTexID == remote_tex_id)
+                        tex = &existing_tex;
+                if (tex == NULL)
+                {
+                    Textures.resize(Textures.Size + 1);
+                    tex = &Textures.back();
+                    memset((void*)tex, 0, sizeof(*tex));
+                    tex->RemoteTexID = remote_tex_id;
+                }
+                tex->Width = width;
+                tex->Height = height;
+                tex->BytesPerPixel = bytes_per_pixel;
+                tex->Pixels.resize(((width * height * bytes_per_pixel) + 3) & ~3);
+                ImGuiRemote_GetWords(&in, (ImU32*)(void*)tex->Pixels.Data, tex->Pixels.Size / 4, 1);
+                tex->Pixels.resize(width * height * bytes_per_pixel);
+                tex->Updated = true;
+            }
+        }
+        else if (msg_type == ImGuiRemoteMsgType_Frame)
+        {
+            if (!ImGuiRemote_DecodeFrame(this, &in))
+                in.Error = true;
+
+            // Recycle draw lists of previous frame which are not used anymore, then index blocks for next frame
+            for (ImGuiRemoteDrawList* prev_list : PrevDrawLists)
+                if (!DrawLists.contains(prev_list))
+                    FreeDrawLists.push_back(prev_list);
+            PrevDrawLists = DrawLists;
+            PrevBlocks.resize(0);
+            for (int list_n = 0; list_n < PrevDrawLists.Size; list_n++)
+                for (int block_n = 0; block_n < PrevDrawLists[list_n]->Blocks.Size; block_n++)
+                {
+                    ImGuiRemoteBlockRef ref;
+                    ref.Hash = PrevDrawLists[list_n]->Blocks[block_n].Hash;
+                    ref.ListN = list_n;
+                    ref.BlockN = block_n;
+                    PrevBlocks.push_back(ref);
+                }
+            ImQsort(PrevBlocks.Data, (size_t)PrevBlocks.Size, sizeof(ImGuiRemoteBlockRef), ImGuiRemote_CompareBlockRefs);
+            FramesCount++;
+            new_frame = true;
+        }
+        PopMessage();
+        if (in.Error)
+        {
+            Connected = false; // Protocol error: both ends can't be kept in sync anymore
+            return false;
+        }
+    }
+    return new_frame;
+}
+
+bool ImGuiRemoteClient::SendInputs()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    ImVector<char>* out = &SendBuffer;
+    if (io.DisplaySize.x != DisplaySizeSent.x || io.DisplaySize.y != DisplaySizeSent.y || io.DisplayFramebufferScale.x != FramebufferScaleSent.x || io.DisplayFramebufferScale.y != FramebufferScaleSent.y)
+    {
+        DisplaySizeSent = io.DisplaySize;
+        FramebufferScaleSent = io.DisplayFramebufferScale;
+        const int msg_offset = ImGuiRemote_BeginMessage(out, ImGuiRemoteMsgType_Display);
+        ImGuiRemote_PutBytes(out, &io.DisplaySize, sizeof(ImVec2));
+        ImGuiRemote_PutBytes(out, &io.DisplayFramebufferScale, sizeof(ImVec2));
+        ImGuiRemote_EndMessage(out, msg_offset);
+    }
+    if (g.InputEventsQueue.Size > 0)
+    {
+        const int msg_offset = ImGuiRemote_BeginMessage(out, ImGuiRemoteMsgType_Inputs);
+        ImGuiRemote_PutVarint(out, (ImU32)g.InputEventsQueue.Size);
+        InputEventsSent += g.InputEventsQueue.Size;
+        for (const ImGuiInputEvent& e : g.InputEventsQueue)
+        {
+            ImGuiRemote_PutU8(out, (ImU32)e.Type);
+            switch (e.Type)
+            {
+            case ImGuiInputEventType_MousePos:
+                ImGuiRemote_PutBytes(out, &e.MousePos.PosX, sizeof(float));
+                ImGuiRemote_PutBytes(out, &e.MousePos.PosY, sizeof(float));
+                ImGuiRemote_PutU8(out, (ImU32)e.MousePos.MouseSource);
+                break;
+            case ImGuiInputEventType_MouseWheel:
+                ImGuiRemote_PutBytes(out, &e.MouseWheel.WheelX, sizeof(float));
+                ImGuiRemote_PutBytes(out, &e.MouseWheel.WheelY, sizeof(float));
+                ImGuiRemote_PutU8(out, (ImU32)e.MouseWheel.MouseSource);
+                break;
+            case ImGuiInputEventType_MouseButton:
+                ImGuiRemote_PutVarint(out, (ImU32)e.MouseButton.Button);
+                ImGuiRemote_PutU8(out, e.MouseButton.Down ? 1 : 0);
+                ImGuiRemote_PutU8(out, (ImU32)e.MouseButton.MouseSource);
+                break;
+            case ImGuiInputEventType_Key:
+                ImGuiRemote_PutVarint(out, (ImU32)e.Key.Key);
+                ImGuiRemote_PutU8(out, e.Key.Down ? 1 : 0);
+                ImGuiRemote_PutBytes(out, &e.Key.AnalogValue, sizeof(float));
+                break;
+            case ImGuiInputEventType_Text:
+                ImGuiRemote_PutVarint(out, e.Text.Char);
+                break;
+            case ImGuiInputEventType_Focus:
+                ImGuiRemote_PutU8(out, e.AppFocused.Focused ? 1 : 0);
+                break;
+            default:
+                IM_ASSERT(0);
+                break;
+            }
+        }
+        ImGuiRemote_EndMessage(out, msg_offset);
+        g.InputEventsQueue.resize(0);
+    }
+    return Flush();
+}
+
+ImDrawData* ImGuiRemoteClient::GetDrawData()
+{
+    // Translate texture identifiers (they may have been updated since frame was decoded)
+    for (ImGuiRemoteDrawList* remote_list : DrawLists)
+        for (int cmd_n = 0; cmd_n < remote_list->DrawList->CmdBuffer.Size; cmd_n++)
+        {
+            ImTextureID tex_id = MissingTexID;
+            for (const ImGuiRemoteTexture& tex : Textures)
+                if (tex.RemoteTexID == remote_list->CmdTexIDs[cmd_n])
+                    tex_id = tex.TexID;
+            remote_list->DrawList->CmdBuffer[cmd_n].TextureId = tex_id;
+        }
+    return &DrawData;
+}
+
+#endif // #ifndef IMGUI_DISABLE
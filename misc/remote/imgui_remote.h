@@ -0,0 +1,156 @@
+// dear imgui: remote streaming of ImDrawData to a viewer, with inputs sent back (e.g. tools running on headless machines, viewed from thin clients)
+// (headers)
+
+// Usage (application, after creating its context and building its font atlas):
+//   ImGuiRemoteServer server;
+//   ImGuiRemote_InitTransportFd(&server.Transport, socket_fd, socket_fd);     // or fill ImGuiRemoteTransport with your own functions
+//   while (server.NewFrame())                                              // Receive display size and input events from viewer, submit them to io
+//   {
+//       ImGui::NewFrame(); [...] ImGui::Render();
+//       server.SendFrame(ImGui::GetDrawData(), io.Fonts);
+//   }
+// Usage (viewer, with a regular platform + renderer backend):
+//   ImGuiRemoteClient client;
+//   ImGuiRemote_InitTransportFd(&client.Transport, socket_fd, socket_fd);
+//   while (client.Connected)
+//   {
+//       MyPlatform_NewFrame();                     // Queue input events in io as usual
+//       client.SendInputs();                       // Forward queued input events and io.DisplaySize (before any ImGui::NewFrame() call)
+//       if (client.Update())                       // Receive and decode frames
+//       {
+//           for (ImGuiRemoteTexture& tex : client.Textures) if (tex.Updated) { tex.TexID = MyCreateTexture(tex.Pixels.Data, tex.Width, tex.Height); tex.Updated = false; }
+//           MyRender(client.GetDrawData());
+//       }
+//   }
+// See examples/example_null_remote/ for an end-to-end test over a local socket.
+
+// About the protocol:
+// - Messages are sent over an ordered, reliable transport (pipe, socket...). Both ends must use the same ImDrawVert/ImDrawIdx layout and byte order.
+// - Vertices, indices and rectangle instances of each draw list are cut into blocks at content-defined boundaries, identified by a 64-bit hash.
+//   Both ends remember blocks and draw lists of the previous frame: a draw list identical to one of the previous frame is sent as a hash,
+//   blocks found in the previous frame are sent as a hash, other blocks are compressed. Indices are delta-encoded, so blocks of indices
+//   stay identical when vertices are inserted or removed before them. Inserting or removing a few primitives costs a few blocks.
+// - Font atlas contents are sent when they change. Other textures are not transferred: viewer uses ImGuiRemoteClient::MissingTexID for them.
+//   Glyphs rasterized on demand after the atlas was sent (ImFontAtlasFlags_DynamicGlyphs, see ImFontAtlas::TexUpdates) are not transferred.
+// - Commands with user callbacks are dropped, except ImDrawCallback_ResetRenderState.
+
+#pragma once
+#include "imgui.h"      // IMGUI_API
+#ifndef IMGUI_DISABLE
+
+// Forward declarations
+struct ImFontAtlas;
+struct ImGuiRemoteDrawList;
+
+// Transport: sending must send all bytes (may block), receiving must not block.
+struct ImGuiRemoteTransport
+{
+    bool                    (*Send)(void* user_data, const void* data, size_t size);   // Return false on error/disconnection.
+    int                     (*Recv)(void* user_data, void* data, size_t size);         // Return number of bytes received (0 if none available), -1 on error/disconnection.
+    void*                   UserData;
+};
+
+// Transport over file descriptors (e.g. pipes or sockets, POSIX only). Descriptors are not closed by shutdown.
+IMGUI_API bool              ImGuiRemote_InitTransportFd(ImGuiRemoteTransport* transport, int fd_recv, int fd_send);
+IMGUI_API void              ImGuiRemote_ShutdownTransportFd(ImGuiRemoteTransport* transport);
+
+// [Internal] Block of vertices, indices or rectangle instances in a draw list
+struct ImGuiRemoteBlock
+{
+    ImU64                   Hash;
+    ImU32                   Offset;             // In elements
+    ImU32                   Count;
+    ImU32                   BaseIdx;            // Indices only: index preceding the block, indices are delta-encoded from it
+    ImU32                   Type;               // 0: vertices, 1: indices, 2: rectangles
+};
+
+// [Internal] Location of a block in the previous frame, sorted by hash
+struct ImGuiRemoteBlockRef
+{
+    ImU64                   Hash;
+    int                     ListN;
+    int                     BlockN;
+};
+
+// [Internal] Send/receive buffers
+struct ImGuiRemoteConnection
+{
+    ImGuiRemoteTransport    Transport;
+    bool                    Connected;
+    ImVector<char>          SendBuffer;
+    ImVector<char>          RecvBuffer;
+    int                     RecvBufferRead;
+    ImU64                   BytesSent;
+    ImU64                   BytesReceived;
+
+    ImGuiRemoteConnection()  { memset(&Transport, 0, sizeof(Transport)); Connected = true; RecvBufferRead = 0; BytesSent = BytesReceived = 0; }
+    IMGUI_API bool          Flush();
+    IMGUI_API bool          Receive();
+    IMGUI_API const char*   PeekMessage(ImU32* out_type, ImU32* out_size);  // Return payload of next complete message, or NULL
+    IMGUI_API void          PopMessage();
+};
+
+// Application side: stream frames, receive inputs
+struct ImGuiRemoteServer : ImGuiRemoteConnection
+{
+    ImVector<ImGuiRemoteBlock> Blocks;          // [Internal] Blocks of current draw list
+    ImVector<ImU32>         Indices;            // [Internal] Indices of current draw list
+    ImVector<ImU64>         PrevListHashes;     // [Internal] Sorted
+    ImVector<ImU64>         PrevBlockHashes;    // [Internal] Sorted
+    ImVector<ImU64>         CurrListHashes;
+    ImVector<ImU64>         CurrBlockHashes;
+    ImU64                   AtlasTexID;         // [Internal] Font atlas state when last sent
+    const void*             AtlasPixels;
+    int                     AtlasWidth, AtlasHeight;
+    int                     FramesCount;
+    int                     InputEventsReceived;
+
+    // Statistics of last SendFrame()
+    int                     StatsListsSent;
+    int                     StatsListsReused;
+    int                     StatsBlocksSent;
+    int                     StatsBlocksReused;
+    size_t                  StatsBytesRaw;      // Size of draw data
+    size_t                  StatsBytesSent;     // Size of message
+
+    IMGUI_API ImGuiRemoteServer();
+    IMGUI_API ~ImGuiRemoteServer();
+    IMGUI_API bool          NewFrame();         // Call before ImGui::NewFrame(): receive display size and input events from viewer and submit them to current context. Return false when disconnected.
+    IMGUI_API bool          SendFrame(const ImDrawData* draw_data, ImFontAtlas* atlas = NULL);
+};
+
+// A texture received from the application
+struct ImGuiRemoteTexture
+{
+    ImU64                   RemoteTexID;        // Texture identifier in application
+    int                     Width, Height;
+    int                     BytesPerPixel;      // 4: RGBA32, 1: Alpha8
+    ImVector<unsigned char> Pixels;
+    bool                    Updated;            // Set when pixels were received: create or update your texture, set TexID and clear this.
+    ImTextureID             TexID;              // Set by you: identifier to use for rendering
+};
+
+// Viewer side: receive frames, send inputs
+struct ImGuiRemoteClient : ImGuiRemoteConnection
+{
+    ImVector<ImGuiRemoteDrawList*> DrawLists;   // [Internal] Current frame
+    ImVector<ImGuiRemoteDrawList*> PrevDrawLists;   // [Internal] Previous frame
+    ImVector<ImGuiRemoteDrawList*> FreeDrawLists;   // [Internal]
+    ImVector<ImGuiRemoteBlockRef> PrevBlocks;   // [Internal] Blocks of previous frame
+    ImVector<ImGuiRemoteTexture> Textures;
+    ImTextureID             MissingTexID;       // Used by commands whose texture wasn't sent
+    ImDrawData              DrawData;
+    ImVec2                  DisplaySizeSent;
+    ImVec2                  FramebufferScaleSent;
+    int                     MouseCursor;        // Mouse cursor requested by application (ImGuiMouseCursor)
+    int                     FramesCount;
+    int                     InputEventsSent;
+
+    IMGUI_API ImGuiRemoteClient();
+    IMGUI_API ~ImGuiRemoteClient();
+    IMGUI_API bool          Update();           // Receive and decode data. Return true when a new frame was decoded.
+    IMGUI_API bool          SendInputs();       // Forward input events queued in current context and display size to application. Call before ImGui::NewFrame() if you call it (forwarded events are removed from the queue).
+    IMGUI_API ImDrawData*   GetDrawData();      // Last decoded frame, with texture identifiers translated.
+};
+
+#endif // #ifndef IMGUI_DISABLE